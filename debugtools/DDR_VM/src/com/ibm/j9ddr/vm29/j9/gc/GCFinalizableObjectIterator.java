@@ -29,6 +29,7 @@ import com.ibm.j9ddr.CorruptDataException;
 import com.ibm.j9ddr.vm29.j9.ObjectAccessBarrier;
 import com.ibm.j9ddr.vm29.pointer.VoidPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.GC_FinalizeListManagerPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.GC_FinalizeReferenceShardPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ObjectPointer;
 
 public class GCFinalizableObjectIterator extends GCIterator
@@ -43,6 +44,9 @@ public class GCFinalizableObjectIterator extends GCIterator
 	protected J9ObjectPointer _currentSystemObject;
 	protected J9ObjectPointer _currentDefaultObject;
 	protected J9ObjectPointer _currentReferenceObject;
+	protected GC_FinalizeReferenceShardPointer _referenceShards = GC_FinalizeReferenceShardPointer.NULL;
+	protected long _referenceShardCount = 0;
+	protected long _referenceShardIndex = 0;
 	
 	GC_FinalizeListManagerPointer _manager = null;	/* the finalize list manager */
 	
@@ -53,7 +57,7 @@ public class GCFinalizableObjectIterator extends GCIterator
 				
 		_currentSystemObject = getFirstSystemFinalizableObject();
 		_currentDefaultObject = getFirstDefaultFinalizableObject();
-		_currentReferenceObject = manager._referenceObjects();
+		_currentReferenceObject = getFirstReferenceObject();
 	}
 	
 	public static GCFinalizableObjectIterator from() throws CorruptDataException
@@ -115,7 +119,7 @@ public class GCFinalizableObjectIterator extends GCIterator
 
 				case state_reference:
 					result = _currentReferenceObject;
-					_currentReferenceObject = ObjectAccessBarrier.getReferenceLink(_currentReferenceObject);
+					advanceToNextReferenceObject();
 					break;
 				}
 				return result;
@@ -165,6 +169,54 @@ public class GCFinalizableObjectIterator extends GCIterator
 		return firstDefaultObject;
 	}
 	
+	/**
+	 * Helper method used to find the first reference object.
+	 * Cores which predate the sharded reference list have a single list head.
+	 * @return the first reference object or null if the list(s) is empty
+	 */
+	private J9ObjectPointer getFirstReferenceObject() throws CorruptDataException
+	{
+		try {
+			_referenceShards = _manager._referenceShards();
+			_referenceShardCount = _manager._referenceShardCount().longValue();
+		} catch (NoSuchFieldError e) {
+			return _manager._referenceObjects();
+		}
+
+		return nextNonEmptyReferenceShard();
+	}
+
+	/**
+	 * Find the head of the first non-empty reference shard at or after _referenceShardIndex.
+	 * @return the head of that shard or null if the remaining shards are empty
+	 */
+	private J9ObjectPointer nextNonEmptyReferenceShard() throws CorruptDataException
+	{
+		while (_referenceShardIndex < _referenceShardCount) {
+			J9ObjectPointer head = _referenceShards.add(_referenceShardIndex).head();
+			_referenceShardIndex += 1;
+			if (head.notNull()) {
+				return head;
+			}
+		}
+
+		return J9ObjectPointer.NULL;
+	}
+
+	/**
+	 * Advances the _currentReferenceObject to the next reference object,
+	 * moving on to the next reference shard at the end of the current one
+	 *
+	 * @throws CorruptDataException
+	 */
+	private void advanceToNextReferenceObject() throws CorruptDataException
+	{
+		_currentReferenceObject = ObjectAccessBarrier.getReferenceLink(_currentReferenceObject);
+		if (_currentReferenceObject.isNull()) {
+			_currentReferenceObject = nextNonEmptyReferenceShard();
+		}
+	}
+
 	/**
 	 * Advances the _currentSystemObject to the next system
 	 * finalizable object in the finalize list manager's list(s)
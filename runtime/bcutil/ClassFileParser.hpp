@@ -52,6 +52,9 @@ public:
 
 	BuildResult parseClassFile(ROMClassCreationContext *context, UDATA *initialBufferSize, U_8 **classFileBuffer);
 
+	/* Adopt a class file already parsed by the ROMClassPreparser in place of calling parseClassFile(). */
+	void useParsedClassFile(J9CfrClassFile *classFile) { _j9CfrClassFile = classFile; }
+
 	void restoreOriginalMethodBytecodes();
 
 	J9CfrClassFile *getParsedClassFile() { return _j9CfrClassFile; }
@@ -40,6 +40,7 @@
 #include "Cursor.hpp"
 #include "J9PortAllocationStrategy.hpp"
 #include "ROMClassCreationContext.hpp"
+#include "ROMClassPreparser.hpp"
 #include "ROMClassStringInternManager.hpp"
 #include "ROMClassSegmentAllocationStrategy.hpp"
 #include "ROMClassVerbosePhase.hpp"
@@ -224,7 +225,19 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 
 	context->recordParseClassFileStart();
 	ClassFileParser classFileParser(_portLibrary, _verifyClassFunction);
-	result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	ROMClassPreparser *romClassPreparser = NULL;
+	J9PreparsedClassFile *preparsed = NULL;
+	if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
+		romClassPreparser = (ROMClassPreparser *)_javaVM->dynamicLoadBuffers->romClassPreparser;
+	}
+	if (NULL != romClassPreparser) {
+		preparsed = romClassPreparser->takePreparsedClassFile(context, _verifyClassFunction);
+	}
+	if (NULL != preparsed) {
+		classFileParser.useParsedClassFile(preparsed->classFile);
+	} else {
+		result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
+	}
 	context->recordParseClassFileEnd();
 
 	if ( OK == result ) {
@@ -252,6 +265,9 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 	if ( OK == result ) {
 		context->recordTranslationEnd();
 	}
+	if (NULL != preparsed) {
+		romClassPreparser->freePreparsedClassFile(preparsed);
+	}
 
 	context->recordLoadEnd(result);
 	return result;
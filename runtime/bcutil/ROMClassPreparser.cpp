@@ -0,0 +1,552 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * ROMClassPreparser.cpp
+ */
+
+#include "ROMClassPreparser.hpp"
+
+#include "ROMClassCreationContext.hpp"
+#include "bcutil_api.h"
+#include "hashtable_api.h"
+#include "j9protos.h"
+#include "ut_j9bcu.h"
+#include "vmi.h"
+
+static const UDATA INITIAL_PREPARSE_BUFFER_SIZE = 4096;
+static const UDATA INITIAL_PREPARSE_TABLE_SIZE = 1024;
+
+static UDATA preparsedClassHashFn(void *key, void *userData);
+static UDATA preparsedClassHashEqualFn(void *leftKey, void *rightKey, void *userData);
+static int J9THREAD_PROC preparseThreadProc(void *entryArg);
+
+static UDATA
+preparsedClassHashFn(void *key, void *userData)
+{
+	J9PreparsedClassFile *entry = *(J9PreparsedClassFile **)key;
+	UDATA hash = 0;
+
+	for (UDATA i = 0; i < entry->classNameLength; i++) {
+		hash = (hash * 31) + entry->className[i];
+	}
+	return hash;
+}
+
+static UDATA
+preparsedClassHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	J9PreparsedClassFile *left = *(J9PreparsedClassFile **)leftKey;
+	J9PreparsedClassFile *right = *(J9PreparsedClassFile **)rightKey;
+
+	return J9UTF8_DATA_EQUALS(left->className, left->classNameLength, right->className, right->classNameLength);
+}
+
+static int J9THREAD_PROC
+preparseThreadProc(void *entryArg)
+{
+	((ROMClassPreparser *)entryArg)->run();
+	return 0;
+}
+
+ROMClassPreparser::ROMClassPreparser(J9JavaVM *javaVM, UDATA threadCount, UDATA memoryBudget) :
+	_javaVM(javaVM),
+	_portLibrary(javaVM->portLibrary),
+	_verifyClassFunction(NULL),
+	_monitor(NULL),
+	_table(NULL),
+	_jobHead(NULL),
+	_jobTail(NULL),
+	_threadCount(threadCount),
+	_threadsAlive(0),
+	_state(STATE_NEW),
+	_memoryBudget(memoryBudget),
+	_memoryInUse(0),
+	_bootstrapJarsScheduled(false),
+	_applicationJarsScheduled(false),
+	_preparsedCount(0),
+	_hitCount(0),
+	_mismatchCount(0)
+{
+	if (0 == omrthread_monitor_init_with_name(&_monitor, 0, "ROMClass preparser")) {
+		_table = hashTableNew(OMRPORT_FROM_J9PORT(_portLibrary), J9_GET_CALLSITE(),
+				INITIAL_PREPARSE_TABLE_SIZE, sizeof(J9PreparsedClassFile *), sizeof(J9PreparsedClassFile *), 0,
+				J9MEM_CATEGORY_CLASSES, preparsedClassHashFn, preparsedClassHashEqualFn, NULL, NULL);
+	}
+}
+
+ROMClassPreparser *
+ROMClassPreparser::newInstance(J9JavaVM *javaVM, UDATA threadCount, UDATA memoryBudget)
+{
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+	ROMClassPreparser *preparser = (ROMClassPreparser *)j9mem_allocate_memory(sizeof(ROMClassPreparser), J9MEM_CATEGORY_CLASSES);
+	if (NULL != preparser) {
+		new(preparser) ROMClassPreparser(javaVM, threadCount, memoryBudget);
+		if (!preparser->isOK()) {
+			preparser->kill();
+			preparser = NULL;
+		}
+	}
+	return preparser;
+}
+
+void
+ROMClassPreparser::kill()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_enter(_monitor);
+		_state = STATE_DYING;
+		omrthread_monitor_notify_all(_monitor);
+		while (0 != _threadsAlive) {
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	Trc_BCU_ROMClassPreparser_shutdown(_preparsedCount, _hitCount, _mismatchCount);
+
+	while (NULL != _jobHead) {
+		J9PreparseJob *job = _jobHead;
+		_jobHead = job->next;
+		j9mem_free_memory(job);
+	}
+	_jobTail = NULL;
+
+	if (NULL != _table) {
+		J9HashTableState walkState;
+		J9PreparsedClassFile **entry = (J9PreparsedClassFile **)hashTableStartDo(_table, &walkState);
+		while (NULL != entry) {
+			freePreparsedClassFile(*entry);
+			entry = (J9PreparsedClassFile **)hashTableNextDo(&walkState);
+		}
+		hashTableFree(_table);
+		_table = NULL;
+	}
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	j9mem_free_memory(this);
+}
+
+J9PreparsedClassFile *
+ROMClassPreparser::takePreparsedClassFile(ROMClassCreationContext *context, VerifyClassFunction verifyClassFunction)
+{
+	J9PreparsedClassFile *preparsed = NULL;
+
+	/* Only plain named class definitions are ever preparsed. */
+	if ((NULL == context->className())
+		|| context->isClassAnon()
+		|| context->isClassHidden()
+		|| context->isRedefining()
+		|| context->isRetransforming()
+		|| context->classFileBytesReplaced()
+		|| context->isCreatingIntermediateROMClass()
+	) {
+		return NULL;
+	}
+
+	scheduleJars(context, verifyClassFunction);
+
+	J9PreparsedClassFile query;
+	J9PreparsedClassFile *queryPtr = &query;
+	query.className = context->className();
+	query.classNameLength = context->classNameLength();
+
+	omrthread_monitor_enter(_monitor);
+	J9PreparsedClassFile **found = (J9PreparsedClassFile **)hashTableFind(_table, &queryPtr);
+	if (NULL != found) {
+		preparsed = *found;
+		hashTableRemove(_table, &queryPtr);
+		_memoryInUse -= preparsed->memorySize;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	if (NULL != preparsed) {
+		bool matches = true;
+		/* The loader may have found a different class file for this name, or may be using different flags. */
+		if ((preparsed->classFileSize != context->classFileSize())
+			|| (preparsed->bctFlags != context->bctFlags())
+			|| (preparsed->findClassFlags != context->findClassFlags())
+			|| (0 != memcmp(preparsed->classFileBytes, context->classFileBytes(), preparsed->classFileSize))
+		) {
+			Trc_BCU_ROMClassPreparser_mismatch((U_32)context->classNameLength(), context->className());
+			freePreparsedClassFile(preparsed);
+			preparsed = NULL;
+			matches = false;
+		} else {
+			Trc_BCU_ROMClassPreparser_hit((U_32)context->classNameLength(), context->className());
+		}
+
+		omrthread_monitor_enter(_monitor);
+		if (matches) {
+			_hitCount += 1;
+		} else {
+			_mismatchCount += 1;
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	return preparsed;
+}
+
+void
+ROMClassPreparser::freePreparsedClassFile(J9PreparsedClassFile *preparsed)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	if (NULL != preparsed) {
+		j9mem_free_memory(preparsed->classFile);
+		j9mem_free_memory(preparsed);
+	}
+}
+
+void
+ROMClassPreparser::scheduleJars(ROMClassCreationContext *context, VerifyClassFunction verifyClassFunction)
+{
+	J9ClassLoader *classLoader = context->classLoader();
+
+	if (NULL == classLoader) {
+		return;
+	}
+	if (classLoader == _javaVM->systemClassLoader) {
+		if (!_bootstrapJarsScheduled) {
+			omrthread_monitor_enter(_monitor);
+			if (!_bootstrapJarsScheduled) {
+				_bootstrapJarsScheduled = true;
+				_verifyClassFunction = verifyClassFunction;
+				scheduleBootstrapJars(context->bctFlags(), context->findClassFlags());
+			}
+			omrthread_monitor_exit(_monitor);
+		}
+	} else if (classLoader == _javaVM->applicationClassLoader) {
+		if (!_applicationJarsScheduled) {
+			omrthread_monitor_enter(_monitor);
+			if (!_applicationJarsScheduled) {
+				_applicationJarsScheduled = true;
+				_verifyClassFunction = verifyClassFunction;
+				scheduleApplicationJars(context->bctFlags(), context->findClassFlags());
+			}
+			omrthread_monitor_exit(_monitor);
+		}
+	}
+}
+
+/*
+ * Must be called with _monitor held.
+ */
+void
+ROMClassPreparser::scheduleBootstrapJars(UDATA bctFlags, UDATA findClassFlags)
+{
+	J9ClassLoader *classLoader = _javaVM->systemClassLoader;
+
+	omrthread_rwmutex_enter_read(classLoader->cpEntriesMutex);
+	for (UDATA i = 0; i < classLoader->classPathEntryCount; i++) {
+		J9ClassPathEntry *cpEntry = classLoader->classPathEntries[i];
+		if (CPE_TYPE_JAR == cpEntry->type) {
+			scheduleJob((const char *)cpEntry->path, cpEntry->pathLength, bctFlags, findClassFlags);
+		}
+	}
+	omrthread_rwmutex_exit_read(classLoader->cpEntriesMutex);
+}
+
+/*
+ * Must be called with _monitor held.
+ */
+void
+ROMClassPreparser::scheduleApplicationJars(UDATA bctFlags, UDATA findClassFlags)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	J9VMSystemProperty *property = NULL;
+
+	if (J9SYSPROP_ERROR_NONE == _javaVM->internalVMFunctions->getSystemProperty(_javaVM, "java.class.path", &property)) {
+		const char separator = (char)j9sysinfo_get_classpathSeparator();
+		const char *cursor = property->value;
+		while ((NULL != cursor) && ('\0' != *cursor)) {
+			const char *end = strchr(cursor, separator);
+			UDATA length = (NULL == end) ? strlen(cursor) : (UDATA)(end - cursor);
+			/* Directories are left to the loader; only archives are walked. */
+			if ((length > LITERAL_STRLEN(".jar"))
+				&& (0 == memcmp(cursor + length - LITERAL_STRLEN(".jar"), ".jar", LITERAL_STRLEN(".jar")))
+			) {
+				scheduleJob(cursor, length, bctFlags, findClassFlags);
+			}
+			cursor = (NULL == end) ? NULL : end + 1;
+		}
+	}
+}
+
+/*
+ * Must be called with _monitor held.
+ */
+void
+ROMClassPreparser::scheduleJob(const char *path, UDATA pathLength, UDATA bctFlags, UDATA findClassFlags)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if ((STATE_DYING == _state) || !startThreads()) {
+		return;
+	}
+
+	J9PreparseJob *job = (J9PreparseJob *)j9mem_allocate_memory(sizeof(J9PreparseJob) + pathLength, J9MEM_CATEGORY_CLASSES);
+	if (NULL != job) {
+		job->next = NULL;
+		job->bctFlags = bctFlags;
+		job->findClassFlags = findClassFlags;
+		memcpy(job->path, path, pathLength);
+		job->path[pathLength] = '\0';
+		if (NULL == _jobTail) {
+			_jobHead = job;
+		} else {
+			_jobTail->next = job;
+		}
+		_jobTail = job;
+		Trc_BCU_ROMClassPreparser_jobScheduled(job->path, bctFlags, findClassFlags);
+		omrthread_monitor_notify_all(_monitor);
+	}
+}
+
+/*
+ * Must be called with _monitor held.
+ */
+bool
+ROMClassPreparser::startThreads()
+{
+	if (STATE_NEW == _state) {
+		_state = STATE_ALIVE;
+		for (UDATA i = 0; i < _threadCount; i++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, _javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, preparseThreadProc, this)) {
+				break;
+			}
+			_threadsAlive += 1;
+		}
+		Trc_BCU_ROMClassPreparser_started(_threadsAlive, _memoryBudget);
+	}
+	return 0 != _threadsAlive;
+}
+
+void
+ROMClassPreparser::run()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	omrthread_monitor_enter(_monitor);
+	for (;;) {
+		while ((NULL == _jobHead) && (STATE_ALIVE == _state)) {
+			omrthread_monitor_wait(_monitor);
+		}
+		if (STATE_ALIVE != _state) {
+			break;
+		}
+
+		J9PreparseJob *job = _jobHead;
+		_jobHead = job->next;
+		if (NULL == _jobHead) {
+			_jobTail = NULL;
+		}
+		omrthread_monitor_exit(_monitor);
+
+		preparse(job);
+		j9mem_free_memory(job);
+
+		omrthread_monitor_enter(_monitor);
+	}
+
+	_threadsAlive -= 1;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+ROMClassPreparser::preparse(J9PreparseJob *job)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	VMI_ACCESS_FROM_JAVAVM((JavaVM *)_javaVM);
+	VMIZipFunctionTable *zipFunctions = (*VMI)->GetZipFunctions(VMI);
+	VMIZipFile zipFile;
+	VMIZipEntry entry;
+	IDATA nextEntryPointer = 0;
+	U_8 *classFileBytes = NULL;
+	UDATA classFileBufferSize = 0;
+
+	/* Open privately, without the shared zip cache, so that no load hooks are triggered from this thread. */
+	if (0 != zipFunctions->zip_openZipFile(VMI, job->path, &zipFile, ZIP_FLAG_MAP_FILE)) {
+		return;
+	}
+
+	zipFunctions->zip_resetZipFile(VMI, &zipFile, &nextEntryPointer);
+	for (;;) {
+		if (STATE_ALIVE != _state) {
+			break;
+		}
+
+		zipFunctions->zip_initZipEntry(VMI, &entry);
+		/* Record where each entry's data starts, otherwise zip_getZipEntryData() reads from the start of the file. */
+		if (0 != zipFunctions->zip_getNextZipEntry(VMI, &zipFile, &entry, &nextEntryPointer, ZIP_FLAG_READ_DATA_POINTER)) {
+			zipFunctions->zip_freeZipEntry(VMI, &entry);
+			break;
+		}
+
+		UDATA nameLength = entry.filenameLength;
+		U_8 *name = entry.filename;
+		if ((nameLength > LITERAL_STRLEN(".class"))
+			&& (0 == memcmp(name + nameLength - LITERAL_STRLEN(".class"), ".class", LITERAL_STRLEN(".class")))
+			&& ((nameLength < LITERAL_STRLEN("META-INF/")) || (0 != memcmp(name, "META-INF/", LITERAL_STRLEN("META-INF/"))))
+			&& (0 != entry.uncompressedSize)
+		) {
+			nameLength -= LITERAL_STRLEN(".class");
+			if (entry.uncompressedSize > classFileBufferSize) {
+				j9mem_free_memory(classFileBytes);
+				classFileBufferSize = entry.uncompressedSize;
+				classFileBytes = (U_8 *)j9mem_allocate_memory(classFileBufferSize, J9MEM_CATEGORY_CLASSES);
+				if (NULL == classFileBytes) {
+					classFileBufferSize = 0;
+					zipFunctions->zip_freeZipEntry(VMI, &entry);
+					break;
+				}
+			}
+			if (0 == zipFunctions->zip_getZipEntryData(VMI, &zipFile, &entry, classFileBytes, entry.uncompressedSize)) {
+				J9PreparsedClassFile *preparsed = parseClassFile(name, nameLength, classFileBytes, entry.uncompressedSize, job->bctFlags, job->findClassFlags);
+				if ((NULL != preparsed) && !storePreparsedClassFile(preparsed)) {
+					/* The budget is used up; the rest of this jar is left to the defining threads. */
+					zipFunctions->zip_freeZipEntry(VMI, &entry);
+					break;
+				}
+			}
+		}
+		zipFunctions->zip_freeZipEntry(VMI, &entry);
+	}
+
+	j9mem_free_memory(classFileBytes);
+	zipFunctions->zip_closeZipFile(VMI, &zipFile);
+}
+
+J9PreparsedClassFile *
+ROMClassPreparser::parseClassFile(U_8 *className, UDATA classNameLength, U_8 *classFileBytes, UDATA classFileSize, UDATA bctFlags, UDATA findClassFlags)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	UDATA entrySize = sizeof(J9PreparsedClassFile) + classFileSize + classNameLength;
+	J9PreparsedClassFile *preparsed = (J9PreparsedClassFile *)j9mem_allocate_memory(entrySize, J9MEM_CATEGORY_CLASSES);
+
+	if (NULL == preparsed) {
+		return NULL;
+	}
+	/* The parsed class file refers to the bytes it was read from, so keep a private copy with it. */
+	preparsed->classFileBytes = (U_8 *)(preparsed + 1);
+	preparsed->classFileSize = classFileSize;
+	preparsed->className = preparsed->classFileBytes + classFileSize;
+	preparsed->classNameLength = classNameLength;
+	preparsed->bctFlags = bctFlags;
+	preparsed->findClassFlags = findClassFlags;
+	preparsed->classFile = NULL;
+	memcpy(preparsed->classFileBytes, classFileBytes, classFileSize);
+	memcpy(preparsed->className, className, classNameLength);
+
+	UDATA bufferSize = INITIAL_PREPARSE_BUFFER_SIZE;
+	I_32 result = BCT_ERR_OUT_OF_ROM;
+	U_8 *buffer = NULL;
+	while (BCT_ERR_OUT_OF_ROM == result) {
+		buffer = (U_8 *)j9mem_allocate_memory(bufferSize, J9MEM_CATEGORY_CLASSES);
+		if (NULL == buffer) {
+			break;
+		}
+		result = j9bcutil_readClassFileBytes(
+				_portLibrary,
+				_verifyClassFunction,
+				preparsed->classFileBytes, classFileSize,
+				buffer, bufferSize,
+				(U_32)bctFlags,
+				NULL,
+				NULL,
+				findClassFlags, _javaVM->romMethodSortThreshold);
+		if (BCT_ERR_NO_ERROR != result) {
+			j9mem_free_memory(buffer);
+			buffer = NULL;
+			UDATA newBufferSize = bufferSize * 2;
+			/* Check for overflow. */
+			if (newBufferSize <= bufferSize) {
+				break;
+			}
+			bufferSize = newBufferSize;
+		}
+	}
+
+	if (NULL == buffer) {
+		/* Errors are reported by the defining thread when it parses the class itself. */
+		j9mem_free_memory(preparsed);
+		return NULL;
+	}
+
+	preparsed->classFile = (J9CfrClassFile *)buffer;
+	preparsed->memorySize = entrySize + bufferSize;
+	return preparsed;
+}
+
+/*
+ * Stores the preparsed class in the table, or frees it if it is not needed.
+ * Returns false if it did not fit in the memory budget. The reservation is not
+ * waited for: classes that are never defined keep their share of the budget until
+ * shutdown, so a preparser thread blocked here might never be woken up.
+ */
+bool
+ROMClassPreparser::storePreparsedClassFile(J9PreparsedClassFile *preparsed)
+{
+	bool fits = true;
+
+	omrthread_monitor_enter(_monitor);
+	if ((0 != _memoryInUse) && ((_memoryInUse + preparsed->memorySize) > _memoryBudget)) {
+		fits = false;
+	} else if ((STATE_ALIVE == _state) && (NULL == hashTableFind(_table, &preparsed))) {
+		/* The first jar to provide a class wins; the defining thread checks the bytes anyway. */
+		if (NULL != hashTableAdd(_table, &preparsed)) {
+			_memoryInUse += preparsed->memorySize;
+			_preparsedCount += 1;
+			preparsed = NULL;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	freePreparsedClassFile(preparsed);
+	return fits;
+}
+
+extern "C" void
+initializeROMClassPreparser(J9JavaVM *vm, UDATA threadCount, UDATA memoryBudget)
+{
+	if (0 != threadCount) {
+		vm->dynamicLoadBuffers->romClassPreparser = ROMClassPreparser::newInstance(vm, threadCount, memoryBudget);
+	}
+}
+
+extern "C" void
+shutdownROMClassPreparser(J9JavaVM *vm)
+{
+	ROMClassPreparser *romClassPreparser = (ROMClassPreparser *)vm->dynamicLoadBuffers->romClassPreparser;
+	if (NULL != romClassPreparser) {
+		vm->dynamicLoadBuffers->romClassPreparser = NULL;
+		romClassPreparser->kill();
+	}
+}
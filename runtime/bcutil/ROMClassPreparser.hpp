@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * ROMClassPreparser.hpp
+ */
+
+#ifndef ROMCLASSPREPARSER_HPP_
+#define ROMCLASSPREPARSER_HPP_
+
+/* @ddr_namespace: default */
+#include "j9comp.h"
+#include "j9.h"
+
+#include "ClassFileParser.hpp"  /* included to obtain definition of VerifyClassFunction */
+
+class ROMClassCreationContext;
+
+/*
+ * A class file that was read from a jar and run through j9bcutil_readClassFileBytes()
+ * by a preparser thread. The class name and class file bytes are stored immediately
+ * after the structure; the parsed J9CfrClassFile refers back into those bytes.
+ */
+typedef struct J9PreparsedClassFile {
+	U_8 *className;
+	UDATA classNameLength;
+	U_8 *classFileBytes;
+	UDATA classFileSize;
+	J9CfrClassFile *classFile;
+	UDATA bctFlags;
+	UDATA findClassFlags;
+	UDATA memorySize;
+} J9PreparsedClassFile;
+
+/*
+ * A jar waiting to be walked by a preparser thread, together with the translation
+ * flags captured from the first class defined by the loader that owns it.
+ */
+typedef struct J9PreparseJob {
+	struct J9PreparseJob *next;
+	UDATA bctFlags;
+	UDATA findClassFlags;
+	char path[1];
+} J9PreparseJob;
+
+/*
+ * Reads and parses the classes of known jars on background threads, ahead of the
+ * loaders asking for them. A defining thread whose class file bytes and translation
+ * flags match a preparsed entry skips parsing and structure verification and goes
+ * straight to laydown; anything that does not match is parsed as usual.
+ *
+ * Jars are scheduled lazily: the bootstrap class path jars on the first class defined
+ * by the bootstrap loader, and the java.class.path jars on the first class defined by
+ * the application loader, so that each set is parsed with the flags its loader uses.
+ */
+class ROMClassPreparser
+{
+public:
+	static ROMClassPreparser *newInstance(J9JavaVM *javaVM, UDATA threadCount, UDATA memoryBudget);
+
+	void kill();
+
+	J9PreparsedClassFile *takePreparsedClassFile(ROMClassCreationContext *context, VerifyClassFunction verifyClassFunction);
+
+	void freePreparsedClassFile(J9PreparsedClassFile *preparsed);
+
+	void run();
+
+private:
+	enum State {
+		STATE_NEW = 0,
+		STATE_ALIVE,
+		STATE_DYING
+	};
+
+	ROMClassPreparser(J9JavaVM *javaVM, UDATA threadCount, UDATA memoryBudget);
+
+	bool isOK() const { return (NULL != _monitor) && (NULL != _table); }
+
+	void scheduleJars(ROMClassCreationContext *context, VerifyClassFunction verifyClassFunction);
+	void scheduleBootstrapJars(UDATA bctFlags, UDATA findClassFlags);
+	void scheduleApplicationJars(UDATA bctFlags, UDATA findClassFlags);
+	void scheduleJob(const char *path, UDATA pathLength, UDATA bctFlags, UDATA findClassFlags);
+	bool startThreads();
+	void preparse(J9PreparseJob *job);
+
+	J9PreparsedClassFile *parseClassFile(U_8 *className, UDATA classNameLength, U_8 *classFileBytes, UDATA classFileSize, UDATA bctFlags, UDATA findClassFlags);
+	bool storePreparsedClassFile(J9PreparsedClassFile *preparsed);
+
+	J9JavaVM *_javaVM;
+	J9PortLibrary *_portLibrary;
+	VerifyClassFunction _verifyClassFunction;
+	omrthread_monitor_t _monitor;
+	J9HashTable *_table;
+	J9PreparseJob *_jobHead;
+	J9PreparseJob *_jobTail;
+	UDATA _threadCount;
+	UDATA _threadsAlive;
+	volatile UDATA _state;
+	UDATA _memoryBudget;
+	UDATA _memoryInUse;
+	volatile bool _bootstrapJarsScheduled;
+	volatile bool _applicationJarsScheduled;
+	UDATA _preparsedCount;
+	UDATA _hitCount;
+	UDATA _mismatchCount;
+};
+
+#endif /* ROMCLASSPREPARSER_HPP_ */
@@ -44,6 +44,9 @@
 
 #define THIS_DLL_NAME J9_DYNLOAD_DLL_NAME
 
+/* Default bound on the preparsed class files held for the loaders at any one time */
+#define ROMCLASS_PREPARSE_MEMORY_DEFAULT (64 * 1024 * 1024)
+
 static IDATA initializeTranslationBuffers (J9PortLibrary * portLib, J9TranslationBufferSet * translationBuffers);
 
 /*
@@ -159,6 +162,23 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				returnVal = J9VMDLLMAIN_FAILED;
 			}
 			vm->mapMemoryBuffer = vm->mapMemoryResultsBuffer + MAP_MEMORY_RESULTS_BUFFER_SIZE;
+
+			{
+				IDATA argIndex = -1;
+				UDATA preparseThreads = 0;
+				UDATA preparseMemory = ROMCLASS_PREPARSE_MEMORY_DEFAULT;
+
+				if ((argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXROMCLASSPREPARSETHREADS_EQUALS, NULL)) >= 0) {
+					char *optname = VMOPT_XXROMCLASSPREPARSETHREADS_EQUALS;
+					GET_INTEGER_VALUE(argIndex, optname, preparseThreads);
+				}
+				if ((argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXROMCLASSPREPARSEMEMORY_EQUALS, NULL)) >= 0) {
+					char *optname = VMOPT_XXROMCLASSPREPARSEMEMORY_EQUALS;
+					GET_MEMORY_VALUE(argIndex, optname, preparseMemory);
+				}
+				/* Preparsing is opt-in; a failure to set it up only costs the speedup. */
+				initializeROMClassPreparser(vm, preparseThreads, preparseMemory);
+			}
 			break;
 
 		case AGENTS_STARTED :
@@ -170,6 +190,7 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 		case LIBRARIES_ONUNLOAD :
 			loadInfo = FIND_DLL_TABLE_ENTRY( THIS_DLL_NAME );
 			if (IS_STAGE_COMPLETED(loadInfo->completedBits, BUFFERS_ALLOC_STAGE) && vm->dynamicLoadBuffers) {
+				shutdownROMClassPreparser(vm);
 				shutdownROMClassBuilder(vm);
 				j9bcutil_freeAllTranslationBuffers(vm->portLibrary, vm->dynamicLoadBuffers);
 				vm->dynamicLoadBuffers = 0;
@@ -537,6 +537,13 @@ jitDecompileMethod(J9VMThread * currentThread, J9JITDecompilationInfo * decompRe
 	UDATA numberOfFrames = osrBuffer->numberOfFrames;
 	J9OSRFrame *osrFrame = (J9OSRFrame*)(osrBuffer + 1);
 
+#if defined(J9VM_OPT_JFR)
+	/* Record the event while the JIT frame is still on the stack */
+	if (currentThread->javaVM->jfrState.isStarted) {
+		currentThread->javaVM->internalVMFunctions->jfrDeoptimization(currentThread, osrFrame->method, osrFrame->bytecodePCOffset, decompRecord->reason);
+	}
+#endif /* defined(J9VM_OPT_JFR) */
+
 	/* Collect the required information from the stack - top visible frame is the decompile frame */
 	walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_MAINTAIN_REGISTER_MAP | J9_STACKWALK_ITERATE_HIDDEN_JIT_FRAMES | J9_STACKWALK_SAVE_STACKED_REGISTERS;
 	walkState.skipCount = 0;
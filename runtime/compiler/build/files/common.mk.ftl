@@ -416,6 +416,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/CommunicationStream.cpp \
     compiler/net/LoadSSLLibs.cpp \
     compiler/net/MessageBuffer.cpp \
+    compiler/net/MessageCompression.cpp \
     compiler/net/Message.cpp \
     compiler/net/MessageTypes.cpp \
     compiler/net/ServerStream.cpp \
@@ -4530,6 +4530,10 @@ uint8_t *J9::CodeGenerator::allocateCodeMemoryInner(uint32_t warmCodeSizeInBytes
     TR_ASSERT_FATAL(!((warmCodeSizeInBytes && !warmCode) || (coldCodeSizeInBytes && !coldCode)),
         "Allocation failed but didn't throw an exception");
 
+    // Count the same bodies getDesignatedCodeCache steers to the hot code cache
+    if (TR::CodeCacheManager::isHotCodeCompilation(comp))
+        codeCache->addHotCodeBytes(warmCodeSizeInBytes);
+
     return warmCode;
 }
 
@@ -64,6 +64,7 @@ class CompilationInfoPerThreadBase;
 class TR_FilterBST;
 class TR_FrontEnd;
 class TR_HWProfiler;
+class TR_J9SharedCache;
 class TR_J9VMBase;
 class TR_LowPriorityCompQueue;
 class TR_OptimizationPlan;
@@ -89,6 +90,7 @@ class ClientSessionHT;
 class JITServerAOTCacheMap;
 class JITServerAOTDeserializer;
 class JITServerSharedROMClassCache;
+using JITServerPrefetchHints_t = PersistentUnorderedMap<J9Method *, PersistentVector<std::pair<int32_t, int32_t> > >;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 namespace TR {
@@ -147,6 +149,15 @@ public:
     void invalidateRequestsForUnloadedMethods(J9Class *unloadedClass);
     void purgeLPQ();
 
+    // The following refer to the mechanism that loads AOT bodies of initialized
+    // classes from the LPQ during startup, ahead of their invocation counts expiring
+    bool hasBulkAOTLoadClasses() const { return _numBulkAOTLoadClasses > 0; }
+
+    void addBulkAOTLoadClass(J9Class *clazz); // Executed by app threads when a class gets initialized
+    int32_t scheduleBulkAOTLoads(J9VMThread *vmThread, TR_J9SharedCache *sharedCache, int32_t maxRequests,
+        int32_t maxClasses); // Executed by the sampler thread
+    void purgeBulkAOTLoadClasses();
+
     // The following refer to the mechanism that schedules low priority
     // compilation requests based on the Iprofiler
     static uint32_t hash(J9Method *j9method) { return ((uintptr_t)j9method >> 3) & (HT_SIZE - 1); }
@@ -212,6 +223,13 @@ private:
     // stats written by application threads
     uint32_t _STAT_compReqQueuedByInterpreter;
     uint32_t _STAT_numFailedToEnqueueInLPQ;
+    // stats written by sampler thread
+    uint32_t _STAT_compReqQueuedByBulkAOTLoad;
+    uint32_t _STAT_LPQcompBulkAOTLoad;
+    // Initialized classes whose methods may have AOT bodies waiting to be loaded
+    J9Class **_bulkAOTLoadClasses;
+    int32_t _numBulkAOTLoadClasses;
+    int32_t _maxBulkAOTLoadClasses;
 }; // TR_LowPriorityCompQueue
 
 // Definition of compilation queue to hold JProfiling candidates
@@ -785,6 +803,14 @@ public:
     TR_MethodToBeCompiled *addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *stream);
 #endif /* defined(J9VM_OPT_JITSERVER) */
     void queueEntry(TR_MethodToBeCompiled *entry);
+    void unlinkQueuedEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry);
+
+    // A false answer proves that the method has no request in the compilation queue;
+    // a true answer means the queue must be searched
+    bool mayHaveQueuedRequest(J9Method *method) const { return _queuedMethodCounts[queuedMethodBucket(method)] != 0; }
+
+    void recordQueueWaitTime(TR_MethodToBeCompiled *entry);
+    void printCompQueueHistograms();
     void recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
     void requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
@@ -1154,6 +1180,17 @@ public:
 
     double getJvmCpuEntitlement() const { return _cpuEntitlement.getJvmCpuEntitlement(); }
 
+    TR_CgroupCpuQuota *getCgroupCpuQuota() { return &_cgroupCpuQuota; }
+
+    // 0 means that the number of active compilation threads is not limited by the container CPU quota
+    int32_t getMaxCompThreadsForCpuQuota() const { return _maxCompThreadsForCpuQuota; }
+
+    void setMaxCompThreadsForCpuQuota(int32_t n) { _maxCompThreadsForCpuQuota = n; }
+
+    bool isCpuQuotaThrottled() const { return _cpuQuotaThrottled; }
+
+    void setCpuQuotaThrottled(bool b) { _cpuQuotaThrottled = b; }
+
     bool importantMethodForStartup(J9Method *method);
     bool shouldDowngradeCompReq(TR_MethodToBeCompiled *entry);
 
@@ -1412,6 +1449,17 @@ public:
 
     PersistentUnorderedSet<J9Class *> &getclassesCachedAtServer() { return _classesCachedAtServer; }
 
+    // Resolved callees, as (TR_ResolvedMethodType, cpIndex) pairs, that the server asked for in one batch
+    // when it last compiled a method. Answered up front in the next compilation request for that method.
+    // Guarded by the classesCachedAtServer monitor.
+    JITServerPrefetchHints_t &getJITServerPrefetchHints() { return _jitServerPrefetchHints; }
+
+    void removeJITServerPrefetchHints(J9Class *clazz);
+
+    uint32_t getNumJITServerPrefetchedCompReqs() const { return _numJITServerPrefetchedCompReqs; }
+
+    void incNumJITServerPrefetchedCompReqs() { _numJITServerPrefetchedCompReqs++; }
+
     void addJITServerSslKey(const std::string &key) { _sslKeys.push_back(key); }
 
     const PersistentVector<std::string> &getJITServerSslCerts() const { return _sslCerts; }
@@ -1549,6 +1597,24 @@ private:
     TR::CompilationInfoPerThread **_arrayOfCompilationInfoPerThread; // First NULL entry means end of the array
     TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
     TR_MethodToBeCompiled *_methodQueue;
+
+    enum {
+        QUEUED_METHOD_COUNT_BUCKETS = 1024, // must be a power of 2
+        QUEUE_HISTOGRAM_BUCKETS = 24 // bucket i counts values in [2^(i-1), 2^i)
+    };
+
+    static uint32_t queuedMethodBucket(J9Method *method)
+    {
+        return (uint32_t)(((uintptr_t)method >> 4) & (QUEUED_METHOD_COUNT_BUCKETS - 1));
+    }
+
+    // Last entry of each async priority in _methodQueue. Sync requests are few and always
+    // sit at the front of the queue, so they are not tracked.
+    TR_MethodToBeCompiled *_methodQueueTails[CP_ASYNC_MAX + 1];
+    // Number of _methodQueue entries whose method falls in each bucket
+    uint32_t _queuedMethodCounts[QUEUED_METHOD_COUNT_BUCKETS];
+    uint32_t _queueDepthHistogram[QUEUE_HISTOGRAM_BUCKETS]; // queue size when a request is queued
+    uint32_t _queueWaitTimeHistogram[QUEUE_HISTOGRAM_BUCKETS]; // usec spent in the queue by compiled requests
     TR_MethodToBeCompiled *_methodPool;
     int32_t _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1687,6 +1753,9 @@ private:
     TR_JProfilingQueue _JProfilingQueue;
 
     TR_CpuEntitlement _cpuEntitlement;
+    TR_CgroupCpuQuota _cgroupCpuQuota;
+    int32_t _maxCompThreadsForCpuQuota; // set by the sampler thread from the container CPU quota; 0 if no limit
+    bool _cpuQuotaThrottled; // the container was throttled during the last sampling interval
     TR_JitSampleInfo _jitSampleInfo;
     TR_SharedCacheRelocationRuntime _sharedCacheReloRuntime;
     uintptr_t _vmStateOfCrashedThread; // Set by Jit Dump; used by diagnostic thread
@@ -1714,6 +1783,8 @@ private:
     ClientSessionHT *_clientSessionHT; // JITServer hashtable that holds session information about JITClients
     PersistentUnorderedSet<J9Class *> _classesCachedAtServer;
     TR::Monitor *_classesCachedAtServerMonitor;
+    JITServerPrefetchHints_t _jitServerPrefetchHints;
+    uint32_t _numJITServerPrefetchedCompReqs; // compilation requests that carried prefetched answers
     PersistentVector<TR_OpaqueClassBlock *> *_unloadedClassesTempList; // JITServer list of classes unloaded
     PersistentVector<TR_OpaqueClassBlock *>
         *_illegalFinalFieldModificationList; // JITServer list of classes that have
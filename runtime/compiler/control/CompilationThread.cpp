@@ -382,12 +382,58 @@ static int deflateBuffer(const U_8 *buffer, int numberOfBytes, U_8 *outBuffer, i
 #pragma convlit(resume)
 #endif
 #endif
+// Index of the histogram bucket holding values in [2^(i-1), 2^i); the last bucket is open ended
+static inline int32_t log2HistogramBucket(uint64_t value, int32_t numBuckets)
+{
+    int32_t bucket = 0;
+    while (value && bucket < numBuckets - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
 inline void TR::CompilationInfo::incrementMethodQueueSize()
 {
     _numQueuedMethods++;
     // Keep track of maxQueueSize for information purposes
     if (_numQueuedMethods > _maxQueueSize)
         _maxQueueSize = _numQueuedMethods;
+    _queueDepthHistogram[log2HistogramBucket(_numQueuedMethods, QUEUE_HISTOGRAM_BUCKETS)]++;
+}
+
+// Entry times are only taken with -Xjit:verbose={performance}
+void TR::CompilationInfo::recordQueueWaitTime(TR_MethodToBeCompiled *entry)
+{
+    if (!entry->_entryTime)
+        return;
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    uint64_t waitTime = j9time_usec_clock() - entry->_entryTime;
+    _queueWaitTimeHistogram[log2HistogramBucket(waitTime, QUEUE_HISTOGRAM_BUCKETS)]++;
+}
+
+static void printLog2HistogramToVlog(const uint32_t *histogram, int32_t numBuckets, const char *unit)
+{
+    for (int32_t i = 0; i < numBuckets; i++) {
+        if (!histogram[i])
+            continue;
+        uint64_t low = i ? ((uint64_t)1 << (i - 1)) : 0;
+        if (i == numBuckets - 1)
+            TR_VerboseLog::writeLine(TR_Vlog_PERF, "\t>= %llu%s: %u", (unsigned long long)low, unit, histogram[i]);
+        else
+            TR_VerboseLog::writeLine(TR_Vlog_PERF, "\t[%llu, %llu)%s: %u", (unsigned long long)low,
+                (unsigned long long)1 << i, unit, histogram[i]);
+    }
+}
+
+void TR::CompilationInfo::printCompQueueHistograms()
+{
+    TR_VerboseLog::CriticalSection vlogLock;
+    TR_VerboseLog::writeLine(TR_Vlog_PERF, "Compilation queue size when a request is queued (peak=%d):",
+        getPeakMethodQueueSize());
+    printLog2HistogramToVlog(_queueDepthHistogram, QUEUE_HISTOGRAM_BUCKETS, "");
+    TR_VerboseLog::writeLine(TR_Vlog_PERF, "Time spent in the compilation queue by compiled requests:");
+    printLog2HistogramToVlog(_queueWaitTimeHistogram, QUEUE_HISTOGRAM_BUCKETS, "us");
 }
 
 int32_t TR::CompilationInfo::VERY_SMALL_QUEUE = 2;
@@ -518,6 +564,9 @@ TR_YesNoMaybe TR::CompilationInfo::shouldActivateNewCompThread()
         if ((getNumCompThreadsActive() + 1) * 100 >= (TR::Options::_compThreadCPUEntitlement + 50))
             return TR_no;
     }
+    // Do not activate if the compilation threads would exceed their share of the container CPU quota
+    if (getMaxCompThreadsForCpuQuota() > 0 && getNumCompThreadsActive() >= getMaxCompThreadsForCpuQuota())
+        return TR_no;
     // Do not activate if we are low on physical memory
     bool incompleteInfo;
     uint64_t freePhysicalMemorySizeB = computeAndCacheFreePhysicalMemory(incompleteInfo);
@@ -684,6 +733,10 @@ bool TR::CompilationInfo::shouldDowngradeCompReq(TR_MethodToBeCompiled *entry)
         // Downgrade if the JVM is starved of CPU
         else if (isJVMStarved()) {
             doDowngrade = true;
+        }
+        // Downgrade if the container is being throttled for exceeding its CPU quota
+        else if (isCpuQuotaThrottled()) {
+            doDowngrade = true;
         } else {
             // We may skip downgrading during grace period
             if (TR::Options::getCmdLineOptions()->getOption(TR_DontDowgradeToColdDuringGracePeriod)
@@ -1105,6 +1158,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
     , _metricsSslKeys(decltype(_metricsSslKeys)::allocator_type(TR::Compiler->persistentAllocator()))
     , _metricsSslCerts(decltype(_metricsSslCerts)::allocator_type(TR::Compiler->persistentAllocator()))
     , _classesCachedAtServer(decltype(_classesCachedAtServer)::allocator_type(TR::Compiler->persistentAllocator()))
+    , _jitServerPrefetchHints(decltype(_jitServerPrefetchHints)::allocator_type(TR::Compiler->persistentAllocator()))
     ,
 #endif /* defined(J9VM_OPT_JITSERVER) */
     _persistentMemory(pointer_cast<TR_PersistentMemory *>(jitConfig->scratchSegment))
@@ -1214,6 +1268,7 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
     _newlyExtendedClasses = NULL;
     _sequencingMonitor = TR::Monitor::create("JIT-SequencingMonitor");
     _classesCachedAtServerMonitor = TR::Monitor::create("JIT-ClassesCachedAtServerMonitor");
+    _numJITServerPrefetchedCompReqs = 0;
     _compReqSeqNo = 0;
     _chTableUpdateFlags = 0;
     _localGCCounter = 0;
@@ -1224,7 +1279,24 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
 #endif /* defined(J9VM_OPT_JITSERVER) */
 }
 
-void TR::CompilationInfo::initCPUEntitlement() { _cpuEntitlement.init(_jitConfig); }
+void TR::CompilationInfo::initCPUEntitlement()
+{
+    _cpuEntitlement.init(_jitConfig);
+    _cgroupCpuQuota.init(_jitConfig);
+}
+
+#if defined(J9VM_OPT_JITSERVER)
+// Forget the prefetch hints of all methods of the given class, because the class
+// is being unloaded or redefined and its constant pool indices can no longer be trusted
+void TR::CompilationInfo::removeJITServerPrefetchHints(J9Class *clazz)
+{
+    if (_jitServerPrefetchHints.empty())
+        return;
+    uint32_t numMethods = clazz->romClass->romMethodCount;
+    for (uint32_t i = 0; i < numMethods; ++i)
+        _jitServerPrefetchHints.erase(clazz->ramMethods + i);
+}
+#endif /* defined(J9VM_OPT_JITSERVER) */
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 void TR::CompilationInfo::setNumUsableCompilationThreadsPostRestore(int32_t &numUsableCompThreads)
@@ -1696,8 +1768,14 @@ bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(TR::IlGenerator
     // Determine entry weight
     J9Method *j9method = details.getMethod();
     J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(j9method);
-    compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT
-                                                                       : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
+    if (reason == TR_MethodToBeCompiled::REASON_BULK_AOT_LOAD) {
+        // The body is known to be in the SCC, so this request will be a relocation
+        compReq->_methodIsInSharedCache = TR_yes;
+        compReq->_weight = TR::CompilationInfo::AOT_LOAD_WEIGHT;
+    } else {
+        compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT
+                                                                           : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
+    }
     // add at the end of queue
     enqueueCompReqToLPQ(compReq);
     incStatsReqQueuedToLPQ(reason);
@@ -1963,10 +2041,7 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class *clazz, J9V
             }
 
             // detach from queue
-            if (prev)
-                prev->_next = cur->_next;
-            else
-                _methodQueue = cur->_next;
+            unlinkQueuedEntry(prev, cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
@@ -2063,10 +2138,7 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                     }
                 }
                 // detach from queue
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                unlinkQueuedEntry(prev, cur);
                 updateCompQueueAccountingOnDequeue(cur);
                 // decrease the queue weight
                 decreaseQueueWeightBy(cur->_weight);
@@ -2400,7 +2472,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
 
     while (_methodQueue) {
         TR_MethodToBeCompiled *cur = _methodQueue;
-        _methodQueue = cur->_next;
+        unlinkQueuedEntry(NULL, cur);
         updateCompQueueAccountingOnDequeue(cur);
         // decrease the queue weight
         decreaseQueueWeightBy(cur->_weight);
@@ -2445,6 +2517,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
 
     // delete all entries from the low priority queue
     getLowPriorityCompQueue().purgeLPQ();
+    getLowPriorityCompQueue().purgeBulkAOTLoadClasses();
     // and from JProfiling queue
     getJProfilingCompQueue().purge();
 
@@ -3098,6 +3171,9 @@ void TR::CompilationInfo::stopCompilationThreads()
     J9JavaVM * const vm = _jitConfig->javaVM;
     J9VMThread * const vmThread = vm->internalVMFunctions->currentVMThread(vm);
 
+    if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+        printCompQueueHistograms();
+
     static char *printCompStats = feGetEnv("TR_PrintCompStats");
     if (printCompStats) {
         if (statCompErrors.samples() > 0)
@@ -3842,6 +3918,10 @@ void TR::CompilationInfoPerThread::waitForWork()
     _compInfo.incNumCompThreadsJobless();
     setLastTimeThreadWentToSleep(_compInfo.getPersistentInfo()->getElapsedTime());
     setCompilationThreadState(COMPTHREAD_WAITING);
+    // Let other threads reuse the persistent blocks this thread cached while compiling
+    TR::Compiler->persistentAllocator().flushThreadCache();
+    if (TR_IProfiler::allocator())
+        TR_IProfiler::allocator()->flushThreadCache();
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
     // Notify the thread waiting in the checkpoint hook.
@@ -4384,6 +4464,8 @@ void TR::CompilationInfoPerThread::processEntry(TR_MethodToBeCompiled &entry,
         && compilationThreadIsActive() // We haven't already been signaled to suspend or terminate
         && (compInfo->getRampDownMCT() // force to have only one thread active
             || compInfo->getSuspendThreadDueToLowPhysicalMemory()
+            || (compInfo->getMaxCompThreadsForCpuQuota() > 0
+                && compInfo->getNumCompThreadsActive() > compInfo->getMaxCompThreadsForCpuQuota())
             || (!tryCompilingAgain
                 /*&& compInfoPT->getCompThreadId() != compInfo->getFirstCompThreadID()*/
                 && TR::Options::getCmdLineOptions()->getOption(TR_SuspendEarly)
@@ -4400,11 +4482,15 @@ void TR::CompilationInfoPerThread::processEntry(TR_MethodToBeCompiled &entry,
         setCompilationThreadState(COMPTHREAD_SIGNAL_SUSPEND);
         compInfo->decNumCompThreadsActive();
         if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads)) {
-            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Suspend compThread %d Qweight=%d active=%d %s %s %s",
+            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "t=%6u Suspend compThread %d Qweight=%d active=%d %s %s %s %s",
                 (uint32_t)compInfo->getPersistentInfo()->getElapsedTime(), getCompThreadId(),
                 compInfo->getQueueWeight(), compInfo->getNumCompThreadsActive(),
                 compInfo->getRampDownMCT() ? "RampDownMCT" : "",
                 compInfo->getSuspendThreadDueToLowPhysicalMemory() ? "LowPhysicalMem" : "",
+                (compInfo->getMaxCompThreadsForCpuQuota() > 0
+                    && compInfo->getNumCompThreadsActive() >= compInfo->getMaxCompThreadsForCpuQuota())
+                    ? "CPUQuota"
+                    : "",
 #if defined(J9VM_OPT_JITSERVER)
                 compInfo->getCompThreadActivationPolicy() == JITServer::CompThreadActivationPolicy::SUSPEND
                     ? "ServerLowPhysicalMemOrHighThreadCount"
@@ -4612,7 +4698,15 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         skipSearchingForDuplicates = true;
     }
 
-    if (skipSearchingForDuplicates) {
+    // The per-method queue counts tell us when no request for this method is queued at all;
+    // in that case neither the sync nor the async requests need to be searched
+    bool mayBeQueued = disableSkipSearching || mayHaveQueuedRequest(method);
+    if (!mayBeQueued)
+        skipSearchingForDuplicates = true;
+
+    if (!mayBeQueued) {
+        // cur remains NULL
+    } else if (skipSearchingForDuplicates) {
         // In this case we only have to scan the synchronous requests in the queue
         for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
             // Stop the search when we finished with sync entries
@@ -4651,10 +4745,9 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         if (pc)
             cur->_oldStartPC = pc;
 
-        // If the priority has increased, use the new priority
+        // If the priority has increased, the entry must be moved to its new place in the queue
         //
-        if (cur->_priority < priority)
-            cur->_priority = priority;
+        bool priorityIncreased = cur->_priority < priority;
         // If the optimization level is higher, just upgrade
         // (unless the methods has excessive complexity)
         //
@@ -4670,12 +4763,13 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         }
         // If the position in the queue is still correct, just return
         //
-        if (!prev || prev->_priority >= cur->_priority)
+        if (!priorityIncreased)
             return cur;
 
         // Must re-position in the queue
         //
-        prev->_next = cur->_next; // take it out of the queue
+        unlinkQueuedEntry(prev, cur); // take it out of the queue
+        cur->_priority = priority;
     }
 
     // If method is not yet in the queue prepare the queue entry
@@ -4898,18 +4992,55 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
     entry->_freeTag |= ENTRY_QUEUED;
 
-    if (!_methodQueue || _methodQueue->_priority < entry->_priority) {
+    // The entry goes right after the last entry whose priority is at least as high.
+    // For async requests that entry is the tail of the closest queued priority at or
+    // above ours; otherwise only sync requests can precede the insertion point.
+    int32_t priority = entry->_priority;
+    TR_MethodToBeCompiled *prev = NULL;
+    if (priority <= CP_ASYNC_MAX) {
+        for (int32_t p = priority; p <= CP_ASYNC_MAX && !prev; p++)
+            prev = _methodQueueTails[p];
+    }
+    if (!prev) {
+        for (TR_MethodToBeCompiled *cur = _methodQueue; cur && cur->_priority >= priority; cur = cur->_next)
+            prev = cur;
+    }
+
+    if (prev) {
+        entry->_next = prev->_next;
+        prev->_next = entry;
+    } else {
         entry->_next = _methodQueue;
         _methodQueue = entry;
-    } else {
-        for (TR_MethodToBeCompiled *prev = _methodQueue;; prev = prev->_next) {
-            if (!prev->_next || prev->_next->_priority < entry->_priority) {
-                entry->_next = prev->_next;
-                prev->_next = entry;
-                break;
-            }
-        }
     }
+
+    if (priority <= CP_ASYNC_MAX)
+        _methodQueueTails[priority] = entry;
+    _queuedMethodCounts[queuedMethodBucket(entry->getMethodDetails().getMethod())]++;
+}
+
+//--------------------------- unlinkQueuedEntry ---------------------------
+// Take an entry out of the queue; prev is the entry in front of it, or NULL
+// if the entry is at the head. The priority of a queued entry must not be
+// changed without unlinking it first. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::unlinkQueuedEntry(TR_MethodToBeCompiled *prev, TR_MethodToBeCompiled *entry)
+{
+    TR_ASSERT(prev ? prev->_next == entry : _methodQueue == entry, "prev %p is not in front of entry %p", prev, entry);
+
+    if (prev)
+        prev->_next = entry->_next;
+    else
+        _methodQueue = entry->_next;
+
+    int32_t priority = entry->_priority;
+    if (priority <= CP_ASYNC_MAX && _methodQueueTails[priority] == entry)
+        _methodQueueTails[priority] = (prev && prev->_priority == priority) ? prev : NULL;
+
+    uint32_t &count = _queuedMethodCounts[queuedMethodBucket(entry->getMethodDetails().getMethod())];
+    TR_ASSERT(count > 0, "No queued method counted for entry %p", entry);
+    if (count > 0)
+        count--;
 }
 
 //--------------------------------- requeue ----------------------------------
@@ -4947,6 +5078,9 @@ TR_MethodToBeCompiled *TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
             return NULL; // didn't do anything
     }
 
+    if (!mayHaveQueuedRequest(details.getMethod()))
+        return NULL;
+
     // Search the queue for my method
     TR_MethodToBeCompiled *cur, *prev;
     for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
@@ -4967,10 +5101,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
 
             if (cur->_priority < priority) {
                 // take the method out
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                unlinkQueuedEntry(prev, cur);
                 // put it back at its proper place
                 cur->_priority = priority;
                 queueEntry(cur);
@@ -5012,24 +5143,10 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method *method, void *p
 #ifdef STATS
     fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
+    // take the method out and put it back after the other CP_ASYNC_MAX requests
+    unlinkQueuedEntry(prev, cur);
     cur->_priority = CP_ASYNC_MAX;
-
-    // take the method out
-    prev->_next = cur->_next;
-    // find insertion point
-    if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-    {
-        cur->_next = _methodQueue;
-        _methodQueue = cur;
-        // FIXME: how about the compilation lag
-    } else {
-        for (prev = _methodQueue; prev->_next; prev = prev->_next)
-            if (prev->_next->_priority < CP_ASYNC_MAX) {
-                cur->_next = prev->_next;
-                prev->_next = cur;
-                break;
-            }
-    }
+    queueEntry(cur);
     return i;
 }
 
@@ -5061,14 +5178,9 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method *method)
         if (cur && cur->_priority <= CP_ASYNC_MAX) {
             // Take the method out, increase its priority and insert it at the proper place
             //
+            unlinkQueuedEntry(prev, cur);
             cur->_priority = CP_SYNC_NORMAL;
-            if (prev) {
-                prev->_next = cur->_next;
-                queueEntry(cur);
-            } else // method already at the top of the queue
-            {
-                // Nothing to do
-            }
+            queueEntry(cur);
         } else {
             cur = NULL; // prevent further processing
         }
@@ -5103,6 +5215,9 @@ TR_MethodToBeCompiled *TR::CompilationInfo::requestExistsInCompilationQueue(TR::
             return curCompThreadInfoPT->getMethodBeingCompiled();
     }
 
+    if (!mayHaveQueuedRequest(details.getMethod()))
+        return NULL;
+
     for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
         if (cur->getMethodDetails().sameAs(details, fe))
             return cur;
@@ -5152,7 +5267,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 
         if (_methodQueue) {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            unlinkQueuedEntry(NULL, nextMethodToBeCompiled);
 
             // See explanation at the start of this function of why it is important to ensure this
             TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(),
@@ -5175,7 +5290,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
 #endif
             ) {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                unlinkQueuedEntry(NULL, nextMethodToBeCompiled);
             }
             // Check if we need to throttle
             else if (exceedsCompCpuEntitlement() == TR_yes && !compThreadCameOutOfSleep
@@ -5194,7 +5309,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                 _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
                 nextMethodToBeCompiled = _methodQueue;
-                _methodQueue = _methodQueue->_next;
+                unlinkQueuedEntry(NULL, nextMethodToBeCompiled);
             } else // scan for a cold/warm method
             {
                 TR_MethodToBeCompiled *prev = _methodQueue;
@@ -5204,7 +5319,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                         nextMethodToBeCompiled->_priority >= CP_SYNC_MIN || // sync comp
                         nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                     {
-                        prev->_next = nextMethodToBeCompiled->_next;
+                        unlinkQueuedEntry(prev, nextMethodToBeCompiled);
                         break;
                     }
                 }
@@ -5264,6 +5379,7 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
             if (nextMethodToBeCompiled) // A request has been dequeued
             {
                 updateCompQueueAccountingOnDequeue(nextMethodToBeCompiled);
+                recordQueueWaitTime(nextMethodToBeCompiled);
             }
         }
         // When no request is in the main queue we can look in the low priority queue
@@ -6036,11 +6152,9 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread *vmThread, TR::IlG
                     break;
             }
             if (reqMe && reqMe->_priority < CP_ASYNC_ABOVE_NORMAL) {
+                unlinkQueuedEntry(prevReq, reqMe);
                 reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-                if (prevReq && prevReq->_priority < CP_ASYNC_ABOVE_NORMAL) {
-                    prevReq->_next = reqMe->_next;
-                    queueEntry(reqMe);
-                }
+                queueEntry(reqMe);
             }
         }
     }
@@ -10015,6 +10129,38 @@ bool TR::CompilationInfoPerThreadBase::methodCanBeCompiled(TR_Memory *trMemory,
     return TR::Options::getDebug()->methodCanBeCompiled(trMemory, method, filter);
 }
 
+#if defined(J9VM_OPT_JFR)
+// Report a compilation to JFR as a jdk.Compilation event. The VM drops the event if
+// vmThread does not hold VM access, as can happen on the failure path.
+static void reportJFRCompilation(J9JITConfig *jitConfig, J9VMThread *vmThread, TR::Compilation *compiler,
+    J9Method *method, uintptr_t translationTime, bool succeeded, bool isOSR, TR_MethodMetaData *metaData)
+{
+#if defined(J9VM_OPT_JITSERVER)
+    // On the server the method belongs to the client JVM
+    if (compiler->isOutOfProcessCompilation())
+        return;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+    J9JavaVM *javaVM = jitConfig->javaVM;
+    if (!javaVM->internalVMFunctions->isJFRRecordingStarted(javaVM))
+        return;
+
+    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
+    int64_t startTicks = j9time_nano_time() - (int64_t)translationTime * 1000;
+    uintptr_t codeSize = 0;
+    if (metaData) {
+        codeSize = metaData->endWarmPC - metaData->startPC;
+        if (metaData->startColdPC)
+            codeSize += metaData->endPC - metaData->startColdPC;
+    }
+    uintptr_t inlinedBytes = 0;
+    for (uint32_t i = 0; i < compiler->getNumInlinedCallSites(); i++)
+        inlinedBytes += compiler->getInlinedResolvedMethod(i)->maxBytecodeIndex();
+
+    javaVM->internalVMFunctions->jfrCompilation(vmThread, method, startTicks, (UDATA)compiler->getMethodHotness(),
+        succeeded, isOSR, codeSize, inlinedBytes);
+}
+#endif /* defined(J9VM_OPT_JFR) */
+
 void TR::CompilationInfoPerThreadBase::logCompilationSuccess(J9VMThread *vmThread, TR_J9VMBase &vm, J9Method *method,
     TR::SegmentAllocator const &scratchSegmentProvider, TR_ResolvedMethod *compilee, TR::Compilation *compiler,
     TR_MethodMetaData *metaData, TR_OptimizationPlan *optimizationPlan)
@@ -10066,6 +10212,10 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(J9VMThread *vmThrea
             TR::CompilationInfoPerThread *cipt = (TR::CompilationInfoPerThread *)this;
             cipt->setLastCompilationDuration(translationTime / 1000);
         }
+#if defined(J9VM_OPT_JFR)
+        reportJFRCompilation(_jitConfig, vmThread, compiler, method, translationTime, true,
+            _methodBeingCompiled->isDLTCompile(), metaData);
+#endif /* defined(J9VM_OPT_JFR) */
 
         uintptr_t gcDataBytes = _jitConfig->lastGCDataAllocSize;
         uintptr_t atlasBytes = _jitConfig->lastExceptionTableAllocSize;
@@ -10720,6 +10870,13 @@ void TR::CompilationInfoPerThreadBase::processExceptionCommonTasks(J9VMThread *v
     } else {
         Trc_JIT_compilationFailed(vmThread, compiler->signature(), -1);
     }
+
+#if defined(J9VM_OPT_JFR)
+    // AOT loads are not reported as compilations
+    if (!entry->isAotLoad())
+        reportJFRCompilation(_jitConfig, vmThread, compiler, entry->getMethodDetails().getMethod(),
+            j9time_usec_clock() - getTimeWhenCompStarted(), false, entry->isDLTCompile(), NULL);
+#endif /* defined(J9VM_OPT_JFR) */
 }
 
 void TR::CompilationInfo::printCompQueue()
@@ -11211,12 +11368,18 @@ TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
 #endif /* defined(J9VM_OPT_JITSERVER) */
     _STAT_compReqQueuedByInterpreter(0)
     , _STAT_numFailedToEnqueueInLPQ(0)
+    , _STAT_compReqQueuedByBulkAOTLoad(0)
+    , _STAT_LPQcompBulkAOTLoad(0)
+    , _bulkAOTLoadClasses(NULL)
+    , _numBulkAOTLoadClasses(0)
+    , _maxBulkAOTLoadClasses(0)
 {}
 
 TR_LowPriorityCompQueue::~TR_LowPriorityCompQueue()
 {
     if (_spine)
         jitPersistentFree(_spine);
+    purgeBulkAOTLoadClasses();
 }
 
 void TR_LowPriorityCompQueue::startTrackingIProfiledCalls(int32_t threshold)
@@ -11446,6 +11609,9 @@ void TR_LowPriorityCompQueue::incStatsCompFromLPQ(uint8_t reason)
         case TR_MethodToBeCompiled::REASON_UPGRADE:
             _STAT_LPQcompUpgrade++;
             break;
+        case TR_MethodToBeCompiled::REASON_BULK_AOT_LOAD:
+            _STAT_LPQcompBulkAOTLoad++;
+            break;
 #if defined(J9VM_OPT_JITSERVER)
         case TR_MethodToBeCompiled::REASON_SERVER_UNAVAILABLE:
             _STAT_LPQcompServerUnavailable++;
@@ -11468,6 +11634,9 @@ void TR_LowPriorityCompQueue::incStatsReqQueuedToLPQ(uint8_t reason)
         case TR_MethodToBeCompiled::REASON_UPGRADE:
             _STAT_compReqQueuedByJIT++;
             break;
+        case TR_MethodToBeCompiled::REASON_BULK_AOT_LOAD:
+            _STAT_compReqQueuedByBulkAOTLoad++;
+            break;
 #if defined(J9VM_OPT_JITSERVER)
         case TR_MethodToBeCompiled::REASON_SERVER_UNAVAILABLE:
             _STAT_compReqQueuedByJITServer++;
@@ -11499,6 +11668,8 @@ void TR_LowPriorityCompQueue::printStats() const
         _STAT_LPQcompFromIprofiler + _STAT_LPQcompFromInterpreter + _STAT_LPQcompUpgrade, _STAT_LPQcompFromIprofiler,
         _STAT_LPQcompFromInterpreter, _STAT_LPQcompUpgrade);
 #endif /* defined(J9VM_OPT_JITSERVER) */
+    fprintf(stderr, "   Bulk AOT loads   = %4u queued %4u from LPQ\n", _STAT_compReqQueuedByBulkAOTLoad,
+        _STAT_LPQcompBulkAOTLoad);
     fprintf(stderr, "   Conflicts        = %4u (tried to cache j9method that didn't have space)\n", _STAT_conflict);
     fprintf(stderr, "   Stale entries    = %4u\n", _STAT_staleScrubbed); // we want very few of these, hopefully 0
     fprintf(stderr, "   Bypass ocurrences= %4u (normal comp req hapened before the fast LPQ comp req)\n", _STAT_bypass);
@@ -11506,6 +11677,13 @@ void TR_LowPriorityCompQueue::printStats() const
 
 void TR_LowPriorityCompQueue::invalidateRequestsForUnloadedMethods(J9Class *unloadedClass)
 {
+    int32_t numKept = 0;
+    for (int32_t i = 0; i < _numBulkAOTLoadClasses; i++) {
+        if (_bulkAOTLoadClasses[i] != unloadedClass)
+            _bulkAOTLoadClasses[numKept++] = _bulkAOTLoadClasses[i];
+    }
+    _numBulkAOTLoadClasses = numKept;
+
     TR_MethodToBeCompiled *cur = _firstLPQentry;
     TR_MethodToBeCompiled *prev = NULL;
     bool verbose = TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseHooks);
@@ -11554,6 +11732,84 @@ void TR_LowPriorityCompQueue::purgeLPQ()
     _lastLPQentry = NULL;
 }
 
+// Needs compilation monitor in hand
+void TR_LowPriorityCompQueue::addBulkAOTLoadClass(J9Class *clazz)
+{
+    if (_numBulkAOTLoadClasses == _maxBulkAOTLoadClasses) {
+        int32_t newMax = _maxBulkAOTLoadClasses ? 2 * _maxBulkAOTLoadClasses : 256;
+        J9Class **newClasses = (J9Class **)jitPersistentAlloc(newMax * sizeof(J9Class *));
+        if (!newClasses)
+            return; // OOM; the methods will still be compiled when their invocation counts expire
+        if (_bulkAOTLoadClasses) {
+            memcpy(newClasses, _bulkAOTLoadClasses, _numBulkAOTLoadClasses * sizeof(J9Class *));
+            jitPersistentFree(_bulkAOTLoadClasses);
+        }
+        _bulkAOTLoadClasses = newClasses;
+        _maxBulkAOTLoadClasses = newMax;
+    }
+    _bulkAOTLoadClasses[_numBulkAOTLoadClasses++] = clazz;
+}
+
+// Walks the recorded classes and queues an LPQ request for every interpreted method
+// that has a valid AOT body in the SCC, stopping after a class that brings the number
+// of queued requests to maxRequests, or after maxClasses classes have been looked at,
+// so that classes without AOT bodies cannot hold the monitors for a long time.
+// Classes that were not looked at remain recorded.
+// Needs compilation monitor and VM access in hand; the latter prevents class unloading
+int32_t TR_LowPriorityCompQueue::scheduleBulkAOTLoads(J9VMThread *vmThread, TR_J9SharedCache *sharedCache,
+    int32_t maxRequests, int32_t maxClasses)
+{
+    int32_t numQueued = 0;
+#if defined(J9VM_INTERP_AOT_COMPILE_SUPPORT) && defined(J9VM_OPT_SHARED_CLASSES)                        \
+    && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM) \
+        || defined(TR_HOST_ARM64))
+    int32_t numProcessed = 0;
+    int32_t classLimit = std::min(_numBulkAOTLoadClasses, maxClasses);
+    for (; numProcessed < classLimit && numQueued < maxRequests; numProcessed++) {
+        J9Class *clazz = _bulkAOTLoadClasses[numProcessed];
+        if (J9_IS_CLASS_OBSOLETE(clazz))
+            continue;
+
+        // Validate the class chain once for all the methods of the class
+        // instead of letting each relocation find out on its own
+        if (!sharedCache->classMatchesCachedVersion(clazz))
+            continue;
+
+        J9Method *ramMethods = clazz->ramMethods;
+        for (uint32_t m = 0; m < clazz->romClass->romMethodCount; m++) {
+            J9Method *method = &ramMethods[m];
+            J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+            if ((romMethod->modifiers & (J9AccNative | J9AccAbstract)) || TR::CompilationInfo::isCompiled(method)
+                || TR::CompilationInfo::getInvocationCount(method) <= 0) // already queued for compilation
+                continue;
+
+            if (vmThread->javaVM->sharedClassConfig->existsCachedCodeForROMMethod(vmThread, romMethod)) {
+                if (addFirstTimeCompReqToLPQ(method, TR_MethodToBeCompiled::REASON_BULK_AOT_LOAD))
+                    numQueued++;
+                else
+                    incNumFailuresToEnqueue();
+            }
+        }
+    }
+
+    if (numProcessed > 0) {
+        _numBulkAOTLoadClasses -= numProcessed;
+        memmove(_bulkAOTLoadClasses, _bulkAOTLoadClasses + numProcessed, _numBulkAOTLoadClasses * sizeof(J9Class *));
+    }
+#endif
+    return numQueued;
+}
+
+// Needs compilation monitor in hand
+void TR_LowPriorityCompQueue::purgeBulkAOTLoadClasses()
+{
+    if (_bulkAOTLoadClasses)
+        jitPersistentFree(_bulkAOTLoadClasses);
+    _bulkAOTLoadClasses = NULL;
+    _numBulkAOTLoadClasses = 0;
+    _maxBulkAOTLoadClasses = 0;
+}
+
 TR_MethodToBeCompiled *TR_LowPriorityCompQueue::extractFirstLPQRequest()
 {
     // take the top method out of the queue
@@ -32,6 +32,7 @@
 #include "env/VMJ9.h"
 #include "runtime/IProfiler.hpp"
 #include "runtime/J9Profiler.hpp"
+#include "runtime/SymbolValidationManager.hpp"
 #if defined(J9VM_OPT_JITSERVER)
 #include "runtime/Listener.hpp"
 #include "runtime/MetricsServer.hpp"
@@ -496,6 +497,13 @@ _abort:
 #endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
                     if (!persistentInfo->getAOTDependencyTable())
                         persistentInfo->setTrackAOTDependencies(false);
+
+                    if (!TR::Options::_disableSymbolValidationCache) {
+                        TR::Monitor *monitor = TR::Monitor::create("JIT-SymbolValidationCacheMonitor");
+                        if (monitor)
+                            persistentInfo->setSymbolValidationCache(
+                                new (PERSISTENT_NEW) TR::SymbolValidationCache(monitor));
+                    }
                 }
             } else
 #endif /* defined(J9VM_OPT_SHARED_CLASSES) */
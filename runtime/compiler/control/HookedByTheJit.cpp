@@ -78,6 +78,7 @@
 #include "runtime/HookHelpers.hpp"
 #include "runtime/MethodMetaData.h"
 #include "runtime/RelocationRuntime.hpp"
+#include "runtime/SymbolValidationManager.hpp"
 #include "runtime/asmprotos.h"
 #include "runtime/codertinit.hpp"
 #include "control/MethodToBeCompiled.hpp"
@@ -1850,6 +1851,14 @@ static void jitHookThreadDestroy(J9HookInterface **hookInterface, UDATA eventNum
     }
 #endif
 
+    // Persistent allocator magazines are thread local; return the blocks this thread cached
+    // so they are not stranded when it exits. Only the dying thread can reach its own magazines.
+    if (vmThread->osThread == j9thread_self()) {
+        TR::Compiler->persistentAllocator().flushThreadCache();
+        if (TR_IProfiler::allocator())
+            TR_IProfiler::allocator()->flushThreadCache();
+    }
+
     return;
 }
 
@@ -2210,6 +2219,7 @@ static void jitHookClassUnload(J9HookInterface **hookInterface, UDATA eventNum,
         // Loop through the set to find the class that needs to be purged.
         // Once found erase from the set.
         compInfo->getclassesCachedAtServer().erase(unloadedEvent->clazz);
+        compInfo->removeJITServerPrefetchHints(j9clazz);
         if (auto deserializer = compInfo->getJITServerAOTDeserializer())
             deserializer->invalidateClass(vmThread, j9clazz);
     }
@@ -2243,6 +2253,9 @@ static void jitHookClassLoaderUnload(J9HookInterface **hookInterface, UDATA even
     }
 #endif /* !defined(PERSISTENT_COLLECTIONS_UNSUPPORTED) */
 
+    if (compInfo->getPersistentInfo()->getSymbolValidationCache())
+        compInfo->getPersistentInfo()->getSymbolValidationCache()->onClassLoaderUnload(classLoader);
+
     bool p = TR::Options::getVerboseOption(TR_VerboseHookDetailsClassUnloading);
     if (p) {
         TR_VerboseLog::writeLineLocked(TR_Vlog_HD, "Class unloading for classLoader=0x%p", classLoader);
@@ -2425,6 +2438,10 @@ void jitClassesRedefined(J9VMThread *currentThread, UDATA classCount, J9JITRedef
     void *startPC;
     int i, j;
 
+    // Redefined classes no longer match the class chains validated by earlier AOT loads
+    if (compInfo->getPersistentInfo()->getSymbolValidationCache())
+        compInfo->getPersistentInfo()->getSymbolValidationCache()->invalidate();
+
     // need to get the compilation lock before updating the queue
     fe->acquireCompilationLock();
     compInfo->setAllCompilationsShouldBeInterrupted();
@@ -2524,6 +2541,8 @@ void jitClassesRedefined(J9VMThread *currentThread, UDATA classCount, J9JITRedef
         // Add to JITServer unload list
         if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) {
             compInfo->getUnloadedClassesTempList()->push_back((TR_OpaqueClassBlock *)classPair->oldClass);
+            compInfo->removeJITServerPrefetchHints(classPair->oldClass);
+            compInfo->removeJITServerPrefetchHints(classPair->newClass);
             if (auto deserializer = compInfo->getJITServerAOTDeserializer())
                 deserializer->invalidateClass(currentThread, classPair->oldClass, classPair->newClass);
         }
@@ -3880,6 +3899,21 @@ static void jitHookClassInitialize(J9HookInterface **hookInterface, UDATA eventN
     if (auto dependencyTable = compInfo->getPersistentInfo()->getAOTDependencyTable())
         dependencyTable->classLoadEvent((TR_OpaqueClassBlock *)cl, false, true);
 
+#if defined(J9VM_OPT_SHARED_CLASSES)
+    // Remember classes that may have AOT bodies; the sampler thread will queue their
+    // AOT loads once class loading settles down
+    if (TR::Options::_bulkAOTLoad && compInfo->getPersistentInfo()->getJitState() == STARTUP_STATE
+        && TR::Options::sharedClassCache() && !TR::Options::getAOTCmdLineOptions()->getOption(TR_NoLoadAOT)) {
+        TR_J9VMBase *fej9 = TR_J9VMBase::get(jitConfig, vmThread, TR_J9VMBase::AOT_VM);
+        TR_J9SharedCache *sc = fej9 ? fej9->sharedCache() : NULL;
+        if (sc && sc->isClassInSharedCache(cl)) {
+            compInfo->acquireCompMonitor(vmThread);
+            compInfo->getLowPriorityCompQueue().addBulkAOTLoadClass(cl);
+            compInfo->releaseCompMonitor(vmThread);
+        }
+    }
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
     loadingClasses = false;
 }
 
@@ -5469,6 +5503,35 @@ void CPUThrottleLogic(TR::CompilationInfo *compInfo, uint64_t crtTime)
     }
 }
 
+/// Limits the number of active compilation threads to a share of the container CPU quota.
+/// While the container is being throttled the limit is halved, and shouldDowngradeCompReq
+/// lowers the optimization level of first-time compilations.
+static void cpuQuotaLogic(TR::CompilationInfo *compInfo, uint64_t crtTime)
+{
+    TR_CgroupCpuQuota *cpuQuota = compInfo->getCgroupCpuQuota();
+    int32_t maxCompThreads = 0;
+    bool throttled = false;
+    if (cpuQuota->update() && cpuQuota->getQuotaCpuPercentage() > 0) {
+        int32_t compCpuBudget = cpuQuota->getQuotaCpuPercentage() * TR::Options::_compThreadCPUQuotaPercentage / 100;
+        // The (+ 50) implements rounding, so one compilation thread is allowed for a budget of [0 - 150)%
+        maxCompThreads = std::max(1, (compCpuBudget + 50) / 100);
+        throttled = cpuQuota->getThrottledPeriodsPercentage() >= TR::Options::_cpuQuotaThrottlingThreshold;
+        if (throttled)
+            maxCompThreads = std::max(1, maxCompThreads / 2);
+    }
+
+    if (maxCompThreads != compInfo->getMaxCompThreadsForCpuQuota() || throttled != compInfo->isCpuQuotaThrottled()) {
+        compInfo->setMaxCompThreadsForCpuQuota(maxCompThreads);
+        compInfo->setCpuQuotaThrottled(throttled);
+        if (TR::Options::isAnyVerboseOptionSet(TR_VerbosePerformance, TR_VerboseCompilationThreads))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
+                "t=%6u CPU quota=%d%% throttledPeriods=%d%% throttledTime=%llu usec: maxActiveCompThreads=%d%s",
+                (uint32_t)crtTime, cpuQuota->getQuotaCpuPercentage(), cpuQuota->getThrottledPeriodsPercentage(),
+                (unsigned long long)cpuQuota->getThrottledTimeDuringLastInterval(), maxCompThreads,
+                throttled ? " (throttled; downgrading compilations)" : "");
+    }
+}
+
 /// When many classes are loaded per second (like in Websphere startup)
 /// we would like to decrease the initial level of compilation from warm to cold
 /// The following fragment of code uses a heuristic to detect when we are
@@ -5617,6 +5680,44 @@ static void classLoadPhaseLogic(J9JITConfig *jitConfig, TR::CompilationInfo *com
     }
 }
 
+/// Queue AOT loads for the methods of the classes initialized during startup, in batches,
+/// as soon as the class loading phase is over. The loads are served from the LPQ, so they
+/// only take compilation threads that have nothing better to do.
+static void bulkAOTLoadLogic(J9JITConfig *jitConfig, TR::CompilationInfo *compInfo, J9VMThread *vmThread)
+{
+    TR::PersistentInfo *persistentInfo = compInfo->getPersistentInfo();
+    TR_LowPriorityCompQueue &lpq = compInfo->getLowPriorityCompQueue();
+    if (!lpq.hasBulkAOTLoadClasses()) // access without monitor in hand
+        return;
+
+    bool startupEnded = persistentInfo->getJitState() != STARTUP_STATE;
+    if (!startupEnded && persistentInfo->isClassLoadingPhase())
+        return; // wait for class loading to settle
+
+    TR_J9VMBase *fej9 = TR_J9VMBase::get(jitConfig, vmThread, TR_J9VMBase::AOT_VM);
+    TR_J9SharedCache *sc = fej9 ? fej9->sharedCache() : NULL;
+
+    // VM access must be acquired before the compilation monitor
+    acquireVMAccess(vmThread);
+    compInfo->acquireCompMonitor(vmThread);
+    if (startupEnded || !sc) {
+        // Past startup the remaining methods are left to the normal counting mechanism
+        lpq.purgeBulkAOTLoadClasses();
+    } else if (lpq.getLowPriorityQueueSize() < TR::Options::_bulkAOTLoadBatchSize) {
+        int32_t numQueued = lpq.scheduleBulkAOTLoads(vmThread, sc,
+            TR::Options::_bulkAOTLoadBatchSize - lpq.getLowPriorityQueueSize(),
+            TR::Options::_bulkAOTLoadClassBatchSize);
+        if (numQueued > 0 && compInfo->canProcessLowPriorityRequest() && compInfo->getNumCompThreadsJobless() > 0)
+            compInfo->getCompilationMonitor()->notifyAll();
+
+        if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "t=%6u Queued %d bulk AOT loads in LPQ. LPQ_SZ=%d",
+                (uint32_t)persistentInfo->getElapsedTime(), numQueued, lpq.getLowPriorityQueueSize());
+    }
+    compInfo->releaseCompMonitor(vmThread);
+    releaseVMAccess(vmThread);
+}
+
 #if defined(J9VM_INTERP_PROFILING_BYTECODES)
 static void iProfilerActivationLogic(J9JITConfig *jitConfig, TR::CompilationInfo *compInfo)
 {
@@ -6556,6 +6657,8 @@ static int32_t J9THREAD_PROC samplerThreadProc(void *entryarg)
                                     TR_VerboseLog::writeLine(TR_Vlog_MEMORY,
                                         "\tAssumptionType=%d allocated=%d reclaimed=%d", i, rat->getAssumptionCount(i),
                                         rat->getReclaimedAssumptionCount(i));
+
+                                TR::Compiler->persistentAllocator().printStatisticsToVlog();
                             }
 #if defined(WINDOWS) && defined(TR_TARGET_32BIT)
                             if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseVMemAvailable)) {
@@ -6650,6 +6753,14 @@ static int32_t J9THREAD_PROC samplerThreadProc(void *entryarg)
                     CalculateOverallCompCPUUtilization(compInfo, crtTime, samplerThread);
                 }
 
+                if (TR::Options::_compThreadCPUQuotaPercentage > 0
+#if defined(J9VM_OPT_JITSERVER)
+                    && persistentInfo->getRemoteCompilationMode() != JITServer::SERVER
+#endif /* defined(J9VM_OPT_JITSERVER) */
+                ) {
+                    cpuQuotaLogic(compInfo, crtTime);
+                }
+
 #if defined(J9VM_OPT_JITSERVER)
 #if defined(LINUX)
                 static uint64_t lastMallocTrimTime = 0;
@@ -6729,6 +6840,9 @@ static int32_t J9THREAD_PROC samplerThreadProc(void *entryarg)
 
                 // determine whether we're in class-load phase
                 classLoadPhaseLogic(jitConfig, compInfo, diffTime);
+
+                if (TR::Options::_bulkAOTLoad)
+                    bulkAOTLoadLogic(jitConfig, compInfo, samplerThread);
                 // fprintf(stderr, "samplingPeriod=%u numProcs=%u numActiveThreads=%u samplingFrequency=%d\n",
                 // samplingPeriod, compInfo->getNumTargetCPUs(), numActiveThreads, jitConfig->samplingFrequency);
 
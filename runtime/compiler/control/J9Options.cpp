@@ -150,6 +150,8 @@ int32_t J9::Options::_veryHighActiveThreadThreshold = -1;
 int32_t J9::Options::_aotCachePersistenceMinDeltaMethods = 200;
 int32_t J9::Options::_aotCachePersistenceMinPeriodMs = 10000; // ms
 int32_t J9::Options::_jitserverMallocTrimInterval = 1000 * 30; // 30000ms = 30s
+bool J9::Options::_jitserverMessageCompression = false;
+int32_t J9::Options::_jitserverMessageCompressionThreshold = 4096; // bytes
 int32_t J9::Options::_lowCompDensityModeEnterThreshold
     = 4; // Maximum number of compilations per 10 min of CPU required to enter low compilation density mode. Use 0 to
          // disable feature
@@ -190,6 +192,8 @@ int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
+int32_t J9::Options::_iprofilerNumHelperThreads = 0;
+bool J9::Options::_iprofilerAggregateSamples = false;
 #ifdef TR_HOST_64BIT
 int32_t J9::Options::_iProfilerMemoryConsumptionLimit = 32 * 1024 * 1024;
 #else
@@ -220,6 +224,8 @@ int32_t J9::Options::_qszThresholdToDowngradeOptLevel = -1; // not yet set
 int32_t J9::Options::_qsziThresholdToDowngradeDuringCLP = 0; // -1 or 0 disables the feature and reverts to old behavior
 int32_t J9::Options::_qszThresholdToDowngradeOptLevelDuringStartup = 100000; // a large number disables the feature
 int32_t J9::Options::_cpuUtilThresholdForStarvation = 25; // 25%
+int32_t J9::Options::_compThreadCPUQuotaPercentage = 0; // 0 disables the feature
+int32_t J9::Options::_cpuQuotaThrottlingThreshold = 10; // 10%
 int32_t J9::Options::_qszLimit = 5000; // when limit is reached the JIT will postpone new compilation requests
 
 // If too many GCR are queued we stop counting.
@@ -255,6 +261,10 @@ int32_t J9::Options::_invocationThresholdToTriggerLowPriComp = 250;
 int32_t J9::Options::_aotMethodThreshold = 200;
 int32_t J9::Options::_aotMethodCompilesThreshold = 200;
 int32_t J9::Options::_aotWarmSCCThreshold = 200;
+bool J9::Options::_bulkAOTLoad = false;
+int32_t J9::Options::_bulkAOTLoadBatchSize = 256;
+int32_t J9::Options::_bulkAOTLoadClassBatchSize = 128;
+bool J9::Options::_disableSymbolValidationCache = false;
 
 int32_t J9::Options::_largeTranslationTime = -1; // usec
 int32_t J9::Options::_weightOfAOTLoad = 1; // must be between 0 and 256
@@ -306,6 +316,7 @@ int32_t J9::Options::_seriousCompFailureThreshold
 bool J9::Options::_useCPUsToDetermineMaxNumberOfCompThreadsToActivate = false;
 int32_t J9::Options::_numCodeCachesToCreateAtStartup = 0; // 0 means no change from default which is 1
 bool J9::Options::_overrideCodecachetotal = false;
+bool J9::Options::_hotCodeCacheLayout = false;
 
 int32_t J9::Options::_dataCacheQuantumSize = 64;
 int32_t J9::Options::_dataCacheMinQuanta = 2;
@@ -869,6 +880,12 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      NOT_IN_SUBSET },
     { "bigAppSampleThresholdAdjust=", "O\tadjust the hot and scorching threshold for certain 'big' apps",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_bigAppSampleThresholdAdjust, 0, "F%d", NOT_IN_SUBSET },
+    { "bulkAOTLoad", "M\tduring startup, load the AOT bodies of already loaded classes in the background",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_bulkAOTLoad, 1, "F%d", NOT_IN_SUBSET },
+    { "bulkAOTLoadBatchSize=", "M<nnn>\tmax number of bulk AOT loads queued per sampling interval",
+     TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_bulkAOTLoadBatchSize, 0, "F%d", NOT_IN_SUBSET },
+    { "bulkAOTLoadClassBatchSize=", "M<nnn>\tmax number of recorded classes examined per sampling interval",
+     TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_bulkAOTLoadClassBatchSize, 0, "F%d", NOT_IN_SUBSET },
     { "classLoadPhaseInterval=",
      "O<nnn>\tnumber of sampling ticks before we run "
         "again the code for a class loading phase detection", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_classLoadingPhaseInterval, 0, "P%d", NOT_IN_SUBSET },
@@ -913,6 +930,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "compilationYieldStatsThreshold=",
      "M<nnn>\tprint stats about compilation yield points if the "
         "threshold is exceeded. Default 1000 usec. ", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compYieldStatsThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "compThreadCPUQuotaPercentage=",
+     "M<nnn>\tPercentage of the container CPU quota that active compilation threads may use. "
+        "Default 0 (disabled)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compThreadCPUQuotaPercentage, 0, "F%d",
+     NOT_IN_SUBSET },
     { "compThreadPriority=",
      "M<nnn>\tThe priority of the compilation thread. "
         "Use an integer between 0 and 4. Default is 4 (highest priority)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_compilationThreadPriorityCode, 0, "F%d",
@@ -931,6 +952,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "cpuEntitlementForConservativeScorching=", "M<nnn>\tPercentage. 200 means two full cpus",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_cpuEntitlementForConservativeScorching, 0, "F%d",
      NOT_IN_SUBSET },
+    { "cpuQuotaThrottlingThreshold=",
+     "M<nnn>\tPercentage of CFS periods in which the container is throttled above which "
+        "fewer compilation threads are activated and compilations are downgraded", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_cpuQuotaThrottlingThreshold, 0, "F%d",
+     NOT_IN_SUBSET },
     { "cpuUtilThresholdForStarvation=", "M<nnn>\tThreshold for deciding that a comp thread is not starved",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_cpuUtilThresholdForStarvation, 0, "F%d",
      NOT_IN_SUBSET },
@@ -948,6 +973,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "disableIProfilerClassUnloadThreshold=",
      "R<nnn>\tNumber of classes that can be unloaded before we disable the IProfiler", TR::Options::setStaticNumeric,
      (intptr_t)&TR::Options::_disableIProfilerClassUnloadThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "disableSymbolValidationCache", "M\tdo not share symbol validation results across AOT loads",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_disableSymbolValidationCache, 1, "F%d", NOT_IN_SUBSET },
     { "dltPostponeThreshold=", "M<nnn>\tNumber of dlt attempts inv. count for a method is seen not advancing",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_dltPostponeThreshold, 0, "F%d", NOT_IN_SUBSET },
     { "exclude=", "D<xxx>\tdo not compile methods beginning with xxx", TR::Options::limitOption, 1, 0, "P%s" },
@@ -970,6 +997,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "highActiveThreadThreshold=", " \tDefines what is a high Threshold for active compilations",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_highActiveThreadThreshold, 0, "F%d" },
 #endif  /* defined(J9VM_OPT_JITSERVER) */
+    { "hotCodeCacheLayout", "M\tplace hot and scorching method bodies in a designated hot code cache",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_hotCodeCacheLayout, 1, "F%d", NOT_IN_SUBSET },
     { "HWProfilerAOTWarmOptLevelThreshold=", "O<nnn>\tAOT Warm Opt Level Threshold", TR::Options::setStaticNumeric,
      (intptr_t)&TR::Options::_hwprofilerAOTWarmOptLevelThreshold, 0, "F%d", NOT_IN_SUBSET },
     { "HWProfilerBufferMaxPercentageToDiscard=",
@@ -1047,6 +1076,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "invocationThresholdToTriggerLowPriComp=",
      "M<nnn>\tNumber of times a loopy method must be invoked to be eligible for LPQ", TR::Options::setStaticNumeric,
      (intptr_t)&TR::Options::_invocationThresholdToTriggerLowPriComp, 0, "F%d", NOT_IN_SUBSET },
+    { "iprofilerAggregateSamples", " \tcoalesce repeated samples of a buffer before updating the IProfiler hashtable",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_iprofilerAggregateSamples, 1, "F%d", NOT_IN_SUBSET },
     { "iprofilerBcHashTableSize=", "M<nnn>\tSize of the backbone for the IProfiler bytecode hash table",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerBcHashTableSize, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerBufferInterarrivalTimeToExitDeepIdle=",
@@ -1077,6 +1108,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      NOT_IN_SUBSET },
     { "iprofilerMethodHashTableSize=", "M<nnn>\tSize of the backbone for the IProfiler method (fanin) hash table",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerMethodHashTableSize, 0, "F%d", NOT_IN_SUBSET },
+    { "iprofilerNumHelperThreads=", "O<nnn>\tnumber of threads that parse interpreter profiling buffers "
+        "alongside the IProfiler thread", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerNumHelperThreads, 0, "F%d",
+     NOT_IN_SUBSET },
     { "iprofilerNumOutstandingBuffers=",
      "O<nnn>\tnumber of outstanding interpreter profiling buffers "
         "allowed in the system. Specify 0 to disable this optimization", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerNumOutstandingBuffers, 0, "F%d",
@@ -1103,6 +1137,11 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      TR::Options::JITServerAOTCacheStoreLimitOption, 1, 0, "P%s" },
     { "jitserverMallocTrimInterval=",
      "M<nnn>\tmiminum time between two consecutive JITServer client malloc_trim invocations (ms)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMallocTrimInterval, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverMessageCompression", " \tcompress large JITServer messages if the other side agrees",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_jitserverMessageCompression, 1, "F%d", NOT_IN_SUBSET },
+    { "jitserverMessageCompressionThreshold=",
+     "M<nnn>\tminimum size of a JITServer message to be considered for compression (bytes)", TR::Options::setStaticNumeric,
+     (intptr_t)&TR::Options::_jitserverMessageCompressionThreshold, 0, "F%d", NOT_IN_SUBSET },
 #endif  /* defined(J9VM_OPT_JITSERVER) */
     { "jProfilingEnablementSampleThreshold=",
      "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies", TR::Options::setStaticNumeric,
@@ -347,6 +347,8 @@ public:
     static int32_t _iprofilerBufferMaxPercentageToDiscard;
     static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
     static int32_t _iprofilerBufferSize; // iprofilerbuffer size in kb
+    static int32_t _iprofilerNumHelperThreads; // threads that parse buffers alongside the IProfiler thread
+    static bool _iprofilerAggregateSamples; // coalesce repeated samples of a buffer before updating the hashtable
 
     static int32_t _maxIprofilingCount; // when invocation count is larger than
                                         // this value Iprofiler will not collect data
@@ -377,6 +379,7 @@ public:
     static int32_t getNumCodeCachesToCreateAtStartup() { return _numCodeCachesToCreateAtStartup; }
 
     static bool _overrideCodecachetotal;
+    static bool _hotCodeCacheLayout; // keep hot method bodies together in a designated code cache
     static int32_t _dataCacheQuantumSize;
     static int32_t _dataCacheMinQuanta;
 
@@ -435,6 +438,8 @@ public:
     static int32_t _qsziThresholdToDowngradeDuringCLP;
     static int32_t _qszThresholdToDowngradeOptLevelDuringStartup;
     static int32_t _cpuUtilThresholdForStarvation;
+    static int32_t _compThreadCPUQuotaPercentage; // share of the container CPU quota available to compilation threads
+    static int32_t _cpuQuotaThrottlingThreshold; // percentage of throttled CFS periods that makes the JIT back off
     static int32_t _qszLimit; // maximum size of the compilation queue
     static int32_t _compPriorityQSZThreshold;
     static int32_t _GCRQueuedThresholdForCounting; // if too many GCR are queued we stop counting
@@ -460,6 +465,8 @@ public:
     static int32_t _aotCachePersistenceMinDeltaMethods;
     static int32_t _aotCachePersistenceMinPeriodMs;
     static int32_t _jitserverMallocTrimInterval;
+    static bool _jitserverMessageCompression;
+    static int32_t _jitserverMessageCompressionThreshold;
     static int32_t _lowCompDensityModeEnterThreshold;
     static int32_t _lowCompDensityModeExitThreshold;
     static int32_t _lowCompDensityModeExitLPQSize;
@@ -495,6 +502,10 @@ public:
                                                 //   complication due to zOS trade scenario: two JVMs share a cache
     static int32_t _aotWarmSCCThreshold; // if there are at least that many AOT bodies in SCC at startup
                                          // then we declare the SCC to be warm
+    static bool _bulkAOTLoad; // during startup, load AOT bodies of loaded classes from the LPQ once class loading settles
+    static int32_t _bulkAOTLoadBatchSize; // max number of bulk AOT load requests queued to the LPQ per sampling interval
+    static int32_t _bulkAOTLoadClassBatchSize; // max number of recorded classes examined per sampling interval
+    static bool _disableSymbolValidationCache; // validate well-known classes on every AOT load instead of once per JVM
     static int32_t _largeTranslationTime; // usec
     static int32_t _weightOfAOTLoad;
     static int32_t _weightOfJSR292;
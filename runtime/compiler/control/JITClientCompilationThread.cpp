@@ -54,6 +54,8 @@
 #include "runtime/JITServerIProfiler.hpp"
 #include "runtime/RelocationTarget.hpp"
 
+#include <algorithm>
+
 extern TR::Monitor *assumptionTableMutex;
 
 // TODO: This method is copied from runtime/jit_vm/ctsupport.c,
@@ -183,6 +185,123 @@ static void handler_IProfiler_profilingSample(JITServer::ClientStream *client, T
     }
 }
 
+static void getMultipleResolvedMethods(TR::Compilation *comp, TR_J9VM *fe, TR_ResolvedJ9Method *owningMethod,
+    const std::vector<TR_ResolvedMethodType> &methodTypes, const std::vector<int32_t> &cpIndices,
+    std::vector<TR_OpaqueMethodBlock *> &ramMethods, std::vector<uint32_t> &vTableOffsets,
+    std::vector<TR_ResolvedJ9JITServerMethodInfo> &methodInfos, std::vector<char> &unresolvedInCPs)
+{
+    int32_t numMethods = methodTypes.size();
+    ramMethods.resize(numMethods);
+    vTableOffsets.resize(numMethods);
+    methodInfos.resize(numMethods);
+    // vector<bool> does not seem to work
+    unresolvedInCPs.resize(numMethods);
+    for (int32_t i = 0; i < numMethods; ++i) {
+        int32_t cpIndex = cpIndices[i];
+        TR_ResolvedMethodType type = methodTypes[i];
+        TR_ResolvedJ9Method *resolvedMethod = NULL;
+        TR_OpaqueMethodBlock *ramMethod = NULL;
+        uint32_t vTableOffset = 0;
+        TR_ResolvedJ9JITServerMethodInfo methodInfo;
+        bool unresolvedInCP = true;
+        switch (type) {
+            case TR_ResolvedMethodType::VirtualFromCP: {
+                resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
+                    owningMethod->getResolvedPossiblyPrivateVirtualMethod(comp, cpIndex, true, &unresolvedInCP));
+                vTableOffset = resolvedMethod ? resolvedMethod->vTableSlot() : 0;
+                break;
+            }
+            case TR_ResolvedMethodType::Static: {
+                resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
+                    owningMethod->getResolvedStaticMethod(comp, cpIndex, &unresolvedInCP));
+                break;
+            }
+            case TR_ResolvedMethodType::Special: {
+                resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
+                    owningMethod->getResolvedSpecialMethod(comp, cpIndex, &unresolvedInCP));
+                break;
+            }
+            case TR_ResolvedMethodType::ImproperInterface: {
+                resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
+                    owningMethod->getResolvedImproperInterfaceMethod(comp, cpIndex));
+                vTableOffset = resolvedMethod ? resolvedMethod->vTableSlot() : 0;
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+        if (resolvedMethod) {
+            TR_ResolvedJ9JITServerMethod::packMethodInfo(methodInfo, resolvedMethod, fe);
+            ramMethod = resolvedMethod->getPersistentIdentifier();
+        }
+        ramMethods[i] = ramMethod;
+        vTableOffsets[i] = vTableOffset;
+        methodInfos[i] = methodInfo;
+        unresolvedInCPs[i] = unresolvedInCP;
+    }
+}
+
+// Merge the resolved callees the server just asked for into the prefetch hint of the method being
+// compiled. Entries are only ever added, so that callees answered up front by the compilation request
+// (which the server no longer asks for) are not forgotten.
+static void addJITServerPrefetchHint(TR::CompilationInfo *compInfo, J9Method *method,
+    const std::vector<TR_ResolvedMethodType> &methodTypes, const std::vector<int32_t> &cpIndices)
+{
+    OMR::CriticalSection prefetchHints(compInfo->getclassesCachedAtServerMonitor());
+    auto &hints = compInfo->getJITServerPrefetchHints();
+    auto it = hints.find(method);
+    if (it == hints.end()) {
+        JITServerPrefetchHints_t::mapped_type hint(
+            JITServerPrefetchHints_t::mapped_type::allocator_type(TR::Compiler->persistentAllocator()));
+        it = hints.insert({ method, hint }).first;
+    }
+
+    auto &hint = it->second;
+    for (size_t i = 0; i < methodTypes.size(); ++i) {
+        auto entry = std::make_pair((int32_t)methodTypes[i], cpIndices[i]);
+        if (std::find(hint.begin(), hint.end(), entry) == hint.end())
+            hint.push_back(entry);
+    }
+}
+
+// Answer up front the queries the server made the last time it compiled this method: the mirror of
+// the method itself and the resolved callees it asked for in one batch. Returns an empty prefetch
+// (no mirror) when there is no hint for the method.
+static TR_ResolvedJ9JITServerPrefetchInfo getJITServerPrefetchInfo(TR::Compilation *comp, TR_J9VM *fe,
+    TR::CompilationInfo *compInfo, J9Method *method)
+{
+    TR_ResolvedJ9JITServerPrefetchInfo prefetchInfo;
+    std::vector<TR_ResolvedMethodType> &methodTypes = std::get<1>(prefetchInfo);
+    std::vector<int32_t> &cpIndices = std::get<2>(prefetchInfo);
+    {
+        OMR::CriticalSection prefetchHints(compInfo->getclassesCachedAtServerMonitor());
+        auto &hints = compInfo->getJITServerPrefetchHints();
+        auto it = hints.find(method);
+        if (it == hints.end())
+            return prefetchInfo;
+
+        methodTypes.reserve(it->second.size());
+        cpIndices.reserve(it->second.size());
+        for (auto &entry : it->second) {
+            methodTypes.push_back((TR_ResolvedMethodType)entry.first);
+            cpIndices.push_back(entry.second);
+        }
+    }
+
+    auto &mirrorInfo = std::get<0>(prefetchInfo);
+    TR_ResolvedJ9JITServerMethod::createResolvedMethodMirror(mirrorInfo, (TR_OpaqueMethodBlock *)method, 0, NULL,
+        fe, comp->trMemory());
+    auto owningMethod = std::get<0>(mirrorInfo).remoteMirror;
+    if (!owningMethod)
+        return TR_ResolvedJ9JITServerPrefetchInfo();
+
+    getMultipleResolvedMethods(comp, fe, owningMethod, methodTypes, cpIndices, std::get<3>(prefetchInfo),
+        std::get<4>(prefetchInfo), std::get<5>(prefetchInfo), std::get<6>(prefetchInfo));
+    compInfo->incNumJITServerPrefetchedCompReqs();
+    return prefetchInfo;
+}
+
 static bool handleResponse(JITServer::MessageType response, JITServer::ClientStream *client,
     TR::CompilationInfoPerThread *compInfoPT, TR::Compilation *comp, TR_J9VM *fe, J9VMThread *vmThread)
 {
@@ -229,6 +348,7 @@ static bool handleResponse(JITServer::MessageType response, JITServer::ClientStr
             {
                 OMR::CriticalSection romClassCache(compInfo->getclassesCachedAtServerMonitor());
                 compInfo->getclassesCachedAtServer().clear();
+                compInfo->getJITServerPrefetchHints().clear();
             }
 
             // Add the list of methods that were DLTed
@@ -1519,57 +1639,16 @@ static bool handleResponse(JITServer::MessageType response, JITServer::ClientStr
             auto owningMethod = std::get<0>(recv);
             auto &methodTypes = std::get<1>(recv);
             auto &cpIndices = std::get<2>(recv);
-            int32_t numMethods = methodTypes.size();
-            std::vector<TR_OpaqueMethodBlock *> ramMethods(numMethods);
-            std::vector<uint32_t> vTableOffsets(numMethods);
-            std::vector<TR_ResolvedJ9JITServerMethodInfo> methodInfos(numMethods);
-            // vector<bool> does not seem to work
-            std::vector<char> unresolvedInCPs(numMethods);
-            for (int32_t i = 0; i < numMethods; ++i) {
-                int32_t cpIndex = cpIndices[i];
-                TR_ResolvedMethodType type = methodTypes[i];
-                TR_ResolvedJ9Method *resolvedMethod = NULL;
-                TR_OpaqueMethodBlock *ramMethod = NULL;
-                uint32_t vTableOffset = 0;
-                TR_ResolvedJ9JITServerMethodInfo methodInfo;
-                bool unresolvedInCP = true;
-                switch (type) {
-                    case TR_ResolvedMethodType::VirtualFromCP: {
-                        resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
-                            owningMethod->getResolvedPossiblyPrivateVirtualMethod(comp, cpIndex, true,
-                                &unresolvedInCP));
-                        vTableOffset = resolvedMethod ? resolvedMethod->vTableSlot() : 0;
-                        break;
-                    }
-                    case TR_ResolvedMethodType::Static: {
-                        resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
-                            owningMethod->getResolvedStaticMethod(comp, cpIndex, &unresolvedInCP));
-                        break;
-                    }
-                    case TR_ResolvedMethodType::Special: {
-                        resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
-                            owningMethod->getResolvedSpecialMethod(comp, cpIndex, &unresolvedInCP));
-                        break;
-                    }
-                    case TR_ResolvedMethodType::ImproperInterface: {
-                        resolvedMethod = static_cast<TR_ResolvedJ9Method *>(
-                            owningMethod->getResolvedImproperInterfaceMethod(comp, cpIndex));
-                        vTableOffset = resolvedMethod ? resolvedMethod->vTableSlot() : 0;
-                        break;
-                    }
-                    default: {
-                        break;
-                    }
-                }
-                if (resolvedMethod) {
-                    TR_ResolvedJ9JITServerMethod::packMethodInfo(methodInfo, resolvedMethod, fe);
-                    ramMethod = resolvedMethod->getPersistentIdentifier();
-                }
-                ramMethods[i] = ramMethod;
-                vTableOffsets[i] = vTableOffset;
-                methodInfos[i] = methodInfo;
-                unresolvedInCPs[i] = unresolvedInCP;
-            }
+            std::vector<TR_OpaqueMethodBlock *> ramMethods;
+            std::vector<uint32_t> vTableOffsets;
+            std::vector<TR_ResolvedJ9JITServerMethodInfo> methodInfos;
+            std::vector<char> unresolvedInCPs;
+            getMultipleResolvedMethods(comp, fe, owningMethod, methodTypes, cpIndices, ramMethods, vTableOffsets,
+                methodInfos, unresolvedInCPs);
+            // Remember what the server asked for about the method being compiled,
+            // so that the next compilation request for it can carry the answers
+            if (owningMethod->ramMethod() == compInfoPT->getMethodBeingCompiled()->getMethodDetails().getMethod())
+                addJITServerPrefetchHint(compInfo, owningMethod->ramMethod(), methodTypes, cpIndices);
             client->write(response, ramMethods, vTableOffsets, methodInfos, unresolvedInCPs);
         } break;
         case MessageType::ResolvedMethod_getConstantDynamicTypeFromCP: {
@@ -3196,6 +3275,12 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
 
     uint32_t methodIndex
         = (uint32_t)(method - clazz->ramMethods); // Index in the array of methods of the defining class
+
+    // Answer up front the queries the server is expected to make, based on the last time it compiled this method
+    TR_ResolvedJ9JITServerPrefetchInfo prefetchInfo;
+    if (!useAotCompilation && !aotCacheStore && !aotCacheLoad && details.isOrdinaryMethod())
+        prefetchInfo = getJITServerPrefetchInfo(compiler, compiler->fej9vm(), compInfo, method);
+
     try {
         // Release VM access just before sending the compilation request
         // message just in case we block in the write operation
@@ -3214,7 +3299,7 @@ TR_MethodMetaData *remoteCompile(J9VMThread *vmThread, TR::Compilation *compiler
             classInfoTuple, optionsStr, recompMethodInfoStr, chtableUpdates.first, chtableUpdates.second,
             useAotCompilation, TR::Compiler->vm.isVMInStartupPhase(compInfoPT->getJitConfig()), aotCacheStore,
             aotCacheLoad, methodIndex, classChainOffset, ramClassChain, uncachedRAMClasses, uncachedClassInfos,
-            newKnownIds, numPermanentLoaders);
+            newKnownIds, numPermanentLoaders, prefetchInfo);
 
         JITServer::MessageType response;
         while (!handleServerMessage(client, compiler->fej9vm(), response))
@@ -290,6 +290,7 @@ TR::CompilationInfoPerThreadRemote::CompilationInfoPerThreadRemote(TR::Compilati
     , _staticAttributesCache(NULL)
     , _nullClassSignatureCache(NULL)
     , _isUnresolvedStrCache(NULL)
+    , _prefetchedCalleesCached(false)
     , _classUnloadReadMutexDepth(0)
     , _aotCacheStore(false)
     , _methodIndex((uint32_t)-1)
@@ -325,6 +326,7 @@ void TR::CompilationInfoPerThreadRemote::notifyAndDetachWaitingRequests(ClientSe
 }
 
 int32_t TR::CompilationInfoPerThreadRemote::_numClearedCaches = 0;
+uint32_t TR::CompilationInfoPerThreadRemote::_numPrefetchedQueries = 0;
 
 /**
  * @brief Method executed by a compilation thread at JITServer to wait for all
@@ -575,6 +577,7 @@ void TR::CompilationInfoPerThreadRemote::processCompilationRequest(CompilationRe
     auto &uncachedClassInfos = std::get<23>(req);
     auto &newKnownIds = std::get<24>(req);
     size_t numPermanentLoaders = std::get<25>(req);
+    _prefetchInfo = std::move(std::get<26>(req));
 
     TR_ASSERT_FATAL(TR::Compiler->persistentMemory() == compInfo->persistentMemory(),
         "per-client persistent memory must not be set at this point");
@@ -961,19 +964,8 @@ void TR::CompilationInfoPerThreadRemote::processAOTCacheMapRequest(const std::st
 
     std::vector<std::string> methodSignaturesV;
     if (aotCache) {
-        auto cachedMethodMonitor = aotCache->getCachedMethodMonitor();
         try {
-            {
-                OMR::CriticalSection cs(cachedMethodMonitor);
-
-                auto cachedAOTMethod = aotCache->getCachedMethodHead();
-                methodSignaturesV.reserve(aotCache->getCachedMethodMap().size());
-
-                for (; cachedAOTMethod != NULL; cachedAOTMethod = cachedAOTMethod->getNextRecord()) {
-                    const SerializedAOTMethod &serializedAOTMethod = cachedAOTMethod->data();
-                    methodSignaturesV.emplace_back(std::string(serializedAOTMethod.signature()));
-                }
-            }
+            aotCache->getCachedMethodSignatures(methodSignaturesV);
         } catch (const std::bad_alloc &e) {
             if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "std::bad_alloc: %s", e.what());
@@ -1017,7 +1009,7 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
         auto aotCacheMap = compInfo->getJITServerAOTCacheMap();
         TR_ASSERT(aotCacheMap, "aotCacheMap must exist if such a special request was issued");
         if (stream == LOAD_AOTCACHE_REQUEST)
-            aotCacheMap->loadNextQueuedAOTCacheFromFile(scratchSegmentProvider);
+            aotCacheMap->loadNextQueuedAOTCacheFromFile();
         else
             aotCacheMap->saveNextQueuedAOTCacheToFile();
 
@@ -1610,6 +1602,65 @@ TR_ResolvedMethodKey TR::CompilationInfoPerThreadRemote::getResolvedMethodKey(TR
     return key;
 }
 
+/**
+ * @brief Method executed by JITServer to retrieve the mirror of the method being compiled
+ * that the client sent ahead of time with the compilation request
+ *
+ * @param method The method for which a mirror is needed
+ * @param methodInfo Set to the method info of the prefetched mirror, if any
+ * @return returns true if the client prefetched a mirror for the given method, false otherwise
+ */
+bool TR::CompilationInfoPerThreadRemote::getPrefetchedMirror(TR_OpaqueMethodBlock *method,
+    TR_ResolvedJ9JITServerMethodInfo &methodInfo)
+{
+    auto &mirrorInfo = std::get<0>(_prefetchInfo);
+    if (!std::get<0>(mirrorInfo).remoteMirror
+        || (TR_OpaqueMethodBlock *)getMethodBeingCompiled()->getMethodDetails().getMethod() != method)
+        return false;
+
+    methodInfo = mirrorInfo;
+    _numPrefetchedQueries++; // mirrorResolvedJ9Method
+    return true;
+}
+
+/**
+ * @brief Method executed by JITServer to add the resolved callees that the client sent ahead of
+ * time with the compilation request to the resolved method cache
+ *
+ * The callees were resolved by the client against the prefetched mirror of the method being
+ * compiled, so they are only used when owningMethod was created from that mirror.
+ *
+ * @param owningMethod The method whose callees are about to be cached
+ * @param ttlForUnresolved Time-to-live for cached unresolved methods
+ * @return void
+ */
+void TR::CompilationInfoPerThreadRemote::cachePrefetchedResolvedMethods(TR_ResolvedJ9JITServerMethod *owningMethod,
+    int32_t ttlForUnresolved)
+{
+    if (_prefetchedCalleesCached
+        || owningMethod->getRemoteMirror() != std::get<0>(std::get<0>(_prefetchInfo)).remoteMirror)
+        return;
+    _prefetchedCalleesCached = true;
+
+    auto &methodTypes = std::get<1>(_prefetchInfo);
+    auto &cpIndices = std::get<2>(_prefetchInfo);
+    auto &ramMethods = std::get<3>(_prefetchInfo);
+    auto &vTableOffsets = std::get<4>(_prefetchInfo);
+    auto &methodInfos = std::get<5>(_prefetchInfo);
+    auto &unresolvedInCPs = std::get<6>(_prefetchInfo);
+    size_t numMethods = methodTypes.size();
+    if (numMethods < 2) // A single method would not have been requested in a batch
+        return;
+
+    TR_OpaqueClassBlock *ramClass = (TR_OpaqueClassBlock *)owningMethod->constantPoolHdr();
+    for (size_t i = 0; i < numMethods; ++i) {
+        TR_ResolvedMethodKey key = getResolvedMethodKey(methodTypes[i], ramClass, cpIndices[i]);
+        cacheResolvedMethod(key, ramMethods[i], vTableOffsets[i], methodInfos[i], (bool)unresolvedInCPs[i],
+            ttlForUnresolved);
+    }
+    _numPrefetchedQueries++; // ResolvedMethod_getMultipleResolvedMethods
+}
+
 /**
  * @brief Method executed by JITServer to save the mirrors of resolved method of interest to a list
  *
@@ -1746,6 +1797,8 @@ void TR::CompilationInfoPerThreadRemote::clearPerCompilationCaches()
     clearPerCompilationCache(_staticAttributesCache);
     clearPerCompilationCache(_nullClassSignatureCache);
     clearPerCompilationCache(_isUnresolvedStrCache);
+    _prefetchInfo = TR_ResolvedJ9JITServerPrefetchInfo();
+    _prefetchedCalleesCached = false;
 }
 
 /**
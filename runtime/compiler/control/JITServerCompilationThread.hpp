@@ -41,7 +41,7 @@ using CompilationRequest = std::tuple<uint64_t, uint32_t, uint32_t, J9Method *,
     std::string, J9::IlGeneratorMethodDetailsType, std::vector<TR_OpaqueClassBlock *>,
     std::vector<TR_OpaqueClassBlock *>, JITServerHelpers::ClassInfoTuple, std::string, std::string, std::string,
     std::string, bool, bool, bool, bool, uint32_t, uintptr_t, std::vector<J9Class *>, std::vector<J9Class *>,
-    std::vector<JITServerHelpers::ClassInfoTuple>, std::vector<uintptr_t>, size_t>;
+    std::vector<JITServerHelpers::ClassInfoTuple>, std::vector<uintptr_t>, size_t, TR_ResolvedJ9JITServerPrefetchInfo>;
 
 void outOfProcessCompilationEnd(TR_MethodToBeCompiled *entry, TR::Compilation *comp);
 
@@ -76,6 +76,8 @@ public:
 
     void incNumClearedCaches() { _numClearedCaches++; }
 
+    static uint32_t getNumPrefetchedQueries() { return _numPrefetchedQueries; }
+
     void copyClientOptions(const std::string &clientOptStr, TR_PersistentMemory *persistentMemory)
     {
         size_t clientOptSize = clientOptStr.size();
@@ -110,6 +112,9 @@ public:
     TR_ResolvedMethodKey getResolvedMethodKey(TR_ResolvedMethodType type, TR_OpaqueClassBlock *ramClass,
         int32_t cpIndex, TR_OpaqueClassBlock *classObject = NULL);
 
+    bool getPrefetchedMirror(TR_OpaqueMethodBlock *method, TR_ResolvedJ9JITServerMethodInfo &methodInfo);
+    void cachePrefetchedResolvedMethods(TR_ResolvedJ9JITServerMethod *owningMethod, int32_t ttlForUnresolved);
+
     void cacheResolvedMirrorMethodsPersistIPInfo(TR_ResolvedJ9Method *resolvedMethod);
 
     ResolvedMirrorMethodsPersistIP_t *getCachedResolvedMirrorMethodsPersistIPInfo() const
@@ -227,6 +232,8 @@ private:
     FieldOrStaticAttrTable_t *_staticAttributesCache;
     NullClassSignatureCache_t *_nullClassSignatureCache;
     UnorderedMap<std::pair<TR_OpaqueClassBlock *, int32_t>, TR_IsUnresolvedString> *_isUnresolvedStrCache;
+    TR_ResolvedJ9JITServerPrefetchInfo _prefetchInfo; // answers sent ahead of time with the compilation request
+    bool _prefetchedCalleesCached; // true once the resolved callees in _prefetchInfo were added to the cache
     int32_t _classUnloadReadMutexDepth;
     bool _aotCacheStore; // True if the result of this compilation will be stored in AOT cache
     uint32_t _methodIndex; // Index of the method being compiled in the array of methods of its defining class
@@ -235,6 +242,7 @@ private:
 
     static int32_t
         _numClearedCaches; // number of instances JITServer was forced to clear its internal per-client caches
+    static uint32_t _numPrefetchedQueries; // number of queries answered from data sent with compilation requests
 
 }; // class CompilationInfoPerThreadRemote
 } // namespace TR
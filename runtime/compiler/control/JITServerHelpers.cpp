@@ -785,6 +785,10 @@ void JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compil
     j9tty_printf(PORTLIB, "Total number of messages: %llu\n", (unsigned long long)totalMsgCount);
     j9tty_printf(PORTLIB, "Total amount of data received: %llu bytes\n",
         (unsigned long long)JITServer::CommunicationStream::_totalMsgSize);
+    if (JITServer::CommunicationStream::_numCompressedMsgs)
+        j9tty_printf(PORTLIB, "Compressed messages: %llu, bytes saved by compression: %llu\n",
+            (unsigned long long)JITServer::CommunicationStream::_numCompressedMsgs,
+            (unsigned long long)JITServer::CommunicationStream::_compressionBytesSaved);
 
     uint32_t numCompilations = 0;
     uint32_t numDeserializedMethods = 0;
@@ -801,6 +805,19 @@ void JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compil
     if (numCompilations)
         j9tty_printf(PORTLIB, "Average number of messages per compilation: %f\n",
             totalMsgCount / float(numCompilations));
+
+    if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) {
+        if (uint32_t numPrefetchedCompReqs = compInfo->getNumJITServerPrefetchedCompReqs())
+            j9tty_printf(PORTLIB, "Compilation requests with prefetched answers: %u\n", numPrefetchedCompReqs);
+    } else if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
+        uint32_t numPrefetchedQueries = TR::CompilationInfoPerThreadRemote::getNumPrefetchedQueries();
+        if (numPrefetchedQueries) {
+            j9tty_printf(PORTLIB, "Messages avoided thanks to prefetched answers: %u\n", numPrefetchedQueries);
+            if (numCompilations)
+                j9tty_printf(PORTLIB, "Average number of messages per compilation without prefetching: %f\n",
+                    (totalMsgCount + numPrefetchedQueries) / float(numCompilations));
+        }
+    }
     if (numDeserializedMethods)
         j9tty_printf(PORTLIB, "Average number of messages per compilation request (including AOT cache hits): %f\n",
             totalMsgCount / float(numCompilations + numDeserializedMethods));
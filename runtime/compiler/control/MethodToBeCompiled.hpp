@@ -61,6 +61,7 @@ struct TR_MethodToBeCompiled {
         REASON_IPROFILER_CALLS,
         REASON_LOW_COUNT_EXPIRED,
         REASON_UPGRADE,
+        REASON_BULK_AOT_LOAD,
 #if defined(J9VM_OPT_JITSERVER)
         REASON_SERVER_UNAVAILABLE
 #endif
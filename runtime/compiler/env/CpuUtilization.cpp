@@ -23,6 +23,8 @@
 #include "control/CompilationRuntime.hpp"
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include "jni.h"
 #include "j9.h"
 #include "j9port.h"
@@ -466,3 +468,111 @@ void TR_CpuEntitlement::computeAndCacheCpuEntitlement()
     }
 }
 
+
+// Keys of the cgroup cpu subsystem metrics reported by the port library
+static const char CGROUP_CPU_PERIOD_KEY[] = "CPU Period";
+static const char CGROUP_CPU_QUOTA_KEY[] = "CPU Quota";
+static const char CGROUP_CPU_NUM_PERIODS_KEY[] = "Period intervals elapsed count";
+static const char CGROUP_CPU_NUM_THROTTLED_KEY[] = "Throttled count";
+static const char CGROUP_CPU_THROTTLED_TIME_KEY[] = "Total throttle time";
+
+void TR_CgroupCpuQuota::init(J9JITConfig *jitConfig)
+{
+    _jitConfig = jitConfig;
+    _isFunctional = false;
+    _quotaCpuPercentage = 0;
+    _throttledPeriodsPercentage = 0;
+    _throttledTimeDuringLastInterval = 0;
+    _prevNumPeriods = 0;
+    _prevNumThrottledPeriods = 0;
+    _prevThrottledTime = 0;
+
+    // The cpu subsystem is not enabled when container support is turned off with -XX:-UseContainerSupport
+    OMRPORT_ACCESS_FROM_J9PORT(jitConfig->javaVM->portLibrary);
+    if (OMR_CGROUP_SUBSYSTEM_CPU == omrsysinfo_cgroup_are_subsystems_enabled(OMR_CGROUP_SUBSYSTEM_CPU))
+        _isFunctional = readMetrics(_prevNumPeriods, _prevNumThrottledPeriods, _prevThrottledTime);
+}
+
+// Reads the quota, and the throttling statistics which are only present when the cpu
+// controller is enabled; missing statistics are treated as 0
+bool TR_CgroupCpuQuota::readMetrics(uint64_t &numPeriods, uint64_t &numThrottledPeriods, uint64_t &throttledTime)
+{
+    OMRPORT_ACCESS_FROM_J9PORT(_jitConfig->javaVM->portLibrary);
+    OMRCgroupMetricIteratorState state = { 0 };
+    if (0 != omrsysinfo_cgroup_subsystem_iterator_init(OMR_CGROUP_SUBSYSTEM_CPU, &state))
+        return false;
+
+    int64_t quota = -1; // "max" or -1 when there is no quota
+    int64_t period = 0;
+    bool foundQuota = false;
+    numPeriods = 0;
+    numThrottledPeriods = 0;
+    throttledTime = 0;
+    while (0 != omrsysinfo_cgroup_subsystem_iterator_hasNext(&state)) {
+        const char *key = NULL;
+        OMRCgroupMetricElement element = { 0 };
+        if (0 != omrsysinfo_cgroup_subsystem_iterator_metricKey(&state, &key)
+            || 0 != omrsysinfo_cgroup_subsystem_iterator_next(&state, &element) || NULL == key)
+            continue;
+
+        if (0 == strcmp(key, CGROUP_CPU_QUOTA_KEY)) {
+            foundQuota = true;
+            if (0 != strncmp(element.value, "max", 3))
+                quota = strtoll(element.value, NULL, 10);
+        } else if (0 == strcmp(key, CGROUP_CPU_PERIOD_KEY)) {
+            period = strtoll(element.value, NULL, 10);
+        } else if (0 == strcmp(key, CGROUP_CPU_NUM_PERIODS_KEY)) {
+            numPeriods = strtoull(element.value, NULL, 10);
+        } else if (0 == strcmp(key, CGROUP_CPU_NUM_THROTTLED_KEY)) {
+            numThrottledPeriods = strtoull(element.value, NULL, 10);
+        } else if (0 == strcmp(key, CGROUP_CPU_THROTTLED_TIME_KEY)) {
+            throttledTime = strtoull(element.value, NULL, 10);
+            // cgroup v1 reports the throttled time in nanoseconds, v2 in microseconds
+            if (NULL != element.units && 0 == strcmp(element.units, "nanoseconds"))
+                throttledTime /= 1000;
+        }
+    }
+    omrsysinfo_cgroup_subsystem_iterator_destroy(&state);
+
+    if (!foundQuota)
+        return false;
+
+    if (quota > 0 && period > 0) {
+        _quotaCpuPercentage = static_cast<int32_t>(quota * 100 / period);
+        if (_quotaCpuPercentage == 0)
+            _quotaCpuPercentage = 1;
+    } else {
+        _quotaCpuPercentage = 0;
+    }
+    return true;
+}
+
+bool TR_CgroupCpuQuota::update()
+{
+    if (!_isFunctional)
+        return false;
+
+    uint64_t numPeriods, numThrottledPeriods, throttledTime;
+    if (!readMetrics(numPeriods, numThrottledPeriods, throttledTime)) {
+        // The cgroup went away (e.g. after a checkpoint/restore); stop trying until init() is called again
+        _isFunctional = false;
+        _quotaCpuPercentage = 0;
+        _throttledPeriodsPercentage = 0;
+        _throttledTimeDuringLastInterval = 0;
+        return false;
+    }
+
+    // The counters only grow, unless the JVM was moved to a different cgroup
+    if (numPeriods > _prevNumPeriods && numThrottledPeriods >= _prevNumThrottledPeriods) {
+        _throttledPeriodsPercentage = static_cast<int32_t>(
+            (numThrottledPeriods - _prevNumThrottledPeriods) * 100 / (numPeriods - _prevNumPeriods));
+    } else {
+        _throttledPeriodsPercentage = 0;
+    }
+    _throttledTimeDuringLastInterval = throttledTime >= _prevThrottledTime ? throttledTime - _prevThrottledTime : 0;
+
+    _prevNumPeriods = numPeriods;
+    _prevNumThrottledPeriods = numThrottledPeriods;
+    _prevThrottledTime = throttledTime;
+    return true;
+}
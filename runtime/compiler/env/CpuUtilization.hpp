@@ -291,4 +291,39 @@ private:
     J9JITConfig *_jitConfig;
 };
 
+// Reads the CPU quota and the CFS throttling statistics of the cgroup this JVM runs in,
+// through the port library cgroup metrics of the cpu subsystem.
+// The number of target CPUs does not say how much CPU time the container may actually use,
+// nor whether the kernel has been throttling the JVM because it used up its quota.
+// Like TR_CpuEntitlement, this is embedded in TR::CompilationInfo, which is zeroed out
+// at construction time, so it cannot have virtual functions.
+struct TR_CgroupCpuQuota {
+public:
+    void init(J9JITConfig *jitConfig); // checks for the cgroup cpu subsystem and reads the initial statistics
+    bool update(); // used periodically in samplerThreadProc; returns false if the cgroup metrics cannot be read
+
+    bool isFunctional() const { return _isFunctional; }
+
+    int32_t getQuotaCpuPercentage() const { return _quotaCpuPercentage; } // 100 per CPU of quota; 0 if no quota
+
+    int32_t getThrottledPeriodsPercentage() const
+    {
+        return _throttledPeriodsPercentage;
+    } // percentage of CFS periods throttled during the last update interval
+
+    uint64_t getThrottledTimeDuringLastInterval() const { return _throttledTimeDuringLastInterval; } // usec
+
+private:
+    bool readMetrics(uint64_t &numPeriods, uint64_t &numThrottledPeriods, uint64_t &throttledTime);
+
+    J9JITConfig *_jitConfig;
+    bool _isFunctional;
+    int32_t _quotaCpuPercentage;
+    int32_t _throttledPeriodsPercentage;
+    uint64_t _prevNumPeriods;
+    uint64_t _prevNumThrottledPeriods;
+    uint64_t _prevThrottledTime; // usec
+    uint64_t _throttledTimeDuringLastInterval; // usec
+};
+
 #endif // CPUUTILIZATION_HPP
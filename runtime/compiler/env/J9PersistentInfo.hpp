@@ -48,6 +48,10 @@ class TR_PersistentClassLoaderTable;
 class TR_AOTDependencyTable;
 class TR_MHJ2IThunkTable;
 
+namespace TR {
+class SymbolValidationCache;
+}
+
 namespace J9 {
 class Options;
 }
@@ -162,6 +166,7 @@ public:
         , _runtimeInstrumentationEnabled(false)
         , _runtimeInstrumentationRecompilationEnabled(false)
         , _aotDependencyTable(NULL)
+        , _symbolValidationCache(NULL)
         , _trackAOTDependencies(false)
         ,
 #if defined(J9VM_OPT_JITSERVER)
@@ -197,6 +202,10 @@ public:
 
     TR_AOTDependencyTable *getAOTDependencyTable() const { return _aotDependencyTable; }
 
+    void setSymbolValidationCache(TR::SymbolValidationCache *cache) { _symbolValidationCache = cache; }
+
+    TR::SymbolValidationCache *getSymbolValidationCache() const { return _symbolValidationCache; }
+
     TR_OpaqueClassBlock **getVisitedSuperClasses() { return _visitedSuperClasses; }
 
     void clearVisitedSuperClasses()
@@ -504,6 +513,8 @@ private:
 
     TR_AOTDependencyTable *_aotDependencyTable;
 
+    TR::SymbolValidationCache *_symbolValidationCache;
+
     // these fields are RW
 
     TR_OpaqueClassBlock **_visitedSuperClasses;
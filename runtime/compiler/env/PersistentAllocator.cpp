@@ -39,8 +39,12 @@
 #endif // MADV_PAGEOUT
 #endif // LINUX
 
+extern char *feGetEnv2(const char *, const void *);
+
 namespace J9 {
 
+thread_local PersistentAllocator::ThreadCache PersistentAllocator::_threadCaches[PersistentAllocator::MAX_THREAD_CACHES];
+
 PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationKit)
     : _minimumSegmentSize(creationKit.minimumSegmentSize)
     , _segmentAllocator(
@@ -61,6 +65,7 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
 #endif
     _segments(SegmentContainerAllocator(RawAllocator(&creationKit.javaVM)))
     , _numSegments(0)
+    , _bucketStats()
     , _javaVM(creationKit.javaVM)
 {
     _disclaimEnabled =
@@ -68,6 +73,8 @@ PersistentAllocator::PersistentAllocator(const PersistentAllocatorKit &creationK
         !_isJITServer &&
 #endif
         (creationKit.memoryType & MEMORY_TYPE_VIRTUAL);
+    _threadCachingEnabled = creationKit.threadCaching
+        && !feGetEnv2("TR_DisablePersistentAllocatorThreadCache", &creationKit.javaVM);
     j9thread_monitor_init_with_name(&_smallBlockMonitor, 0, "JIT-PersistentAllocatorSmallBlockMonitor");
     j9thread_monitor_init_with_name(&_largeBlockMonitor, 0, "JIT-PersistentAllocatorLargeBlockMonitor");
     j9thread_monitor_init_with_name(&_segmentMonitor, 0, "JIT-PersistentAllocatorSegmentMonitor");
@@ -209,23 +216,30 @@ void *PersistentAllocator::allocateInternal(size_t requestedSize)
         j9thread_monitor_exit(_smallBlockMonitor);
     }
 
-    // If this is a small block try to allocate it from the appropriate
-    // fixed-size-block chain.
+    // If this is a small block try to allocate it from the thread's magazine
+    // or from the appropriate fixed-size-block chain.
     //
     size_t const index = freeBlocksIndex(allocSize);
     if (index != LARGE_BLOCK_LIST_INDEX) // fixed-size-block chain
     {
-        j9thread_monitor_enter(_smallBlockMonitor);
-        Block *block = _freeBlocks[index];
+        Block *block = NULL;
+        ThreadCache *cache = getThreadCache();
+        if (cache) {
+            block = allocateFromThreadCache(*cache, index);
+        } else {
+            enterMonitor(_smallBlockMonitor, index);
+            _bucketStats[index]._allocations++;
+            block = _freeBlocks[index];
+            if (block)
+                _freeBlocks[index] = block->next();
+            j9thread_monitor_exit(_smallBlockMonitor);
+        }
+
         if (block) {
-            _freeBlocks[index] = block->next();
             block->setNext(NULL);
-            j9thread_monitor_exit(_smallBlockMonitor);
             allocation = block + 1; // Return pointer after the header
         } else // Couldn't find suitable free block; need to allocate from segment
         {
-            j9thread_monitor_exit(_smallBlockMonitor);
-
             // Find the first persistent segment with enough free space
             j9thread_monitor_enter(_segmentMonitor);
             allocation = allocateFromSegmentLocked(allocSize);
@@ -233,7 +247,8 @@ void *PersistentAllocator::allocateInternal(size_t requestedSize)
         }
     } else // Variable size block allocation
     {
-        j9thread_monitor_enter(_largeBlockMonitor);
+        enterMonitor(_largeBlockMonitor, LARGE_BLOCK_LIST_INDEX);
+        _bucketStats[LARGE_BLOCK_LIST_INDEX]._allocations++;
         Block *block =
 #if defined(J9VM_OPT_JITSERVER)
             _isJITServer ? allocateFromIndexedListLocked(allocSize) :
@@ -571,6 +586,152 @@ void PersistentAllocator::checkIntegrity(const char msg[])
 }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
+void PersistentAllocator::enterMonitor(J9ThreadMonitor *monitor, size_t index)
+{
+    // Only count contention; the counter is updated once the monitor is held
+    if (j9thread_monitor_try_enter(monitor) != 0) {
+        j9thread_monitor_enter(monitor);
+        _bucketStats[index]._contendedMonitorEnters++;
+    }
+}
+
+PersistentAllocator::ThreadCache *PersistentAllocator::getThreadCache()
+{
+    if (!_threadCachingEnabled)
+        return NULL;
+
+    for (size_t i = 0; i < MAX_THREAD_CACHES; i++) {
+        ThreadCache &cache = _threadCaches[i];
+        if (cache._owner == this)
+            return &cache;
+        if (!cache._owner) {
+            cache._owner = this;
+            return &cache;
+        }
+    }
+    // This thread already holds magazines for other allocators; use the global free lists
+    return NULL;
+}
+
+PersistentAllocator::Block *PersistentAllocator::allocateFromThreadCache(ThreadCache &cache, size_t index)
+{
+    cache._allocations[index]++;
+    Block *block = cache._freeBlocks[index];
+    if (block) {
+        cache._freeBlocks[index] = block->next();
+        cache._numFreeBlocks[index]--;
+        cache._hits[index]++;
+    } else {
+        // Take one block for this request and refill the magazine with up to half
+        // of its capacity from the global list, under a single monitor enter
+        enterMonitor(_smallBlockMonitor, index);
+        addThreadCacheStatsLocked(cache, index);
+        block = _freeBlocks[index];
+        if (block) {
+            Block *first = block->next();
+            if (first) {
+                Block *last = first;
+                uint32_t numBlocks = 1;
+                while (numBlocks < THREAD_CACHE_MAGAZINE_SIZE / 2 && last->next()) {
+                    last = last->next();
+                    numBlocks++;
+                }
+                _freeBlocks[index] = last->next();
+                last->setNext(NULL);
+                cache._freeBlocks[index] = first;
+                cache._numFreeBlocks[index] = numBlocks;
+            } else {
+                _freeBlocks[index] = NULL;
+            }
+        }
+        j9thread_monitor_exit(_smallBlockMonitor);
+    }
+
+    if (++cache._operationsSinceFlush >= THREAD_CACHE_FLUSH_INTERVAL)
+        flushThreadCache(cache);
+    return block;
+}
+
+void PersistentAllocator::freeToThreadCache(ThreadCache &cache, Block *block, size_t index)
+{
+    if (cache._numFreeBlocks[index] >= THREAD_CACHE_MAGAZINE_SIZE) {
+        // Magazine is full; give half of it back so that other threads can reuse those blocks
+        enterMonitor(_smallBlockMonitor, index);
+        returnThreadCacheBlocksLocked(cache, index, THREAD_CACHE_MAGAZINE_SIZE / 2);
+        addThreadCacheStatsLocked(cache, index);
+        j9thread_monitor_exit(_smallBlockMonitor);
+    }
+    block->setNext(cache._freeBlocks[index]);
+    cache._freeBlocks[index] = block;
+    cache._numFreeBlocks[index]++;
+
+    if (++cache._operationsSinceFlush >= THREAD_CACHE_FLUSH_INTERVAL)
+        flushThreadCache(cache);
+}
+
+void PersistentAllocator::returnThreadCacheBlocksLocked(ThreadCache &cache, size_t index, uint32_t numBlocks)
+{
+    // _smallBlockMonitor must be held
+    for (uint32_t i = 0; i < numBlocks && cache._freeBlocks[index]; i++) {
+        Block *block = cache._freeBlocks[index];
+        cache._freeBlocks[index] = block->next();
+        cache._numFreeBlocks[index]--;
+        freeFixedSizeBlock(block);
+    }
+}
+
+void PersistentAllocator::addThreadCacheStatsLocked(ThreadCache &cache, size_t index)
+{
+    // _smallBlockMonitor must be held
+    _bucketStats[index]._allocations += cache._allocations[index];
+    _bucketStats[index]._threadCacheHits += cache._hits[index];
+    cache._allocations[index] = 0;
+    cache._hits[index] = 0;
+}
+
+void PersistentAllocator::flushThreadCache(ThreadCache &cache)
+{
+    j9thread_monitor_enter(_smallBlockMonitor);
+    for (size_t index = LARGE_BLOCK_LIST_INDEX + 1; index < PERSISTENT_BLOCK_SIZE_BUCKETS; index++) {
+        returnThreadCacheBlocksLocked(cache, index, cache._numFreeBlocks[index]);
+        addThreadCacheStatsLocked(cache, index);
+    }
+    j9thread_monitor_exit(_smallBlockMonitor);
+    cache._operationsSinceFlush = 0;
+}
+
+void PersistentAllocator::flushThreadCache()
+{
+    // Do not claim a magazine here: a thread that never cached blocks for this allocator has nothing to return
+    for (size_t i = 0; i < MAX_THREAD_CACHES; i++) {
+        if (_threadCaches[i]._owner == this) {
+            flushThreadCache(_threadCaches[i]);
+            return;
+        }
+    }
+}
+
+void PersistentAllocator::printStatisticsToVlog()
+{
+    // Counters are read without synchronization and exclude what threads have not flushed yet,
+    // so the numbers may be a little off
+    TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "\tPersistent allocator %p stats (thread caching %s):", this,
+        _threadCachingEnabled ? "enabled" : "disabled");
+    for (size_t index = 0; index < PERSISTENT_BLOCK_SIZE_BUCKETS; index++) {
+        const BucketStats &stats = _bucketStats[index];
+        if (stats._allocations == 0 && stats._contendedMonitorEnters == 0)
+            continue;
+        if (index == LARGE_BLOCK_LIST_INDEX)
+            TR_VerboseLog::writeLine(TR_Vlog_MEMORY, "\tBucket=large allocated=%llu contended=%llu",
+                (unsigned long long)stats._allocations, (unsigned long long)stats._contendedMonitorEnters);
+        else
+            TR_VerboseLog::writeLine(TR_Vlog_MEMORY,
+                "\tBucket=%" OMR_PRIuSIZE " blockSize=%" OMR_PRIuSIZE " allocated=%llu threadCacheHits=%llu contended=%llu", index,
+                sizeof(Block) + index * sizeof(void *), (unsigned long long)stats._allocations,
+                (unsigned long long)stats._threadCacheHits, (unsigned long long)stats._contendedMonitorEnters);
+    }
+}
+
 void PersistentAllocator::freeBlock(Block *block)
 {
     TR_ASSERT(block->size() > 0, "Block size is non-positive");
@@ -589,11 +750,16 @@ void PersistentAllocator::freeBlock(Block *block)
     //
     size_t const index = freeBlocksIndex(block->size());
     if (index > LARGE_BLOCK_LIST_INDEX) {
-        j9thread_monitor_enter(_smallBlockMonitor);
-        freeFixedSizeBlock(block);
-        j9thread_monitor_exit(_smallBlockMonitor);
+        ThreadCache *cache = getThreadCache();
+        if (cache) {
+            freeToThreadCache(*cache, block, index);
+        } else {
+            enterMonitor(_smallBlockMonitor, index);
+            freeFixedSizeBlock(block);
+            j9thread_monitor_exit(_smallBlockMonitor);
+        }
     } else {
-        j9thread_monitor_enter(_largeBlockMonitor);
+        enterMonitor(_largeBlockMonitor, LARGE_BLOCK_LIST_INDEX);
 #if defined(J9VM_OPT_JITSERVER)
         if (_isJITServer)
             freeBlockToIndexedList(block);
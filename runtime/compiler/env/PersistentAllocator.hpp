@@ -89,6 +89,15 @@ public:
     // be sure that these segments are not actually in use in that case.
     void adviseDontNeedSegments();
 
+    // Return the small blocks cached by the calling thread for this allocator to the global
+    // free lists. Threads that stop allocating for a while, or are about to exit, must call
+    // this so that their cached blocks can be reused by other threads.
+    void flushThreadCache();
+
+    // Write the per-bucket allocation, thread cache and monitor contention counters to the
+    // verbose log. The caller must hold the verbose log lock.
+    void printStatisticsToVlog();
+
 private:
     // Persistent block header
     //
@@ -129,6 +138,41 @@ private:
         return candidateBucket < PERSISTENT_BLOCK_SIZE_BUCKETS ? candidateBucket : LARGE_BLOCK_LIST_INDEX;
     }
 
+    // Per-thread magazines of free fixed-size blocks. Most small allocations and frees are
+    // satisfied from the calling thread's magazine without entering _smallBlockMonitor;
+    // magazines are refilled from, and overflow back to, _freeBlocks[] in batches.
+    struct ThreadCache {
+        PersistentAllocator *_owner;
+        Block *_freeBlocks[PERSISTENT_BLOCK_SIZE_BUCKETS];
+        uint32_t _numFreeBlocks[PERSISTENT_BLOCK_SIZE_BUCKETS];
+        uint32_t _allocations[PERSISTENT_BLOCK_SIZE_BUCKETS]; // not yet added to _bucketStats
+        uint32_t _hits[PERSISTENT_BLOCK_SIZE_BUCKETS]; // not yet added to _bucketStats
+        uint32_t _operationsSinceFlush;
+    };
+
+    // Number of thread-caching allocators a single thread can hold magazines for
+    static const size_t MAX_THREAD_CACHES = 2;
+    static const uint32_t THREAD_CACHE_MAGAZINE_SIZE = 32;
+    // Magazines are returned to the global free lists after this many operations
+    // so that blocks do not stay stranded in threads that only free
+    static const uint32_t THREAD_CACHE_FLUSH_INTERVAL = 8192;
+
+    static thread_local ThreadCache _threadCaches[MAX_THREAD_CACHES];
+
+    struct BucketStats {
+        uint64_t _allocations;
+        uint64_t _threadCacheHits;
+        uint64_t _contendedMonitorEnters;
+    };
+
+    ThreadCache *getThreadCache();
+    Block *allocateFromThreadCache(ThreadCache &cache, size_t index);
+    void freeToThreadCache(ThreadCache &cache, Block *block, size_t index);
+    void returnThreadCacheBlocksLocked(ThreadCache &cache, size_t index, uint32_t numBlocks);
+    void addThreadCacheStatsLocked(ThreadCache &cache, size_t index);
+    void flushThreadCache(ThreadCache &cache);
+    void enterMonitor(J9ThreadMonitor *monitor, size_t index);
+
     void *allocateInternal(size_t);
     Block *allocateFromVariableSizeListLocked(size_t allocSize);
     void *allocateFromSegmentLocked(size_t allocSize);
@@ -149,6 +193,10 @@ private:
     SegmentContainer _segments;
     int _numSegments;
     bool _disclaimEnabled;
+    bool _threadCachingEnabled;
+    // Entries for fixed-size buckets are updated under _smallBlockMonitor,
+    // the entry for LARGE_BLOCK_LIST_INDEX under _largeBlockMonitor
+    BucketStats _bucketStats[PERSISTENT_BLOCK_SIZE_BUCKETS];
     const J9JavaVM &_javaVM;
 
 #if defined(J9VM_OPT_JITSERVER)
@@ -42,15 +42,19 @@ struct J9JavaVM;
 namespace J9 {
 
 struct PersistentAllocatorKit {
-    PersistentAllocatorKit(size_t const minimumSegmentSize, J9JavaVM &javaVM, uint32_t memType = 0)
+    PersistentAllocatorKit(size_t const minimumSegmentSize, J9JavaVM &javaVM, uint32_t memType = 0,
+        bool threadCaching = false)
         : minimumSegmentSize(minimumSegmentSize)
         , javaVM(javaVM)
         , memoryType(memType)
+        , threadCaching(threadCaching)
     {}
 
     size_t const minimumSegmentSize;
     J9JavaVM &javaVM;
     uint32_t memoryType; // extra flags to be passed to the persistent allocator
+    // Cache small free blocks per thread; only for allocators that outlive every thread using them
+    bool threadCaching;
 };
 
 } // namespace J9
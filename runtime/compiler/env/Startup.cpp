@@ -33,7 +33,7 @@ bool initializeJIT(J9JavaVM *vm)
     try {
         // Allocate the host environment structure
         //
-        TR::Compiler = new (rawAllocator) TR::CompilerEnv(vm, rawAllocator, (TR::PersistentAllocatorKit(1 << 20, *vm)));
+        TR::Compiler = new (rawAllocator) TR::CompilerEnv(vm, rawAllocator, (TR::PersistentAllocatorKit(1 << 20, *vm, 0, true)));
     } catch (const std::bad_alloc &ba) {
         return false;
     }
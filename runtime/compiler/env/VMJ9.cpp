@@ -5224,8 +5224,9 @@ TR::CodeCache *TR_J9VMBase::getDesignatedCodeCache(TR::Compilation *comp) // MCT
     bool hadClassUnloadMonitor;
     bool hadVMAccess = releaseClassUnloadMonitorAndAcquireVMaccessIfNeeded(comp, &hadClassUnloadMonitor);
 
+    bool isHotCode = TR::CodeCacheManager::isHotCodeCompilation(comp);
     TR::CodeCache *result = TR::CodeCacheManager::instance()->reserveCodeCache(false, 0, compThreadID, &numReserved,
-        comp->codeCacheKind());
+        comp->codeCacheKind(), isHotCode);
 
     acquireClassUnloadMonitorAndReleaseVMAccessIfNeeded(comp, hadVMAccess, hadClassUnloadMonitor);
     if (!result) {
@@ -145,8 +145,16 @@ TR_ResolvedMethod *TR_J9ServerVM::createResolvedMethodWithSignature(TR_Memory *t
         }
 #endif
     } else {
-        result = new (trMemory->trHeapMemory())
-            TR_ResolvedJ9JITServerMethod(aMethod, this, trMemory, owningMethod, vTableSlot);
+        // The client may have sent the mirror of the method being compiled with the compilation request
+        auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_compInfoPT);
+        TR_ResolvedJ9JITServerMethodInfo methodInfo;
+        if (!owningMethod && !vTableSlot && !classForNewInstance
+            && compInfoPT->getPrefetchedMirror(aMethod, methodInfo))
+            result = new (trMemory->trHeapMemory())
+                TR_ResolvedJ9JITServerMethod(aMethod, this, trMemory, methodInfo, owningMethod);
+        else
+            result = new (trMemory->trHeapMemory())
+                TR_ResolvedJ9JITServerMethod(aMethod, this, trMemory, owningMethod, vTableSlot);
         if (classForNewInstance) {
             result->setClassForNewInstance((J9Class *)classForNewInstance);
             TR_ASSERT(result->isNewInstanceImplThunk(),
@@ -1610,6 +1610,7 @@ void TR_ResolvedJ9JITServerMethod::cacheResolvedMethodsCallees(int32_t ttlForUnr
     // If resolved method corresponding to an invoke is not cached, add it
     // to the list of methods that will be sent to the client in one batch.
     auto compInfoPT = (TR::CompilationInfoPerThreadRemote *)_fe->_compInfoPT;
+    compInfoPT->cachePrefetchedResolvedMethods(this, ttlForUnresolved);
     TR_J9ByteCodeIterator bci(0, this, fej9(), compInfoPT->getCompilation());
     std::vector<int32_t> cpIndices;
     std::vector<TR_ResolvedMethodType> methodTypes;
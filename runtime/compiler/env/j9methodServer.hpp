@@ -76,6 +76,14 @@ enum TR_ResolvedMethodType {
     NoType
 };
 
+// Answers the client sends ahead of time with a compilation request: the mirror of the method
+// being compiled, followed by the resolved callees that the server asked for in one batch the
+// last time it compiled that method (types, cpIndices, ramMethods, vTableOffsets, methodInfos
+// and unresolvedInCPs, as in ResolvedMethod_getMultipleResolvedMethods)
+using TR_ResolvedJ9JITServerPrefetchInfo = std::tuple<TR_ResolvedJ9JITServerMethodInfo,
+    std::vector<TR_ResolvedMethodType>, std::vector<int32_t>, std::vector<TR_OpaqueMethodBlock *>,
+    std::vector<uint32_t>, std::vector<TR_ResolvedJ9JITServerMethodInfo>, std::vector<char> >;
+
 struct TR_ResolvedMethodKey {
     TR_ResolvedMethodType type;
     TR_OpaqueClassBlock *ramClass;
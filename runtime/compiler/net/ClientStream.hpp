@@ -139,7 +139,12 @@ public:
 
     VersionCheckStatus getVersionCheckStatus() { return _versionCheckStatus; }
 
-    void setVersionCheckStatus() { _versionCheckStatus = PASSED; }
+    void setVersionCheckStatus()
+    {
+        _versionCheckStatus = PASSED;
+        // The server runs the same protocol version, so it understands compressed frames
+        advertiseCompression();
+    }
 
     /**
        @brief Function called when JITServer was discovered to be incompatible with the client
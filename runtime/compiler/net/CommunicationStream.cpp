@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AtomicSupport.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
@@ -31,12 +32,36 @@ uint32_t CommunicationStream::CONFIGURATION_FLAGS = 0;
 
 uint32_t CommunicationStream::_msgTypeCount[] = { 0 };
 uint64_t CommunicationStream::_totalMsgSize = 0;
+volatile uintptr_t CommunicationStream::_numCompressedMsgs = 0;
+volatile uintptr_t CommunicationStream::_compressionBytesSaved = 0;
+uint32_t CommunicationStream::_compressionThreshold[] = { 0 };
 uint32_t CommunicationStream::_lastReadError = 0;
 uint32_t CommunicationStream::_numConsecutiveReadErrorsOfSameType = 0;
 #if defined(MESSAGE_SIZE_STATS)
 TR_Stats CommunicationStream::_msgSizeStats[];
 #endif /* defined(MESSAGE_SIZE_STATS) */
 
+CommunicationStream::CommunicationStream()
+    : _ssl(NULL)
+    , _connfd(-1)
+    , _compressionEnabled(TR::Options::_jitserverMessageCompression)
+    , _advertiseCompression(false)
+    , _peerAcceptsCompression(false)
+    , _compressionBuffer(NULL)
+{}
+
+CommunicationStream::~CommunicationStream()
+{
+    if (_ssl)
+        (*OBIO_free_all)(_ssl);
+    if (_connfd != -1)
+        close(_connfd);
+    if (_compressionBuffer) {
+        _compressionBuffer->~MessageBuffer();
+        TR::Compiler->persistentGlobalAllocator().deallocate(_compressionBuffer);
+    }
+}
+
 void CommunicationStream::initConfigurationFlags()
 {
     if (TR::Compiler->target.is64Bit() && TR::Options::useCompressedPointers()) {
@@ -78,7 +103,8 @@ void CommunicationStream::readMessage(Message &msg)
     }
 
     // bytesRead >= sizeof(uint32_t)
-    uint32_t serializedSize = ((uint32_t *)buffer)[0];
+    uint32_t frameHeader = ((uint32_t *)buffer)[0];
+    uint32_t serializedSize = frameHeader & FRAME_SIZE_MASK;
     if (bytesRead > serializedSize) {
         throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
     }
@@ -98,6 +124,11 @@ void CommunicationStream::readMessage(Message &msg)
         readBlocking(buffer + bytesRead, bytesLeftToRead);
     }
 
+    _peerAcceptsCompression = (frameHeader & FRAME_ACCEPTS_COMPRESSION) != 0;
+    uint32_t frameSize = serializedSize;
+    if (frameHeader & FRAME_COMPRESSED)
+        serializedSize = decompressFrame(msg, frameSize);
+
     msg.setSerializedSize(serializedSize);
 
     // rebuild the message
@@ -105,7 +136,7 @@ void CommunicationStream::readMessage(Message &msg)
 
     // Update message count and size statistics
     _msgTypeCount[msg.type()] += 1;
-    _totalMsgSize += serializedSize;
+    _totalMsgSize += frameSize; // Bytes actually received
 #if defined(MESSAGE_SIZE_STATS)
     _msgSizeStats[msg.type()].update(serializedSize);
 #endif /* defined(MESSAGE_SIZE_STATS) */
@@ -114,11 +145,103 @@ void CommunicationStream::readMessage(Message &msg)
 void CommunicationStream::writeMessage(Message &msg)
 {
     char *serialMsg = msg.serialize();
+    uint32_t serializedSize = msg.serializedSize();
+    TR_ASSERT_FATAL(serializedSize <= FRAME_SIZE_MASK, "Message of size %u is too large to be sent", serializedSize);
+
+    // A server only advertises compression to a client that advertised it first
+    uint32_t frameFlags
+        = (_compressionEnabled && (_advertiseCompression || _peerAcceptsCompression)) ? FRAME_ACCEPTS_COMPRESSION : 0;
+
+    if (shouldCompress(msg.type(), serializedSize)) {
+        uint32_t frameSize = compressFrame(serialMsg, serializedSize, msg.type());
+        if (frameSize) {
+            char *frame = _compressionBuffer->getBufferStart();
+            ((uint32_t *)frame)[0] = frameSize | FRAME_COMPRESSED | frameFlags;
+            ((uint32_t *)frame)[1] = serializedSize;
+            writeBlocking(frame, frameSize);
+            msg.clearForWrite();
+            return;
+        }
+    }
+
     // write serialized message to the socket
-    writeBlocking(serialMsg, msg.serializedSize());
+    ((uint32_t *)serialMsg)[0] |= frameFlags;
+    writeBlocking(serialMsg, serializedSize);
     msg.clearForWrite();
 }
 
+bool CommunicationStream::shouldCompress(MessageType type, uint32_t serializedSize) const
+{
+    return _compressionEnabled && _peerAcceptsCompression
+        && (serializedSize >= (uint32_t)TR::Options::_jitserverMessageCompressionThreshold)
+        && (serializedSize >= _compressionThreshold[type]);
+}
+
+MessageBuffer *CommunicationStream::getCompressionBuffer()
+{
+    if (!_compressionBuffer)
+        _compressionBuffer = new (TR::Compiler->persistentGlobalAllocator()) MessageBuffer();
+    return _compressionBuffer;
+}
+
+uint32_t CommunicationStream::compressFrame(const char *serialMsg, uint32_t serializedSize, MessageType type)
+{
+    // Compression must save at least 1/8 of the message to be worth the work on the other side
+    uint32_t maxFrameSize = serializedSize - (serializedSize >> 3);
+    if (maxFrameSize <= COMPRESSED_FRAME_HEADER_SIZE)
+        return 0;
+
+    MessageBuffer *scratch = getCompressionBuffer();
+    scratch->clear();
+    scratch->expandIfNeeded(maxFrameSize);
+
+    // The size word is not compressed; it is replaced by the frame header
+    uint32_t compressedSize = MessageCompression::compress(serialMsg + sizeof(uint32_t),
+        serializedSize - sizeof(uint32_t), scratch->getBufferStart() + COMPRESSED_FRAME_HEADER_SIZE,
+        maxFrameSize - COMPRESSED_FRAME_HEADER_SIZE);
+    if (!compressedSize) {
+        // Only try this type again for messages at least twice as large
+        _compressionThreshold[type] = (serializedSize <= (FRAME_SIZE_MASK >> 1)) ? serializedSize * 2 : FRAME_SIZE_MASK;
+        return 0;
+    }
+
+    uint32_t frameSize = compressedSize + COMPRESSED_FRAME_HEADER_SIZE;
+    VM_AtomicSupport::add(&_numCompressedMsgs, 1);
+    VM_AtomicSupport::add(&_compressionBytesSaved, serializedSize - frameSize);
+    return frameSize;
+}
+
+uint32_t CommunicationStream::decompressFrame(Message &msg, uint32_t frameSize)
+{
+    if (frameSize < COMPRESSED_FRAME_HEADER_SIZE)
+        throw JITServer::StreamFailure("JITServer I/O error: truncated compressed message");
+
+    char *frame = msg.getBufferStartForRead();
+    uint32_t serializedSize = ((uint32_t *)frame)[1];
+    uint32_t compressedSize = frameSize - COMPRESSED_FRAME_HEADER_SIZE;
+    if ((serializedSize < sizeof(uint32_t)) || (serializedSize > FRAME_SIZE_MASK))
+        throw JITServer::StreamFailure("JITServer I/O error: invalid size of compressed message");
+
+    // The message buffer is about to be overwritten with the decompressed message
+    MessageBuffer *scratch = getCompressionBuffer();
+    scratch->clear();
+    scratch->expandIfNeeded(compressedSize);
+    memcpy(scratch->getBufferStart(), frame + COMPRESSED_FRAME_HEADER_SIZE, compressedSize);
+
+    if (serializedSize > msg.getBufferCapacity())
+        msg.expandBuffer(serializedSize, 0);
+
+    char *buffer = msg.getBufferStartForRead();
+    if (!MessageCompression::decompress(scratch->getBufferStart(), compressedSize, buffer + sizeof(uint32_t),
+            serializedSize - sizeof(uint32_t)))
+        throw JITServer::StreamFailure("JITServer I/O error: malformed compressed message");
+
+    VM_AtomicSupport::add(&_numCompressedMsgs, 1);
+    if (serializedSize > frameSize)
+        VM_AtomicSupport::add(&_compressionBytesSaved, serializedSize - frameSize);
+    return serializedSize;
+}
+
 std::string CommunicationStream::showFullVersionIncompatibility(uint64_t serverFullVersion, uint64_t clientFullVersion)
 {
     // See JITServer::Message::buildFullVersion() and CommunicationStream::initConfigurationFlags() for the encoding
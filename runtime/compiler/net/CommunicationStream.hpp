@@ -27,6 +27,7 @@
 #include "infra/Statistics.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/Message.hpp"
+#include "net/MessageCompression.hpp"
 #include "net/StreamExceptions.hpp"
 #include "env/VerboseLog.hpp"
 #include "control/MethodToBeCompiled.hpp"
@@ -46,6 +47,8 @@ public:
 
     static uint32_t _msgTypeCount[MessageType::MessageType_MAXTYPE];
     static uint64_t _totalMsgSize;
+    static volatile uintptr_t _numCompressedMsgs; // Compressed frames sent and received; updated atomically
+    static volatile uintptr_t _compressionBytesSaved; // Bytes kept off the wire by compressing frames, in both directions; updated atomically
     static uint32_t _lastReadError;
     static uint32_t _numConsecutiveReadErrorsOfSameType;
     // The max read retry should be 1 less than the max compile attempt so we do
@@ -86,18 +89,9 @@ public:
     static bool shouldReadRetry() { return (_numConsecutiveReadErrorsOfSameType < MAX_READ_RETRY); }
 
 protected:
-    CommunicationStream()
-        : _ssl(NULL)
-        , _connfd(-1)
-    {}
+    CommunicationStream();
 
-    virtual ~CommunicationStream()
-    {
-        if (_ssl)
-            (*OBIO_free_all)(_ssl);
-        if (_connfd != -1)
-            close(_connfd);
-    }
+    virtual ~CommunicationStream();
 
     void initStream(int connfd, BIO *ssl)
     {
@@ -112,11 +106,26 @@ protected:
 
     int getConnFD() const { return _connfd; }
 
+    /**
+       @brief Start advertising to the peer that compressed frames can be received on this stream.
+
+       Only called by the client once the server is known to run the same protocol version;
+       the server only advertises in reply to a client that did.
+    */
+    void advertiseCompression() { _advertiseCompression = _compressionEnabled; }
+
     BIO *_ssl; // SSL connection, null if not using SSL
     int _connfd;
     ServerMessage _sMsg;
     ClientMessage _cMsg;
 
+    // The two most significant bits of the size word that starts every frame are flags.
+    // A compressed frame is followed by the size of the serialized message it decompresses to.
+    static const uint32_t FRAME_COMPRESSED = 0x80000000;
+    static const uint32_t FRAME_ACCEPTS_COMPRESSION = 0x40000000;
+    static const uint32_t FRAME_SIZE_MASK = 0x3FFFFFFF;
+    static const uint32_t COMPRESSED_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
     // When increasing a version number here (especially MINOR_NUMBER), please
     // also change the ID comment to a unique value, preferably one that has
     // been randomly generated, e.g. using
@@ -128,11 +137,25 @@ protected:
     // likely to lose an increment when merging/rebasing/etc.
     //
     static const uint8_t MAJOR_NUMBER = 1;
-    static const uint16_t MINOR_NUMBER = 101; // ID: fd7QYgAKTKgrQL6Fxs+7
+    static const uint16_t MINOR_NUMBER = 103; // ID: MSQxwLyzFg3JSaatD3j3
     static const uint8_t PATCH_NUMBER = 0;
     static uint32_t CONFIGURATION_FLAGS;
 
 private:
+    bool shouldCompress(MessageType type, uint32_t serializedSize) const;
+    uint32_t compressFrame(const char *serialMsg, uint32_t serializedSize, MessageType type);
+    uint32_t decompressFrame(Message &msg, uint32_t frameSize);
+    MessageBuffer *getCompressionBuffer();
+
+    // Messages of a given type smaller than this are sent uncompressed. Raised for
+    // types whose messages turn out not to compress well.
+    static uint32_t _compressionThreshold[MessageType::MessageType_MAXTYPE];
+
+    bool _compressionEnabled; // This side is configured to use compression
+    bool _advertiseCompression; // Outgoing frames tell the peer that compressed frames are accepted
+    bool _peerAcceptsCompression; // The last frame read from the peer accepted compressed frames
+    MessageBuffer *_compressionBuffer; // Scratch space for (de)compressing frames, allocated on first use
+
     void readBlocking(char *data, size_t size)
     {
         size_t totalBytesRead = 0;
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "net/MessageCompression.hpp"
+#include <cstring>
+
+namespace JITServer {
+
+static inline uint32_t read32(const char *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Write a nibble overflow as a run of 255s followed by the remainder.
+// Returns the new output cursor, or NULL if the output is full.
+static inline char *writeLength(char *op, const char *oend, uint32_t length)
+{
+    while (length >= 255) {
+        if (op >= oend)
+            return NULL;
+        *op++ = (char)255;
+        length -= 255;
+    }
+    if (op >= oend)
+        return NULL;
+    *op++ = (char)length;
+    return op;
+}
+
+// Emit one block: literals [anchor, anchor + literalLength) followed by a match, if matchLength != 0.
+static char *writeBlock(char *op, const char *oend, const char *anchor, uint32_t literalLength, uint32_t distance,
+    uint32_t matchLength, uint32_t minMatch)
+{
+    if (op >= oend)
+        return NULL;
+    char *token = op++;
+    uint8_t tokenValue = (uint8_t)((literalLength < 15 ? literalLength : 15) << 4);
+    if (literalLength >= 15) {
+        op = writeLength(op, oend, literalLength - 15);
+        if (!op)
+            return NULL;
+    }
+    if ((uint32_t)(oend - op) < literalLength)
+        return NULL;
+    memcpy(op, anchor, literalLength);
+    op += literalLength;
+
+    if (matchLength != 0) {
+        if ((oend - op) < 2)
+            return NULL;
+        *op++ = (char)(distance & 0xFF);
+        *op++ = (char)(distance >> 8);
+        uint32_t code = matchLength - minMatch;
+        tokenValue |= (uint8_t)(code < 15 ? code : 15);
+        if (code >= 15) {
+            op = writeLength(op, oend, code - 15);
+            if (!op)
+                return NULL;
+        }
+    }
+    *token = (char)tokenValue;
+    return op;
+}
+
+uint32_t MessageCompression::compress(const char *src, uint32_t srcSize, char *dst, uint32_t dstCapacity)
+{
+    uint32_t table[1 << HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    const char *oend = dst + dstCapacity;
+    char *op = dst;
+    uint32_t anchor = 0;
+    uint32_t ip = 0;
+
+    if (srcSize > MIN_MATCH + LAST_LITERALS) {
+        uint32_t matchLimit = srcSize - LAST_LITERALS;
+        while (ip + MIN_MATCH <= matchLimit) {
+            uint32_t sequence = read32(src + ip);
+            uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+            uint32_t ref = table[hash];
+            table[hash] = ip;
+
+            if ((ref < ip) && ((ip - ref) <= MAX_DISTANCE) && (read32(src + ref) == sequence)) {
+                uint32_t matchLength = MIN_MATCH;
+                while ((ip + matchLength < matchLimit) && (src[ref + matchLength] == src[ip + matchLength]))
+                    matchLength++;
+
+                op = writeBlock(op, oend, src + anchor, ip - anchor, ip - ref, matchLength, MIN_MATCH);
+                if (!op)
+                    return 0;
+                ip += matchLength;
+                anchor = ip;
+            } else {
+                ip++;
+            }
+        }
+    }
+
+    op = writeBlock(op, oend, src + anchor, srcSize - anchor, 0, 0, MIN_MATCH);
+    if (!op)
+        return 0;
+    return (uint32_t)(op - dst);
+}
+
+bool MessageCompression::decompress(const char *src, uint32_t srcSize, char *dst, uint32_t dstSize)
+{
+    const uint8_t *ip = (const uint8_t *)src;
+    const uint8_t *iend = ip + srcSize;
+    char *op = dst;
+    char *oend = dst + dstSize;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        uint32_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend)
+                    return false;
+                b = *ip++;
+                literalLength += b;
+            } while (b == 255);
+        }
+        if (((uint32_t)(iend - ip) < literalLength) || ((uint32_t)(oend - op) < literalLength))
+            return false;
+        memcpy(op, ip, literalLength);
+        op += literalLength;
+        ip += literalLength;
+
+        // The last block has no match
+        if (ip == iend)
+            break;
+
+        if ((iend - ip) < 2)
+            return false;
+        uint32_t distance = ip[0] | (ip[1] << 8);
+        ip += 2;
+        uint32_t matchLength = token & 0xF;
+        if (matchLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend)
+                    return false;
+                b = *ip++;
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += MIN_MATCH;
+
+        if ((distance == 0) || (distance > (uint32_t)(op - dst)) || ((uint32_t)(oend - op) < matchLength))
+            return false;
+        // Matches may overlap their own output, so copy byte by byte
+        const char *match = op - distance;
+        for (uint32_t i = 0; i < matchLength; i++)
+            op[i] = match[i];
+        op += matchLength;
+    }
+
+    return op == oend;
+}
+
+} // namespace JITServer
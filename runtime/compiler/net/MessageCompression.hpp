@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef MESSAGE_COMPRESSION_H
+#define MESSAGE_COMPRESSION_H
+
+#include <stdint.h>
+
+namespace JITServer {
+/**
+   @class MessageCompression
+   @brief A small, fast LZ77-style codec used to compress serialized JITServer messages.
+
+   The compressed stream is a sequence of blocks, each made of a token byte, a run of
+   literals and a back-reference into the already decoded output. The high nibble of
+   the token is the literal count and the low nibble is the match length minus
+   MIN_MATCH; a nibble of 15 means the count continues in the following bytes, each
+   of which is added to it until a byte other than 255 is seen. The back-reference is
+   a 16-bit little-endian distance. The last block only carries literals.
+
+   Messages are mostly descriptors, padding, class names and repeated pointers, so
+   even this simple greedy matcher removes a large part of their size at a cost far
+   below the network latency it saves.
+*/
+class MessageCompression {
+public:
+    /**
+       @brief Compress srcSize bytes from src into dst.
+
+       @param src Data to compress
+       @param srcSize Number of bytes to compress
+       @param dst Output buffer
+       @param dstCapacity Size of the output buffer
+
+       @return The number of bytes written to dst, or 0 if the data did not fit,
+               i.e. if compressing it is not worthwhile
+    */
+    static uint32_t compress(const char *src, uint32_t srcSize, char *dst, uint32_t dstCapacity);
+
+    /**
+       @brief Decompress srcSize bytes from src into exactly dstSize bytes at dst.
+
+       @return true on success, false if the compressed data is malformed
+    */
+    static bool decompress(const char *src, uint32_t srcSize, char *dst, uint32_t dstSize);
+
+private:
+    static const uint32_t MIN_MATCH = 4;
+    static const uint32_t LAST_LITERALS = 5; // The tail of the input is always emitted as literals
+    static const uint32_t MAX_DISTANCE = 0xFFFF;
+    static const uint32_t HASH_BITS = 12;
+};
+} // namespace JITServer
+#endif // MESSAGE_COMPRESSION_H
@@ -37,6 +37,7 @@
 #include "j9cfg.h"
 #include "rommeth.h"
 #include "vmaccess.h"
+#include "AtomicSupport.hpp"
 #include "VMHelpers.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
@@ -517,7 +518,7 @@ TR::PersistentAllocator *TR_IProfiler::createPersistentAllocator(J9JITConfig *ji
         }
     }
 #endif // LINUX
-    TR::PersistentAllocatorKit kit(1 << 20 /*1 MB*/, *(jitConfig->javaVM), memoryType);
+    TR::PersistentAllocatorKit kit(1 << 20 /*1 MB*/, *(jitConfig->javaVM), memoryType, true /* threadCaching */);
     return new (TR::Compiler->rawAllocator) TR::PersistentAllocator(kit);
 }
 
@@ -543,6 +544,12 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
     , _numRequestsDropped(0)
     , _numRequestsSkipped(0)
     , _numRequestsHandedToIProfilerThread(0)
+    , _numBuffersProcessed(0)
+    , _numBuffersDiscarded(0)
+    , _numSamplesAggregated(0)
+    , _helperThreads(NULL)
+    , _numHelperThreads(0)
+    , _numHelperThreadsAlive(0)
     , _iprofilerMonitor(NULL)
     , _crtProfilingBuffer(NULL)
     , _iprofilerNumRecords(0)
@@ -964,6 +971,8 @@ TR_IPBCDataAllocation *TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t
 TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
 {
     TR_IPBytecodeHashTableEntry *entry = NULL;
+    // Entries are only ever added at the head of a bucket; remember the head we searched from
+    TR_IPBytecodeHashTableEntry *headEntry = _bcHashTable[bucket];
 
     entry = searchForSample(pc, bucket);
     // if we are just searching and we didn't find profile data for the
@@ -990,21 +999,28 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::findOrCreateEntry(int32_t bucket, uin
     if (!entry)
         return NULL;
 
-    // While the entry is being allocated, another thread could have added an entry with the same PC.
-    // If that happened, it's likely that the duplicate entry is at the head of this list.
-    // Check to see if that's the case. This technique does not eliminate the race completely
-    // but catches most of duplicate situations.
-    TR_IPBytecodeHashTableEntry *headEntry = _bcHashTable[bucket];
-    if (headEntry && headEntry->getPC() == pc) {
-        delete entry; // Newly allocated entry is not needed
-        return headEntry;
-    }
-
-    entry->setNext(_bcHashTable[bucket]);
-    FLUSH_MEMORY(TR::Compiler->target.isSMP());
-    _bcHashTable[bucket] = entry;
+    // The IProfiler thread, its helpers and application threads can all insert into the same bucket.
+    // Publish the new entry with a compare-and-swap on the bucket head. If the head moved, another
+    // thread may have added an entry for the same PC in front of the head we searched from; if so,
+    // use that entry instead of ours.
+    while (true) {
+        entry->setNext(headEntry);
+        VM_AtomicSupport::writeBarrier();
+        TR_IPBytecodeHashTableEntry *currentHead
+            = (TR_IPBytecodeHashTableEntry *)VM_AtomicSupport::lockCompareExchange(
+                reinterpret_cast<volatile uintptr_t *>(&_bcHashTable[bucket]), (uintptr_t)headEntry,
+                (uintptr_t)entry);
+        if (currentHead == headEntry)
+            return entry;
 
-    return entry;
+        for (TR_IPBytecodeHashTableEntry *e = currentHead; e && e != headEntry; e = e->getNext()) {
+            if (e->getPC() == pc) {
+                delete entry; // Newly allocated entry is not needed
+                return e;
+            }
+        }
+        headEntry = currentHead;
+    }
 }
 
 TR_IPBCDataAllocation *TR_IProfiler::findOrCreateAllocEntry(int32_t bucket, uintptr_t pc, bool addIt)
@@ -2297,6 +2313,14 @@ void TR_IProfiler::outputStats()
             _numRequestsSkipped);
         fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n",
             _numRequestsHandedToIProfilerThread);
+        fprintf(stderr, "IProfiler: Number of handed buffers processed          =%" OMR_PRIu64 "\n",
+            _numBuffersProcessed);
+        fprintf(stderr, "IProfiler: Number of handed buffers discarded          =%" OMR_PRIu64 "\n",
+            _numBuffersDiscarded);
+        fprintf(stderr, "IProfiler: Number of iprofiler helper threads          =%d\n", _numHelperThreads);
+    }
+    if (TR::Options::_iprofilerAggregateSamples) {
+        fprintf(stderr, "IProfiler: Number of samples aggregated=%" OMR_PRIuPTR "\n", _numSamplesAggregated);
     }
     fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
     fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
@@ -3308,6 +3332,9 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void *entryarg)
 
     iProfiler->processWorkingQueue();
 
+    TR_IProfiler::allocator()->flushThreadCache();
+    TR::Compiler->persistentAllocator().flushThreadCache();
+
     vm->internalVMFunctions->DetachCurrentThread((JavaVM *)vm);
     iProfiler->setIProfilerThread(NULL);
     iProfiler->getIProfilerMonitor()->enter();
@@ -3323,6 +3350,76 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void *entryarg)
     return 0;
 }
 
+static int32_t J9THREAD_PROC iprofilerHelperThreadProc(void *entryarg)
+{
+    IProfilerHelperThread *helper = (IProfilerHelperThread *)entryarg;
+    J9JavaVM *vm = helper->_javaVM;
+    TR_IProfiler *iProfiler = helper->_iprofiler;
+    J9VMThread *helperThread = NULL;
+
+    int rc = vm->internalVMFunctions->internalAttachCurrentThread(vm, &helperThread, NULL,
+        J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT | J9_PRIVATE_FLAGS_SYSTEM_THREAD
+            | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
+        helper->_osThread);
+
+    if (rc == JNI_OK) {
+        char threadName[32];
+        snprintf(threadName, sizeof(threadName), "JIT IProfiler Helper-%d", helper->_index);
+        j9thread_set_name(j9thread_self(), threadName);
+        helper->_vmThread = helperThread;
+
+        iProfiler->processWorkingQueueOnHelperThread(helper);
+
+        // Return the persistent blocks this helper cached before its thread local magazines go away
+        TR_IProfiler::allocator()->flushThreadCache();
+        TR::Compiler->persistentAllocator().flushThreadCache();
+
+        vm->internalVMFunctions->DetachCurrentThread((JavaVM *)vm);
+    }
+
+    iProfiler->getIProfilerMonitor()->enter();
+    iProfiler->helperThreadExiting(helper);
+    j9thread_exit((J9ThreadMonitor *)iProfiler->getIProfilerMonitor()->getVMMonitor());
+
+    return (rc == JNI_OK) ? 0 : JNI_ERR;
+}
+
+void TR_IProfiler::startIProfilerHelperThreads(J9JavaVM *javaVM)
+{
+    int32_t numHelperThreads = TR::Options::_iprofilerNumHelperThreads;
+    if (numHelperThreads <= 0)
+        return;
+
+    _helperThreads = (IProfilerHelperThread *)_allocator->allocate(numHelperThreads * sizeof(IProfilerHelperThread),
+        std::nothrow);
+    if (!_helperThreads)
+        return;
+    memset(_helperThreads, 0, numHelperThreads * sizeof(IProfilerHelperThread));
+
+    OMR::CriticalSection startHelpers(_iprofilerMonitor);
+    for (int32_t i = 0; i < numHelperThreads; i++) {
+        IProfilerHelperThread *helper = _helperThreads + i;
+        helper->_iprofiler = this;
+        helper->_javaVM = javaVM;
+        helper->_index = i;
+        // A helper that fails to start is simply not counted; the others share its work
+        if (javaVM->internalVMFunctions->createThreadWithCategory(&helper->_osThread,
+                TR::Options::_profilerStackSize << 10, J9THREAD_PRIORITY_NORMAL, 0, &iprofilerHelperThreadProc, helper,
+                J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+            break;
+        _numHelperThreads++;
+        _numHelperThreadsAlive++;
+    }
+}
+
+void TR_IProfiler::helperThreadExiting(IProfilerHelperThread *helper)
+{
+    helper->_vmThread = NULL;
+    helper->_crtProfilingBuffer = NULL;
+    _numHelperThreadsAlive--;
+    _iprofilerMonitor->notifyAll();
+}
+
 void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
 {
     PORT_ACCESS_FROM_PORT(_portLib);
@@ -3354,6 +3451,8 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
             if (getIProfilerThreadLifetimeState() == TR_IProfiler::IPROF_THR_FAILED_TO_ATTACH) {
                 _iprofilerThread = NULL;
                 _iprofilerMonitor = NULL;
+            } else {
+                startIProfilerHelperThreads(javaVM);
             }
         }
     } else {
@@ -3408,6 +3507,12 @@ void TR_IProfiler::stopIProfilerThread()
         _iprofilerMonitor->wait();
     }
 
+    // Helper threads exit once they see the IProfiler thread is no longer running
+    while (_numHelperThreadsAlive > 0) {
+        _iprofilerMonitor->notifyAll();
+        _iprofilerMonitor->wait();
+    }
+
     _iprofilerMonitor->exit();
 }
 
@@ -3500,6 +3605,7 @@ void TR_IProfiler::discardFilledIProfilerBuffers()
     while (!_workingBufferList.isEmpty()) {
         _freeBufferList.add(_workingBufferList.pop());
         _numOutstandingBuffers--;
+        _numBuffersDiscarded++;
     }
     _workingBufferTail = NULL;
 }
@@ -3538,31 +3644,7 @@ void TR_IProfiler::processWorkingQueue()
             break;
         } else if (!_workingBufferList.isEmpty()) {
             // We have some buffer to process
-            // Dequeue the buffer to be processed
-            //
-            _crtProfilingBuffer = _workingBufferList.pop();
-            if (_workingBufferList.isEmpty())
-                _workingBufferTail = NULL;
-
-            // We don't need the iprofiler monitor now
-            _iprofilerMonitor->exit();
-
-            TR_ASSERT_FATAL(_crtProfilingBuffer->getSize() > 0, "size of _crtProfilingBuffer (%p) <= 0",
-                _crtProfilingBuffer);
-
-            // process the buffer after acquiring VM access
-            acquireVMAccessNoSuspend(_iprofilerThread); // blocking. Will wait for the entire GC
-            // Check to see if GC has invalidated this buffer
-            if (_crtProfilingBuffer->isValid()) {
-                parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
-            }
-            releaseVMAccess(_iprofilerThread);
-
-            // attach the buffer to the buffer pool
-            _iprofilerMonitor->enter();
-            _freeBufferList.add(_crtProfilingBuffer);
-            _crtProfilingBuffer = NULL;
-            _numOutstandingBuffers--;
+            processNextWorkingBuffer(_iprofilerThread, _crtProfilingBuffer);
         } else if (getIProfilerThreadLifetimeState() == TR_IProfiler::IPROF_THR_SUSPENDING) {
 #if defined(J9VM_OPT_CRIU_SUPPORT)
             // Check if the IProfiler Thread should be suspended for checkpoint
@@ -3594,6 +3676,54 @@ void TR_IProfiler::processWorkingQueue()
     } while (true);
 }
 
+void TR_IProfiler::processNextWorkingBuffer(J9VMThread *vmThread, IProfilerBuffer *&crtBuffer)
+{
+    // Dequeue the buffer to be processed
+    crtBuffer = _workingBufferList.pop();
+    if (_workingBufferList.isEmpty())
+        _workingBufferTail = NULL;
+
+    // We don't need the iprofiler monitor now
+    _iprofilerMonitor->exit();
+
+    TR_ASSERT_FATAL(crtBuffer->getSize() > 0, "size of profiling buffer (%p) <= 0", crtBuffer);
+
+    // process the buffer after acquiring VM access
+    acquireVMAccessNoSuspend(vmThread); // blocking. Will wait for the entire GC
+    // Check to see if GC has invalidated this buffer
+    if (crtBuffer->isValid()) {
+        parseBuffer(vmThread, crtBuffer->getBuffer(), crtBuffer->getSize());
+    }
+    releaseVMAccess(vmThread);
+
+    // attach the buffer to the buffer pool
+    _iprofilerMonitor->enter();
+    _freeBufferList.add(crtBuffer);
+    crtBuffer = NULL;
+    _numOutstandingBuffers--;
+    _numBuffersProcessed++;
+}
+
+// This method is executed by the iprofiler helper threads
+void TR_IProfiler::processWorkingQueueOnHelperThread(IProfilerHelperThread *helper)
+{
+    _iprofilerMonitor->enter();
+    while (true) {
+        TR_IprofilerThreadLifetimeStates state = getIProfilerThreadLifetimeState();
+        if (state == TR_IProfiler::IPROF_THR_STOPPING || state == TR_IProfiler::IPROF_THR_DESTROYED)
+            break;
+
+        // While the IProfiler thread is suspending or suspended for checkpoint the helpers stay idle
+        bool isRunning
+            = state == TR_IProfiler::IPROF_THR_INITIALIZED || state == TR_IProfiler::IPROF_THR_WAITING_FOR_WORK;
+        if (isRunning && !_workingBufferList.isEmpty())
+            processNextWorkingBuffer(helper->_vmThread, helper->_crtProfilingBuffer);
+        else
+            _iprofilerMonitor->wait();
+    }
+    _iprofilerMonitor->exit();
+}
+
 extern "C" void stopInterpreterProfiling(J9JITConfig *jitConfig);
 
 /* Lower value will more aggressively skip samples as the number of unloaded classes increases */
@@ -3689,6 +3819,20 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDAT
 
     bool isClassLoadPhase = _compInfo->getPersistentInfo()->isClassLoadingPhase();
 
+    // When aggregating, repeated (pc, data) pairs of this buffer are counted in a small direct-mapped
+    // table and reach the shared hashtable once per flush instead of once per sample
+    struct AggregatedSample {
+        uintptr_t pc;
+        uintptr_t data;
+        uint32_t freq;
+    };
+    const uint32_t numAggregationSlots = 64; // must be a power of 2
+    AggregatedSample aggregatedSamples[numAggregationSlots];
+    bool aggregateSamples = TR::Options::_iprofilerAggregateSamples && !verboseReparse;
+    UDATA samplesAggregated = 0;
+    if (aggregateSamples)
+        memset(aggregatedSamples, 0, sizeof(aggregatedSamples));
+
     int32_t skipCountMain = 20 + (rand() % 10); // TODO: Use the main TR_RandomGenerator from jitconfig?
     int32_t skipCount = skipCountMain;
     bool profileFlag = true;
@@ -3869,11 +4013,35 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDAT
         }
 
         if (addSample && !verboseReparse) {
-            profilingSample((uintptr_t)pc, (uintptr_t)data, true);
+            if (aggregateSamples) {
+                AggregatedSample &slot
+                    = aggregatedSamples[((uintptr_t)pc ^ ((uintptr_t)data >> 3)) & (numAggregationSlots - 1)];
+                if (slot.freq > 0 && slot.pc == (uintptr_t)pc && slot.data == (uintptr_t)data && slot.freq < 0xFFFF) {
+                    slot.freq++;
+                    samplesAggregated++;
+                } else {
+                    if (slot.freq > 0)
+                        addAggregatedSample(slot.pc, slot.data, slot.freq);
+                    slot.pc = (uintptr_t)pc;
+                    slot.data = (uintptr_t)data;
+                    slot.freq = 1;
+                }
+            } else {
+                profilingSample((uintptr_t)pc, (uintptr_t)data, true);
+            }
             records++;
         }
     }
 
+    if (aggregateSamples) {
+        for (uint32_t i = 0; i < numAggregationSlots; i++) {
+            if (aggregatedSamples[i].freq > 0)
+                addAggregatedSample(aggregatedSamples[i].pc, aggregatedSamples[i].data, aggregatedSamples[i].freq);
+        }
+        // Helper threads and application threads may parse buffers concurrently
+        VM_AtomicSupport::add(&_numSamplesAggregated, samplesAggregated);
+    }
+
     if (cursor != dataStart + size) {
         TR_ASSERT(false, "Iprofiler parser overran buffer");
         return 0;
@@ -3883,6 +4051,16 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDAT
     return records;
 }
 
+void TR_IProfiler::addAggregatedSample(uintptr_t pc, uintptr_t data, uint32_t freq)
+{
+    // Call-graph entries accept a frequency; branch and switch entries count one sample at a time
+    TR_IPBytecodeHashTableEntry *entry = profilingSample(pc, data, true, false, freq);
+    if (entry && !entry->asIPBCDataCallGraph()) {
+        for (uint32_t i = 1; i < freq; i++)
+            addSampleData(entry, data);
+    }
+}
+
 // This method should be called from Jitted code when it has a full buffer. It is called indirectly from
 // _jitProfileParseBuffer, in JitRuntime
 void TR_IProfiler::jitProfileParseBuffer(J9VMThread *currentThread)
@@ -3949,6 +4127,10 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
     // mark the current buffer as invalid; set with exclusive VM access
     if (_crtProfilingBuffer)
         _crtProfilingBuffer->setIsInvalidated(true);
+    for (int32_t i = 0; i < _numHelperThreads; i++) {
+        if (_helperThreads[i]._crtProfilingBuffer)
+            _helperThreads[i]._crtProfilingBuffer->setIsInvalidated(true);
+    }
 
     // add buffers in working queue to free list
     discardFilledIProfilerBuffers();
@@ -750,6 +750,18 @@ private:
     volatile bool _isInvalidated;
 };
 
+class TR_IProfiler;
+
+// State of a thread that parses buffers from the working queue alongside the IProfiler thread
+struct IProfilerHelperThread {
+    TR_IProfiler *_iprofiler;
+    J9JavaVM *_javaVM;
+    int32_t _index;
+    j9thread_t _osThread;
+    J9VMThread *_vmThread;
+    IProfilerBuffer *_crtProfilingBuffer; // profiling buffer being processed by this helper
+};
+
 class TR_ReadSampleRequestsStats {
     friend class TR_ReadSampleRequestsHistory;
 
@@ -977,6 +989,8 @@ public:
 
     bool processProfilingBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDATA size);
     void processWorkingQueue();
+    void processWorkingQueueOnHelperThread(IProfilerHelperThread *helper);
+    void helperThreadExiting(IProfilerHelperThread *helper);
 
     IProfilerBuffer *getCrtProfilingBuffer() const { return _crtProfilingBuffer; }
 
@@ -1105,6 +1119,29 @@ private:
      */
     void discardFilledIProfilerBuffers();
 
+    /**
+     * @brief Dequeues the first buffer of the working queue and parses it
+     *
+     * @param vmThread The thread doing the parsing
+     * @param crtBuffer Slot that exposes the buffer being parsed to invalidateProfilingBuffers()
+     *
+     * @note This method must be called with IProfiler Monitor in hand and a non-empty working queue.
+     *       The monitor is released while the buffer is parsed.
+     */
+    void processNextWorkingBuffer(J9VMThread *vmThread, IProfilerBuffer *&crtBuffer);
+
+    /**
+     * @brief Starts the threads that help the IProfiler thread drain the working queue
+     *
+     * @note The number of threads is given by TR::Options::_iprofilerNumHelperThreads
+     */
+    void startIProfilerHelperThreads(J9JavaVM *javaVM);
+
+    /**
+     * @brief Adds a sample that was seen freq times in a buffer to the hashtable
+     */
+    void addAggregatedSample(uintptr_t pc, uintptr_t data, uint32_t freq);
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
     /**
      * @brief Suspend the IProfiler Thread
@@ -1155,6 +1192,12 @@ private:
     uint64_t _numRequestsDropped;
     uint64_t _numRequestsSkipped;
     uint64_t _numRequestsHandedToIProfilerThread;
+    uint64_t _numBuffersProcessed; // buffers from the working queue parsed by the IProfiler thread or its helpers
+    uint64_t _numBuffersDiscarded; // buffers from the working queue discarded before being parsed
+    volatile uintptr_t _numSamplesAggregated; // samples folded into an earlier sample of the same buffer; updated atomically
+    IProfilerHelperThread *_helperThreads;
+    int32_t _numHelperThreads;
+    int32_t _numHelperThreadsAlive;
     uint64_t _iprofilerNumRecords; // info stats only
 
     TR_IPMethodHashTableEntry **_methodHashTable;
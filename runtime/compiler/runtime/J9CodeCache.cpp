@@ -144,6 +144,7 @@ bool J9::CodeCache::initialize(TR::CodeCacheManager *manager, TR::CodeCacheMemor
     }
 
     self()->setInitialAllocationPointers();
+    _hotCodeBytes = 0;
 
 #ifdef LINUX
     if (manager->isDisclaimEnabled()) {
@@ -391,6 +392,8 @@ void J9::CodeCache::addFreeBlock(OMR::FaintCacheBlock *block)
     }
 
     if (self()->addFreeBlock2((uint8_t *)realStartPC, (uint8_t *)endPtr)) {
+        if (metaData->flags & JIT_METADATA_IS_HOT_CODE)
+            self()->removeHotCodeBytes(endPtr - realStartPC);
         // Update the block size to reflect the remaining stub
         omrthread_jit_write_protect_disable();
         warmBlock->_size = realStartPC - (UDATA)warmBlock;
@@ -502,6 +505,8 @@ OMR::CodeCacheMethodHeader *J9::CodeCache::addFreeBlock(void *voidMetaData)
     }
 
     if (self()->addFreeBlock2((uint8_t *)warmBlock, (uint8_t *)((UDATA)warmBlock + warmBlock->_size))) {
+        if (metaData->flags & JIT_METADATA_IS_HOT_CODE)
+            self()->removeHotCodeBytes(warmBlock->_size);
     }
 
     if (metaData->startColdPC) {
@@ -713,10 +718,61 @@ void J9::CodeCache::resetAllocationPointers()
 void J9::CodeCache::resetCodeCache()
 {
     self()->resetAllocationPointers();
+    {
+        CacheCriticalSection resettingHotCodeBytes(self());
+        _hotCodeBytes = 0;
+    }
     if (_manager->codeCacheConfig().needsMethodTrampolines())
         self()->resetTrampolines();
 }
 
+void J9::CodeCache::addHotCodeBytes(size_t size)
+{
+    CacheCriticalSection updatingHotCodeBytes(self());
+    _hotCodeBytes += size;
+}
+
+void J9::CodeCache::removeHotCodeBytes(size_t size)
+{
+    // The code cache mutex is recursive, so this is safe whether or not the caller already holds it
+    CacheCriticalSection updatingHotCodeBytes(self());
+    _hotCodeBytes = (size < _hotCodeBytes) ? _hotCodeBytes - size : 0;
+}
+
+void J9::CodeCache::printFragmentationStats(bool isHotCodeCache)
+{
+    size_t numFreeBlocks = 0;
+    size_t freeBlockBytes = 0;
+    size_t largestFreeBlock = 0;
+    size_t hotCodeBytes = 0;
+    {
+        CacheCriticalSection walkFreeBlocks(self());
+        for (OMR::CodeCacheFreeCacheBlock *block = _freeBlockList; block; block = block->_next) {
+            numFreeBlocks++;
+            freeBlockBytes += block->_size;
+            largestFreeBlock = std::max(largestFreeBlock, block->_size);
+        }
+        hotCodeBytes = _hotCodeBytes;
+    }
+
+    // Free space between the warm and cold allocation pointers is one contiguous block
+    size_t freeContiguousBytes = self()->getFreeContiguousSpace();
+    size_t totalFreeBytes = freeBlockBytes + freeContiguousBytes;
+    size_t largestFreeBytes = std::max(largestFreeBlock, freeContiguousBytes);
+    size_t fragmentationPercent = totalFreeBytes ? 100 - (largestFreeBytes * 100 / totalFreeBytes) : 0;
+
+    size_t usedWarmBytes = self()->getWarmCodeAlloc() - _warmCodeAllocBase;
+    hotCodeBytes = std::min(hotCodeBytes, usedWarmBytes);
+    size_t hotDensityPercent = usedWarmBytes ? hotCodeBytes * 100 / usedWarmBytes : 0;
+
+    fprintf(stderr,
+        "cache %p%s: freeBlocks=%" OMR_PRIuSIZE " freeBlockBytes=%" OMR_PRIuSIZE " largestFreeBlock=%" OMR_PRIuSIZE
+        " freeContiguous=%" OMR_PRIuSIZE " fragmentation=%" OMR_PRIuSIZE "%% hotCodeBytes=%" OMR_PRIuSIZE
+        " hotDensity=%" OMR_PRIuSIZE "%%\n",
+        this, isHotCodeCache ? " (hot)" : "", numFreeBlocks, freeBlockBytes, largestFreeBlock, freeContiguousBytes,
+        fragmentationPercent, hotCodeBytes, hotDensityPercent);
+}
+
 extern "C" {
 
 // **************************************************************************
@@ -106,6 +106,21 @@ public:
 
     int32_t disclaim(TR::CodeCacheManager *manager, bool canDisclaimOnSwap, bool canDisclaimOnFile);
 
+    /**
+     * @brief Account for a hot code cache body (see CodeCacheManager::isHotCodeCompilation)
+     *        allocated in the warm area of this cache. Takes the code cache mutex.
+     */
+    void addHotCodeBytes(size_t size);
+
+    size_t getHotCodeBytes() const { return _hotCodeBytes; }
+
+    /**
+     * @brief Print free block fragmentation and hot code density for this code cache
+     *
+     * @param[in] isHotCodeCache : true if this is the designated hot code cache
+     */
+    void printFragmentationStats(bool isHotCodeCache);
+
 private:
     /**
      * @brief Restore trampoline pointers to their initial positions
@@ -119,9 +134,14 @@ private:
      * @brief Restore warmCodeAlloc/coldCodeAlloc pointers to their initial positions
      */
     void resetAllocationPointers();
+    /**
+     * @brief Account for hot code bytes returned to the free block list. Takes the code cache mutex.
+     */
+    void removeHotCodeBytes(size_t size);
 
     uint8_t *_warmCodeAllocBase; // used to reset the allocation pointers to initial values
     uint8_t *_coldCodeAllocBase;
+    size_t _hotCodeBytes; // warm code bytes currently held by hot code cache bodies, guarded by the code cache mutex
 #ifdef LINUX
     uint8_t *_smallPageAreaStart; // used for code cache disclaiming to remember where the small page area starts/ends
     uint8_t *_smallPageAreaEnd;
@@ -34,6 +34,7 @@
 #include "jitprotos.h"
 #define J9_EXTERNAL_TO_VM
 #include "vmaccess.h"
+#include "compile/Compilation.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Recompilation.hpp"
 #include "control/RecompilationInfo.hpp"
@@ -60,6 +61,12 @@ TR::CodeCacheManager *J9::CodeCacheManager::_codeCacheManager = NULL;
 J9JavaVM *J9::CodeCacheManager::_javaVM = NULL;
 J9JITConfig *J9::CodeCacheManager::_jitConfig = NULL;
 
+// Under hotCodeCacheLayout the hot code cache is kept away from non-hot compilations
+// by reserving it on behalf of this pseudo compilation thread
+static const int32_t HOT_CODE_CACHE_HIDDEN_COMP_THREAD_ID = -100;
+// The hot code cache is given back to the general pool once its free space drops below this
+static const size_t HOT_CODE_CACHE_MIN_FREE_BYTES = 64 * 1024;
+
 TR::CodeCacheManager *J9::CodeCacheManager::self() { return static_cast<TR::CodeCacheManager *>(this); }
 
 TR_FrontEnd *J9::CodeCacheManager::fe() { return _fe; }
@@ -174,6 +181,15 @@ void J9::CodeCacheManager::freeFaintCacheBlock(OMR::FaintCacheBlock *block, uint
 void J9::CodeCacheManager::setCodeCacheFull()
 {
     self()->OMR::CodeCacheManager::setCodeCacheFull();
+#if defined(J9VM_OPT_JFR)
+    // Only report the transition to full, not every failed allocation after it
+    J9JavaVM *javaVM = _jitConfig->javaVM;
+    if (!(_jitConfig->runtimeFlags & J9JIT_CODE_CACHE_FULL) && javaVM->internalVMFunctions->isJFREnabled(javaVM)) {
+        J9VMThread *vmThread = javaVM->internalVMFunctions->currentVMThread(javaVM);
+        if (vmThread)
+            javaVM->internalVMFunctions->jfrCodeCacheFull(vmThread);
+    }
+#endif /* defined(J9VM_OPT_JFR) */
     _jitConfig->runtimeFlags |= J9JIT_CODE_CACHE_FULL;
 }
 
@@ -220,11 +236,70 @@ void J9::CodeCacheManager::onClassUnloading(J9ClassLoader *loaderPtr)
     }
 }
 
+bool J9::CodeCacheManager::isHotCodeCompilation(TR::Compilation *comp)
+{
+    return comp && comp->getMethodHotness() >= hot && !comp->isProfilingCompilation();
+}
+
 TR::CodeCache *J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
     size_t sizeEstimate, int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind)
 {
-    TR::CodeCache *codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(
-        compilationCodeAllocationsMustBeContiguous, sizeEstimate, compThreadID, numReserved, kind);
+    return self()->reserveCodeCache(compilationCodeAllocationsMustBeContiguous, sizeEstimate, compThreadID,
+        numReserved, kind, false);
+}
+
+TR::CodeCache *J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous,
+    size_t sizeEstimate, int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind, bool isHotCode)
+{
+    TR::CodeCache *codeCache = NULL;
+    bool hotCodeCacheLayout = TR::Options::_hotCodeCacheLayout && kind == TR::CodeCacheKind::DEFAULT_CC;
+
+    if (hotCodeCacheLayout) {
+        CacheListCriticalSection reservingHotCodeCache(self());
+        codeCache = self()->reserveHotCodeCacheLocked(compThreadID, isHotCode);
+        if (codeCache && codeCache->getFreeContiguousSpace() < sizeEstimate) {
+            codeCache->unreserve();
+            codeCache = NULL;
+        }
+    }
+
+    if (codeCache) {
+        *numReserved = 0;
+    } else {
+        // The OMR layer may allocate a new code cache so the list lock must not be held here
+        codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
+            sizeEstimate, compThreadID, numReserved, kind);
+
+        if (hotCodeCacheLayout) {
+            bool retry = false;
+            {
+                CacheListCriticalSection designatingHotCodeCache(self());
+                TR::CodeCache *hotCodeCache = _hotCodeCache;
+                if (codeCache && isHotCode && !hotCodeCache) {
+                    // Only designate a cache that has room for a good number of hot bodies;
+                    // otherwise it would fill up and be given back almost immediately
+                    size_t cacheSize = codeCache->getCodeTop() - codeCache->getCodeBase();
+                    if (codeCache->getFreeContiguousSpace() >= std::max(cacheSize / 4, HOT_CODE_CACHE_MIN_FREE_BYTES)) {
+                        _hotCodeCache = codeCache;
+                        if (self()->codeCacheConfig().verboseCodeCache())
+                            TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,
+                                "CC=%p designated as hot code cache with %zu bytes free", codeCache,
+                                codeCache->getFreeContiguousSpace());
+                    }
+                } else if (!codeCache && !isHotCode && hotCodeCache && hotCodeCache->isReserved()
+                    && hotCodeCache->getReservingCompThreadID() == HOT_CODE_CACHE_HIDDEN_COMP_THREAD_ID) {
+                    // Rather than failing (and retrying) the compilation because the only cache with
+                    // space left is the hidden hot one, share it until space is found elsewhere
+                    hotCodeCache->unreserve();
+                    _hotCodeCache = NULL;
+                    retry = true;
+                }
+            }
+            if (retry)
+                codeCache = self()->OMR::CodeCacheManager::reserveCodeCache(compilationCodeAllocationsMustBeContiguous,
+                    sizeEstimate, compThreadID, numReserved, kind);
+        }
+    }
 
     if (codeCache == NULL) {
         J9JITConfig *jitConfig = self()->fej9()->getJ9JITConfig();
@@ -233,6 +308,38 @@ TR::CodeCache *J9::CodeCacheManager::reserveCodeCache(bool compilationCodeAlloca
     return codeCache;
 }
 
+TR::CodeCache *J9::CodeCacheManager::reserveHotCodeCacheLocked(int32_t compThreadID, bool isHotCode)
+{
+    TR::CodeCache *hotCodeCache = _hotCodeCache;
+    if (!hotCodeCache)
+        return NULL;
+
+    bool hidden = hotCodeCache->isReserved()
+        && hotCodeCache->getReservingCompThreadID() == HOT_CODE_CACHE_HIDDEN_COMP_THREAD_ID;
+
+    if (hotCodeCache->getFreeContiguousSpace() < HOT_CODE_CACHE_MIN_FREE_BYTES) {
+        // Nearly full; give it back to the general pool and let the next hot compilation designate another
+        if (hidden)
+            hotCodeCache->unreserve();
+        _hotCodeCache = NULL;
+        return NULL;
+    }
+
+    if (isHotCode) {
+        if (hidden)
+            hotCodeCache->unreserve();
+        if (hotCodeCache->isReserved()) // another hot compilation is using it
+            return NULL;
+        hotCodeCache->reserve(compThreadID);
+        return hotCodeCache;
+    }
+
+    // A hot compilation that finished may have released the hot code cache; hide it again
+    if (!hotCodeCache->isReserved())
+        hotCodeCache->reserve(HOT_CODE_CACHE_HIDDEN_COMP_THREAD_ID);
+    return NULL;
+}
+
 void J9::CodeCacheManager::reportCodeLoadEvents()
 {
     OMR::CodeCacheManager::CacheListCriticalSection reportingCodeLoadEvents(self());
@@ -708,6 +815,7 @@ void J9::CodeCacheManager::printOccupancyStats()
     CacheListCriticalSection scanCacheList(self());
     for (TR::CodeCache *codeCache = self()->getFirstCodeCache(); codeCache; codeCache = codeCache->next()) {
         codeCache->printOccupancyStats();
+        codeCache->printFragmentationStats(codeCache == _hotCodeCache);
     }
 }
 
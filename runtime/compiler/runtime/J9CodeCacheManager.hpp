@@ -47,6 +47,7 @@ struct J9ClassLoader;
 namespace TR {
 class CodeCacheMemorySegment;
 class CodeCache;
+class Compilation;
 } // namespace TR
 
 namespace J9 {
@@ -58,6 +59,7 @@ public:
     CodeCacheManager(TR_FrontEnd *fe, TR::RawAllocator rawAllocator)
         : OMR::CodeCacheManagerConnector(rawAllocator)
         , _fe(fe)
+        , _hotCodeCache(NULL)
     {
         _codeCacheManager = reinterpret_cast<TR::CodeCacheManager *>(this);
         _disclaimEnabled = TR::Options::getCmdLineOptions()->getOption(TR_EnableCodeCacheDisclaiming);
@@ -96,6 +98,25 @@ public:
     TR::CodeCache *reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous, size_t sizeEstimate,
         int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind);
 
+    /**
+     * @brief Reserve a code cache for a compilation. When the hotCodeCacheLayout option is
+     *        enabled, compilations of hot code are steered to a designated hot code cache
+     *        that is kept away from all other compilations, so that hot bodies end up
+     *        densely packed together instead of scattered among warm and cold ones.
+     *
+     * @param[in] isHotCode : true if the code to be generated is for a hot or scorching body
+     */
+    TR::CodeCache *reserveCodeCache(bool compilationCodeAllocationsMustBeContiguous, size_t sizeEstimate,
+        int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind, bool isHotCode);
+
+    TR::CodeCache *getHotCodeCache() const { return _hotCodeCache; }
+
+    /**
+     * @brief Whether a compilation produces a body that belongs in the hot code cache:
+     *        a final (non-profiling) hot or scorching body. Profiling bodies are short lived.
+     */
+    static bool isHotCodeCompilation(TR::Compilation *comp);
+
     TR::CodeCacheMemorySegment *setupMemorySegmentFromRepository(uint8_t *start, uint8_t *end,
         size_t &codeCacheSizeToAllocate);
     void freeMemorySegment(TR::CodeCacheMemorySegment *segment);
@@ -171,6 +192,15 @@ private:
     static J9JITConfig *_jitConfig;
     static J9JavaVM *_javaVM;
     bool _disclaimEnabled; // If true, code cache can be disclaimed to a file or swap
+    TR::CodeCache *_hotCodeCache; // cache designated for hot bodies under hotCodeCacheLayout; guarded by the cache list mutex
+
+    /**
+     * @brief Reserve the designated hot code cache for a hot compilation, or hide it
+     *        from a non-hot one. Must be called with the cache list mutex held.
+     *
+     * @return the hot code cache if it was reserved for compThreadID; NULL otherwise
+     */
+    TR::CodeCache *reserveHotCodeCacheLocked(int32_t compThreadID, bool isHotCode);
 };
 
 } // namespace J9
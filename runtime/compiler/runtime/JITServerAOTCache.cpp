@@ -34,15 +34,52 @@
 #include "net/CommunicationStream.hpp"
 
 struct JITServerAOTCacheReadContext {
-    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header, TR::StackMemoryRegion &stackMemoryRegion);
-
-    Vector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
-    Vector<AOTCacheClassRecord *> _classRecords;
-    Vector<AOTCacheMethodRecord *> _methodRecords;
-    Vector<AOTCacheClassChainRecord *> _classChainRecords;
-    Vector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
-    Vector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
-    Vector<AOTCacheThunkRecord *> _thunkRecords;
+    TR_PERSISTENT_ALLOC(TR_Memory::JITServerAOTCache)
+
+    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header);
+
+    // Make room for the IDs of the records in a delta section
+    void grow(const JITServerAOTCacheHeader &header);
+
+    PersistentVector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
+    PersistentVector<AOTCacheClassRecord *> _classRecords;
+    PersistentVector<AOTCacheMethodRecord *> _methodRecords;
+    PersistentVector<AOTCacheClassChainRecord *> _classChainRecords;
+    PersistentVector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
+    PersistentVector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
+    PersistentVector<AOTCacheThunkRecord *> _thunkRecords;
+};
+
+// Bounds-checked sequential access to the bytes of a cache snapshot
+struct JITServerAOTCacheSnapshotCursor {
+    JITServerAOTCacheSnapshotCursor(const uint8_t *start, size_t size)
+        : _current(start)
+        , _end(start + size)
+    {}
+
+    const uint8_t *current() const { return _current; }
+
+    bool hasBytes(size_t size) const { return size <= (size_t)(_end - _current); }
+
+    bool read(void *dst, size_t size)
+    {
+        if (!hasBytes(size))
+            return false;
+        memcpy(dst, _current, size);
+        _current += size;
+        return true;
+    }
+
+    bool skip(size_t size)
+    {
+        if (!hasBytes(size))
+            return false;
+        _current += size;
+        return true;
+    }
+
+    const uint8_t *_current;
+    const uint8_t * const _end;
 };
 
 size_t JITServerAOTCacheMap::_cacheMaxBytes = 300 * 1024 * 1024;
@@ -58,11 +95,12 @@ void *AOTCacheRecord::allocate(size_t size)
 
 void AOTCacheRecord::free(void *ptr) { TR::Compiler->persistentGlobalMemory()->freePersistentMemory(ptr); }
 
-// Read a single AOT cache record R from a cache file
-template<class R> R *AOTCacheRecord::readRecord(FILE *f, const JITServerAOTCacheReadContext &context)
+// Read a single AOT cache record R from a cache snapshot
+template<class R>
+R *AOTCacheRecord::readRecord(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheReadContext &context)
 {
     typename R::SerializationRecord header;
-    if (1 != fread(&header, sizeof(header), 1, f)) {
+    if (!cursor.read(&header, sizeof(header))) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Could not read %s record header",
                 R::getRecordName());
@@ -81,7 +119,7 @@ template<class R> R *AOTCacheRecord::readRecord(FILE *f, const JITServerAOTCache
 
     size_t variableDataBytes = record->dataAddr()->size() - sizeof(header);
     if (0 != variableDataBytes) {
-        if (1 != fread((uint8_t *)record->dataAddr() + sizeof(header), variableDataBytes, 1, f)) {
+        if (!cursor.read((uint8_t *)record->dataAddr() + sizeof(header), variableDataBytes)) {
             if (TR::Options::getVerboseOption(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                     "AOT cache: Unable to read variable part of %s record", R::getRecordName());
@@ -246,7 +284,7 @@ static void listClassSubRecordsDo(const D &data, const R * const *subRecords,
 // array of an already-allocated record of that type by copying the matching R pointers from cacheRecords into
 // subRecords using the given serialization record data.
 template<class D, class R>
-static bool listClassSetSubrecordPointers(const D &data, R **subRecords, const Vector<R *> &cacheRecords,
+static bool listClassSetSubrecordPointers(const D &data, R **subRecords, const PersistentVector<R *> &cacheRecords,
     const char *recordName, const char *subrecordName)
 {
     for (size_t i = 0; i < data.list().length(); ++i) {
@@ -704,6 +742,14 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
     , _cachedMethodHead(NULL)
     , _cachedMethodTail(NULL)
     , _cachedMethodMonitor(TR::Monitor::create("JIT-JITServerAOTCacheCachedMethodMonitor"))
+    , _snapshot(NULL)
+    , _snapshotContext(NULL)
+    , _snapshotMethodMap(decltype(_snapshotMethodMap)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _numMaterializedMethods(0)
+    , _savedHeader()
+    , _savedCounts()
+    , _pendingSavedHeader()
+    , _pendingSavedCounts()
     , _timePrevSaveOperation(0)
     , _minNumAOTMethodsToSave(TR::Options::_aotCachePersistenceMinDeltaMethods)
     , _saveOperationInProgress(false)
@@ -715,6 +761,7 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
     , _numDeserializedMethods(0)
     , _numDeserializationFailures(0)
     , _numGeneratedClasses(0)
+    , _numDeltaSaves(0)
 {
     bool allMonitors = _classLoaderMonitor && _classMonitor && _methodMonitor && _classChainMonitor
         && _wellKnownClassesMonitor && _aotHeaderMonitor && _cachedMethodMonitor;
@@ -736,6 +783,15 @@ JITServerAOTCache::~JITServerAOTCache()
     freeMapValues(_thunkMap);
     freeMapValues(_cachedMethodMap);
 
+    if (_snapshotContext) {
+        _snapshotContext->~JITServerAOTCacheReadContext();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(_snapshotContext);
+    }
+    if (_snapshot) {
+        _snapshot->~JITServerAOTCacheSnapshot();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(_snapshot);
+    }
+
     TR::Monitor::destroy(_classMonitor);
     TR::Monitor::destroy(_classLoaderMonitor);
     TR::Monitor::destroy(_methodMonitor);
@@ -746,17 +802,40 @@ JITServerAOTCache::~JITServerAOTCache()
     TR::Monitor::destroy(_cachedMethodMonitor);
 }
 
-JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header,
-    TR::StackMemoryRegion &stackMemoryRegion)
-    : _classLoaderRecords(header._nextClassLoaderId, NULL, stackMemoryRegion)
-    , _classRecords(header._nextClassId, NULL, stackMemoryRegion)
-    , _methodRecords(header._nextMethodId, NULL, stackMemoryRegion)
-    , _classChainRecords(header._nextClassChainId, NULL, stackMemoryRegion)
-    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL, stackMemoryRegion)
-    , _aotHeaderRecords(header._nextAOTHeaderId, NULL, stackMemoryRegion)
-    , _thunkRecords(header._nextThunkId, NULL, stackMemoryRegion)
+JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header)
+    : _classLoaderRecords(header._nextClassLoaderId, NULL,
+          decltype(_classLoaderRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _classRecords(header._nextClassId, NULL,
+          decltype(_classRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _methodRecords(header._nextMethodId, NULL,
+          decltype(_methodRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _classChainRecords(header._nextClassChainId, NULL,
+          decltype(_classChainRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL,
+          decltype(_wellKnownClassesRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _aotHeaderRecords(header._nextAOTHeaderId, NULL,
+          decltype(_aotHeaderRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _thunkRecords(header._nextThunkId, NULL,
+          decltype(_thunkRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
 {}
 
+template<typename V> static void growRecordVector(PersistentVector<V *> &records, size_t nextId)
+{
+    if (nextId > records.size())
+        records.resize(nextId, NULL);
+}
+
+void JITServerAOTCacheReadContext::grow(const JITServerAOTCacheHeader &header)
+{
+    growRecordVector(_classLoaderRecords, header._nextClassLoaderId);
+    growRecordVector(_classRecords, header._nextClassId);
+    growRecordVector(_methodRecords, header._nextMethodId);
+    growRecordVector(_classChainRecords, header._nextClassChainId);
+    growRecordVector(_wellKnownClassesRecords, header._nextWellKnownClassesId);
+    growRecordVector(_aotHeaderRecords, header._nextAOTHeaderId);
+    growRecordVector(_thunkRecords, header._nextThunkId);
+}
+
 const AOTCacheClassLoaderRecord *JITServerAOTCache::getClassLoaderRecord(const uint8_t *name, size_t nameLength)
 {
     TR_ASSERT(nameLength, "Empty class loader identifying name");
@@ -1026,7 +1105,7 @@ bool JITServerAOTCache::storeMethod(const AOTCacheClassChainRecord *definingClas
     }
 
     auto it = _cachedMethodMap.find(key);
-    if (it != _cachedMethodMap.end()) {
+    if ((it != _cachedMethodMap.end()) || (_snapshotMethodMap.find(key) != _snapshotMethodMap.end())) {
         // NOTE: Current implementation keeps the first version of the method for this key in the cache.
         //       If we want to keep the most recent version instead, we will need to synchronize deleting
         //       the old version with any concurrent threads that could be sending it to other clients.
@@ -1059,13 +1138,58 @@ const CachedAOTMethod *JITServerAOTCache::findMethod(const AOTCacheClassChainRec
     OMR::CriticalSection cs(_cachedMethodMonitor);
 
     auto it = _cachedMethodMap.find(key);
-    if (it == _cachedMethodMap.end()) {
+    if (it != _cachedMethodMap.end()) {
+        ++_numCacheHits;
+        return it->second;
+    }
+
+    const CachedAOTMethod *method = materializeSnapshotMethod(key);
+    if (!method) {
         ++_numCacheMisses;
         return NULL;
     }
 
     ++_numCacheHits;
-    return it->second;
+    return method;
+}
+
+CachedAOTMethod *JITServerAOTCache::materializeSnapshotMethod(const CachedMethodKey &key)
+{
+    auto it = _snapshotMethodMap.find(key);
+    if ((it == _snapshotMethodMap.end()) || !JITServerAOTCacheMap::cacheHasSpace())
+        return NULL;
+
+    // The snapshot was validated when the cache was loaded, so this can only fail if we run out of memory
+    JITServerAOTCacheSnapshotCursor cursor((const uint8_t *)it->second, it->second->size());
+    CachedAOTMethod *method = AOTCacheRecord::readRecord<CachedAOTMethod>(cursor, *_snapshotContext);
+    if (!method)
+        return NULL;
+
+    try {
+        _cachedMethodMap.insert({ key, method });
+    } catch (...) {
+        AOTCacheRecord::free(method);
+        throw;
+    }
+    ++_numMaterializedMethods;
+
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: materialized method %.*s @ %s from snapshot",
+            _name.c_str(), (int)method->data().signatureSize(), method->data().signature(),
+            TR::Compilation::getHotnessName(method->data().optLevel()));
+
+    return method;
+}
+
+void JITServerAOTCache::getCachedMethodSignatures(std::vector<std::string> &signatures) const
+{
+    OMR::CriticalSection cs(_cachedMethodMonitor);
+
+    signatures.reserve(_cachedMethodMap.size() - _numMaterializedMethods + _snapshotMethodMap.size());
+    for (auto &kv : _snapshotMethodMap)
+        signatures.emplace_back(kv.second->signature(), kv.second->signatureSize());
+    for (auto method = _cachedMethodHead; method != NULL; method = method->getNextRecord())
+        signatures.emplace_back(method->data().signature(), method->data().signatureSize());
 }
 
 Vector<const AOTSerializationRecord *> JITServerAOTCache::getSerializationRecords(const CachedAOTMethod *method,
@@ -1135,6 +1259,8 @@ void JITServerAOTCache::printStats(FILE *f) const
     fprintf(f,
         "JITServer AOT cache %s statistics:\n"
         "\tstored methods: %zu\n"
+        "\tsnapshot methods: %zu (%zu materialized)\n"
+        "\tdelta saves: %zu\n"
         "\tclass loader records: %zu\n"
         "\tclass records: %zu (%zu generated)\n"
         "\tmethod records: %zu\n"
@@ -1146,15 +1272,21 @@ void JITServerAOTCache::printStats(FILE *f) const
         "\tcache misses: %zu\n"
         "\tdeserialized methods: %zu\n"
         "\tdeserialization failures: %zu\n",
-        _name.c_str(), _cachedMethodMap.size(), _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
+        _name.c_str(), _cachedMethodMap.size() - _numMaterializedMethods, _snapshotMethodMap.size(),
+        _numMaterializedMethods, _numDeltaSaves, _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
         _methodMap.size(), _classChainMap.size(), _wellKnownClassesMap.size(), _aotHeaderMap.size(), _numCacheBypasses,
         _numCacheHits, _numCacheMisses, _numDeserializedMethods, _numDeserializationFailures);
 }
 
-// Write at most numRecordsToWrite to the given stream from the linked list starting at head.
-static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecordsToWrite)
+// Write at most numRecordsToWrite to the given stream from the linked list starting at head,
+// after skipping the first numRecordsToSkip records (which were written by a previous save).
+static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecordsToSkip, size_t numRecordsToWrite,
+    size_t &bytesWritten)
 {
     const AOTCacheRecord *current = head;
+    for (size_t i = 0; current && (i < numRecordsToSkip); ++i)
+        current = current->getNextRecord();
+
     size_t recordsWritten = 0;
     while (current && (recordsWritten < numRecordsToWrite)) {
         const AOTSerializationRecord *record = current->dataAddr();
@@ -1163,6 +1295,7 @@ static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecor
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write record to cache file");
             return false;
         }
+        bytesWritten += record->size();
         ++recordsWritten;
         current = current->getNextRecord();
     }
@@ -1172,9 +1305,13 @@ static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecor
     return true;
 }
 
-static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t numRecordsToWrite)
+static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t numRecordsToSkip,
+    size_t numRecordsToWrite, size_t &bytesWritten)
 {
     const CachedAOTMethod *current = head;
+    for (size_t i = 0; current && (i < numRecordsToSkip); ++i)
+        current = current->getNextRecord();
+
     size_t recordsWritten = 0;
     while (current && (recordsWritten < numRecordsToWrite)) {
         const SerializedAOTMethod *record = &current->data();
@@ -1183,6 +1320,7 @@ static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t n
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write record to cache file");
             return false;
         }
+        bytesWritten += record->size();
         ++recordsWritten;
         current = current->getNextRecord();
     }
@@ -1199,16 +1337,20 @@ static void getCurrentAOTCacheVersion(JITServerAOTCacheVersion &version)
     version._jitserverVersion = JITServer::CommunicationStream::getJITServerFullVersion();
 }
 
-// Write a full AOT cache snapshot to a stream. After the header information, the
-// AOTSerializationRecord or SerializedAOTMethod data (depending on record type) in each
-// record traversal is written directly to the stream in sections, since the full AOT record
-// can be reconstructed from only this information. These sections are ordered so that, when
-// reading the snapshot, the dependencies of each record will already have been read by the
-// time we get to that record.
-// Return the number of AOT methods written to the snapshot or 0 on failure.
-size_t JITServerAOTCache::writeCache(FILE *f) const
+static void addRecordCounts(JITServerAOTCacheHeader &counts, const JITServerAOTCacheHeader &section)
+{
+    counts._numClassLoaderRecords += section._numClassLoaderRecords;
+    counts._numClassRecords += section._numClassRecords;
+    counts._numMethodRecords += section._numMethodRecords;
+    counts._numClassChainRecords += section._numClassChainRecords;
+    counts._numWellKnownClassesRecords += section._numWellKnownClassesRecords;
+    counts._numAOTHeaderRecords += section._numAOTHeaderRecords;
+    counts._numThunkRecords += section._numThunkRecords;
+    counts._numCachedAOTMethods += section._numCachedAOTMethods;
+}
+
+void JITServerAOTCache::getSectionHeader(JITServerAOTCacheHeader &header, const JITServerAOTCacheHeader &written) const
 {
-    JITServerAOTCacheHeader header = { 0 };
     getCurrentAOTCacheVersion(header._version);
     header._serverUID = TR::CompilationInfo::get()->getPersistentInfo()->getServerUID();
 
@@ -1217,72 +1359,174 @@ size_t JITServerAOTCache::writeCache(FILE *f) const
     // to ensure that those dependencies are not excluded from serialization.
     {
         OMR::CriticalSection cs(_cachedMethodMonitor);
-        header._numCachedAOTMethods = _cachedMethodMap.size();
-    }
-    if (header._numCachedAOTMethods == 0) {
-        TR_ASSERT_FATAL(false, "Expected to write at least one method to the AOT cache file");
-        return 0;
+        header._numCachedAOTMethods = _cachedMethodMap.size() - _numMaterializedMethods - written._numCachedAOTMethods;
     }
     {
         OMR::CriticalSection cs(_thunkMonitor);
-        header._numThunkRecords = _thunkMap.size();
+        header._numThunkRecords = _thunkMap.size() - written._numThunkRecords;
         header._nextThunkId = _nextThunkId;
     }
     {
         OMR::CriticalSection cs(_aotHeaderMonitor);
-        header._numAOTHeaderRecords = _aotHeaderMap.size();
+        header._numAOTHeaderRecords = _aotHeaderMap.size() - written._numAOTHeaderRecords;
         header._nextAOTHeaderId = _nextAOTHeaderId;
     }
     {
         OMR::CriticalSection cs(_wellKnownClassesMonitor);
-        header._numWellKnownClassesRecords = _wellKnownClassesMap.size();
+        header._numWellKnownClassesRecords = _wellKnownClassesMap.size() - written._numWellKnownClassesRecords;
         header._nextWellKnownClassesId = _nextWellKnownClassesId;
     }
     {
         OMR::CriticalSection cs(_classChainMonitor);
-        header._numClassChainRecords = _classChainMap.size();
+        header._numClassChainRecords = _classChainMap.size() - written._numClassChainRecords;
         header._nextClassChainId = _nextClassChainId;
     }
     {
         OMR::CriticalSection cs(_methodMonitor);
-        header._numMethodRecords = _methodMap.size();
+        header._numMethodRecords = _methodMap.size() - written._numMethodRecords;
         header._nextMethodId = _nextMethodId;
     }
     {
         OMR::CriticalSection cs(_classMonitor);
-        header._numClassRecords = _classMap.size();
+        header._numClassRecords = _classMap.size() - written._numClassRecords;
         header._nextClassId = _nextClassId;
     }
     {
         OMR::CriticalSection cs(_classLoaderMonitor);
-        header._numClassLoaderRecords = _classLoaderMap.size();
+        header._numClassLoaderRecords = _classLoaderMap.size() - written._numClassLoaderRecords;
         header._nextClassLoaderId = _nextClassLoaderId;
     }
+}
 
+// Write the records counted in the section header, skipping the ones counted in `written`. The sections are
+// ordered so that, when reading the snapshot, the dependencies of each record will already have been read by
+// the time we get to that record. The methods in the snapshot this cache was loaded from are copied as they are.
+bool JITServerAOTCache::writeSection(FILE *f, const JITServerAOTCacheHeader &header,
+    const JITServerAOTCacheHeader &written, bool writeSnapshotMethods, size_t &bytesWritten) const
+{
+    if (!writeRecordList(f, _classLoaderHead, written._numClassLoaderRecords, header._numClassLoaderRecords,
+            bytesWritten))
+        return false;
+    if (!writeRecordList(f, _classHead, written._numClassRecords, header._numClassRecords, bytesWritten))
+        return false;
+    if (!writeRecordList(f, _methodHead, written._numMethodRecords, header._numMethodRecords, bytesWritten))
+        return false;
+    if (!writeRecordList(f, _classChainHead, written._numClassChainRecords, header._numClassChainRecords,
+            bytesWritten))
+        return false;
+    if (!writeRecordList(f, _wellKnownClassesHead, written._numWellKnownClassesRecords,
+            header._numWellKnownClassesRecords, bytesWritten))
+        return false;
+    if (!writeRecordList(f, _aotHeaderHead, written._numAOTHeaderRecords, header._numAOTHeaderRecords, bytesWritten))
+        return false;
+    if (!writeRecordList(f, _thunkHead, written._numThunkRecords, header._numThunkRecords, bytesWritten))
+        return false;
+
+    if (writeSnapshotMethods) {
+        for (auto &kv : _snapshotMethodMap) {
+            if (1 != fwrite(kv.second, kv.second->size(), 1, f)) {
+                if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                    TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                        "AOT cache: Unable to write record to cache file");
+                return false;
+            }
+            bytesWritten += kv.second->size();
+        }
+    }
+
+    return writeCachedMethodList(f, _cachedMethodHead, written._numCachedAOTMethods, header._numCachedAOTMethods,
+        bytesWritten);
+}
+
+// Write a full AOT cache snapshot to a stream. After the header information, the
+// AOTSerializationRecord or SerializedAOTMethod data (depending on record type) in each
+// record traversal is written directly to the stream in sections, since the full AOT record
+// can be reconstructed from only this information.
+// Return the number of AOT methods written to the snapshot or 0 on failure.
+size_t JITServerAOTCache::writeCache(FILE *f)
+{
+    const JITServerAOTCacheHeader nothingWritten = { 0 };
+    JITServerAOTCacheHeader counts = { 0 };
+    getSectionHeader(counts, nothingWritten);
+
+    JITServerAOTCacheHeader header = counts;
+    header._numCachedAOTMethods += _snapshotMethodMap.size();
+    if (header._numCachedAOTMethods == 0) {
+        TR_ASSERT_FATAL(false, "Expected to write at least one method to the AOT cache file");
+        return 0;
+    }
+    header._numDeltas = 0;
+    header._numTotalCachedAOTMethods = header._numCachedAOTMethods;
+
+    // The size of the snapshot is only known once everything else is written,
+    // so the header is written again at the end
     if (1 != fwrite(&header, sizeof(JITServerAOTCacheHeader), 1, f)) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write cache file header");
         return 0;
     }
 
-    if (!writeRecordList(f, _classLoaderHead, header._numClassLoaderRecords))
-        return 0;
-    if (!writeRecordList(f, _classHead, header._numClassRecords))
-        return 0;
-    if (!writeRecordList(f, _methodHead, header._numMethodRecords))
+    size_t bytesWritten = sizeof(JITServerAOTCacheHeader);
+    if (!writeSection(f, counts, nothingWritten, true, bytesWritten))
         return 0;
-    if (!writeRecordList(f, _classChainHead, header._numClassChainRecords))
-        return 0;
-    if (!writeRecordList(f, _wellKnownClassesHead, header._numWellKnownClassesRecords))
-        return 0;
-    if (!writeRecordList(f, _aotHeaderHead, header._numAOTHeaderRecords))
+
+    header._snapshotSize = bytesWritten;
+    if ((0 != fseek(f, 0, SEEK_SET)) || (1 != fwrite(&header, sizeof(JITServerAOTCacheHeader), 1, f))) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write cache file header");
         return 0;
-    if (!writeRecordList(f, _thunkHead, header._numThunkRecords))
+    }
+
+    // Becomes the state of the file on disk once the save operation is finalized successfully
+    _pendingSavedHeader = header;
+    _pendingSavedCounts = counts;
+
+    return header._numCachedAOTMethods;
+}
+
+// Append a delta section with the records and methods added since the last save to the snapshot file.
+// The data is written past the valid part of the file first, and only becomes part of the snapshot
+// when the header at the start of the file is rewritten, so a reader never sees a partial delta.
+size_t JITServerAOTCache::appendDeltaToSnapshot(const std::string &cacheFileName)
+{
+    // Only append to files written by this server; any other file is replaced by a full save
+    if (_savedHeader._serverUID != TR::CompilationInfo::get()->getPersistentInfo()->getServerUID())
         return 0;
-    if (!writeCachedMethodList(f, _cachedMethodHead, header._numCachedAOTMethods))
+
+    FILE *f = fopen(cacheFileName.c_str(), "r+b");
+    if (!f)
         return 0;
 
-    return header._numCachedAOTMethods;
+    size_t numAOTMethods = 0;
+    JITServerAOTCacheHeader fileHeader = { 0 };
+    // If the header changed, another server replaced the file since our last save
+    if ((1 == fread(&fileHeader, sizeof(JITServerAOTCacheHeader), 1, f))
+        && (0 == memcmp(&fileHeader, &_savedHeader, sizeof(JITServerAOTCacheHeader)))) {
+        JITServerAOTCacheHeader delta = { 0 };
+        getSectionHeader(delta, _savedCounts);
+
+        size_t bytesWritten = sizeof(JITServerAOTCacheHeader);
+        if ((0 != delta._numCachedAOTMethods) && (0 == fseek(f, (long)_savedHeader._snapshotSize, SEEK_SET))
+            && (1 == fwrite(&delta, sizeof(JITServerAOTCacheHeader), 1, f))
+            && writeSection(f, delta, _savedCounts, false, bytesWritten) && (0 == fflush(f))) {
+            JITServerAOTCacheHeader header = _savedHeader;
+            header._numDeltas += 1;
+            header._numTotalCachedAOTMethods += delta._numCachedAOTMethods;
+            header._snapshotSize += bytesWritten;
+
+            if ((0 == fseek(f, 0, SEEK_SET)) && (1 == fwrite(&header, sizeof(JITServerAOTCacheHeader), 1, f))
+                && (0 == fflush(f))) {
+                _pendingSavedHeader = header;
+                _pendingSavedCounts = _savedCounts;
+                addRecordCounts(_pendingSavedCounts, delta);
+                numAOTMethods = header._numTotalCachedAOTMethods;
+                ++_numDeltaSaves;
+            }
+        }
+    }
+
+    fclose(f);
+    return numAOTMethods;
 }
 
 // Tests whether or not the given AOT snapshot is compatible with the server.
@@ -1296,24 +1540,94 @@ static bool isCompatibleSnapshotVersion(const JITServerAOTCacheVersion &version)
         && (version._jitserverVersion == currentVersion._jitserverVersion);
 }
 
+static void freeSnapshot(JITServerAOTCacheSnapshot *snapshot)
+{
+    snapshot->~JITServerAOTCacheSnapshot();
+    TR::Compiler->persistentGlobalMemory()->freePersistentMemory(snapshot);
+}
+
+JITServerAOTCacheSnapshot *JITServerAOTCacheSnapshot::open(const std::string &fileName)
+{
+    PORT_ACCESS_FROM_JITCONFIG(TR::CompilationInfo::get()->getJITConfig());
+    intptr_t fd = j9file_open(fileName.c_str(), EsOpenRead, 0);
+    if (-1 == fd)
+        return NULL;
+
+    JITServerAOTCacheSnapshot *snapshot = NULL;
+    int64_t fileSize = j9file_flength(fd);
+    if (fileSize >= (int64_t)sizeof(JITServerAOTCacheHeader)) {
+        if (J9PORT_MMAP_CAPABILITY_READ == (j9mmap_capabilities() & J9PORT_MMAP_CAPABILITY_READ)) {
+            J9MmapHandle *mmapHandle = j9mmap_map_file(fd, 0, (uintptr_t)fileSize, fileName.c_str(),
+                J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_JIT);
+            if (mmapHandle) {
+                snapshot = new (TR::Compiler->persistentGlobalMemory())
+                    JITServerAOTCacheSnapshot(mmapHandle, (const uint8_t *)mmapHandle->pointer, (size_t)fileSize);
+                if (!snapshot)
+                    j9mmap_unmap_file(mmapHandle);
+            }
+        }
+
+        // Fall back to reading the whole file if it cannot be mapped
+        if (!snapshot) {
+            uint8_t *buffer = (uint8_t *)TR::Compiler->persistentGlobalMemory()->allocatePersistentMemory(
+                (size_t)fileSize, TR_Memory::JITServerAOTCache);
+            if (buffer) {
+                size_t bytesRead = 0;
+                while (bytesRead < (size_t)fileSize) {
+                    intptr_t n = j9file_read(fd, buffer + bytesRead, (intptr_t)((size_t)fileSize - bytesRead));
+                    if (n <= 0)
+                        break;
+                    bytesRead += n;
+                }
+                if (bytesRead == (size_t)fileSize)
+                    snapshot = new (TR::Compiler->persistentGlobalMemory())
+                        JITServerAOTCacheSnapshot(NULL, buffer, (size_t)fileSize);
+                if (!snapshot)
+                    TR::Compiler->persistentGlobalMemory()->freePersistentMemory(buffer);
+            }
+        }
+    }
+
+    j9file_close(fd);
+    return snapshot;
+}
+
+JITServerAOTCacheSnapshot::~JITServerAOTCacheSnapshot()
+{
+    if (_mmapHandle) {
+        PORT_ACCESS_FROM_JITCONFIG(TR::CompilationInfo::get()->getJITConfig());
+        j9mmap_unmap_file(_mmapHandle);
+    } else {
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory((void *)_start);
+    }
+}
+
 // Read an AOT cache snapshot, returning NULL if the cache is ill-formed or
 // incompatible with the running server.
-JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name, TR_Memory &trMemory)
+JITServerAOTCache *JITServerAOTCache::readCache(JITServerAOTCacheSnapshot *snapshot, const std::string &name)
 {
-    if (!JITServerAOTCacheMap::cacheHasSpace())
+    if (!JITServerAOTCacheMap::cacheHasSpace()) {
+        freeSnapshot(snapshot);
         return NULL;
+    }
 
     JITServerAOTCacheHeader header = { 0 };
-    if (1 != fread(&header, sizeof(JITServerAOTCacheHeader), 1, f)) {
+    memcpy(&header, snapshot->start(), sizeof(JITServerAOTCacheHeader));
+
+    if (!isCompatibleSnapshotVersion(header._version)) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to read cache file header");
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "AOT cache: Cache file header incompatible with running server");
+        freeSnapshot(snapshot);
         return NULL;
     }
 
-    if (!isCompatibleSnapshotVersion(header._version)) {
+    if ((header._snapshotSize < sizeof(JITServerAOTCacheHeader)) || (header._snapshotSize > snapshot->size())) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                "AOT cache: Cache file header incompatible with running server");
+                "AOT cache: Cache file size %zu does not match size %zu in header", snapshot->size(),
+                header._snapshotSize);
+        freeSnapshot(snapshot);
         return NULL;
     }
 
@@ -1331,12 +1645,17 @@ JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name
     if (!cache) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to allocate new cache for reading");
+        freeSnapshot(snapshot);
         return NULL;
     }
+    // From now on the snapshot is freed along with the cache
+    cache->_snapshot = snapshot;
 
     bool readSuccess = false;
     try {
-        readSuccess = cache->readCache(f, header, trMemory);
+        JITServerAOTCacheSnapshotCursor cursor(snapshot->start() + sizeof(JITServerAOTCacheHeader),
+            header._snapshotSize - sizeof(JITServerAOTCacheHeader));
+        readSuccess = cache->readCache(cursor, header);
     } catch (const std::exception &e) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache reading failed with exception: %s", e.what());
@@ -1352,17 +1671,18 @@ JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name
     return cache;
 }
 
-// Read numRecordsToRead records of an AOTSerializationRecord subclass V from a stream, also
-// updating the map, record traversal, and scratch Vector associated with V.
+// Read numRecordsToRead records of an AOTSerializationRecord subclass V from a snapshot, also
+// updating the map, record traversal, and ID-indexed vector associated with V.
 template<typename K, typename V, typename H>
-bool JITServerAOTCache::readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-    PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records)
+bool JITServerAOTCache::readRecords(JITServerAOTCacheSnapshotCursor &cursor, JITServerAOTCacheReadContext &context,
+    size_t numRecordsToRead, PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail,
+    PersistentVector<V *> &records)
 {
     for (size_t i = 0; i < numRecordsToRead; ++i) {
         if (!JITServerAOTCacheMap::cacheHasSpace())
             return false;
 
-        V *record = AOTCacheRecord::readRecord<V>(f, context);
+        V *record = AOTCacheRecord::readRecord<V>(cursor, context);
         if (!record)
             return false;
 
@@ -1382,16 +1702,11 @@ bool JITServerAOTCache::readRecords(FILE *f, JITServerAOTCacheReadContext &conte
     return true;
 }
 
-bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory)
+// Serialization records are small and needed to look up methods, so they are read right away. The cached
+// AOT methods are only indexed by their keys; they stay in the snapshot until findMethod() asks for them.
+bool JITServerAOTCache::readSection(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheHeader &header)
 {
-    _classLoaderMap.reserve(header._numClassLoaderRecords);
-    _classMap.reserve(header._numClassRecords);
-    _methodMap.reserve(header._numMethodRecords);
-    _classChainMap.reserve(header._numClassChainRecords);
-    _wellKnownClassesMap.reserve(header._numWellKnownClassesRecords);
-    _aotHeaderMap.reserve(header._numAOTHeaderRecords);
-    _thunkMap.reserve(header._numThunkRecords);
-    _cachedMethodMap.reserve(header._numCachedAOTMethods);
+    JITServerAOTCacheReadContext &context = *_snapshotContext;
 
     _nextClassLoaderId = header._nextClassLoaderId;
     _nextClassId = header._nextClassId;
@@ -1401,53 +1716,107 @@ bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header
     _nextAOTHeaderId = header._nextAOTHeaderId;
     _nextThunkId = header._nextThunkId;
 
-    TR::StackMemoryRegion stackMemoryRegion(trMemory);
-    JITServerAOTCacheReadContext context(header, stackMemoryRegion);
-
-    if (!readRecords(f, context, header._numClassLoaderRecords, _classLoaderMap, _classLoaderHead, _classLoaderTail,
-            context._classLoaderRecords))
+    if (!readRecords(cursor, context, header._numClassLoaderRecords, _classLoaderMap, _classLoaderHead,
+            _classLoaderTail, context._classLoaderRecords))
         return false;
-    if (!readRecords(f, context, header._numClassRecords, _classMap, _classHead, _classTail, context._classRecords))
+    if (!readRecords(cursor, context, header._numClassRecords, _classMap, _classHead, _classTail,
+            context._classRecords))
         return false;
-    if (!readRecords(f, context, header._numMethodRecords, _methodMap, _methodHead, _methodTail,
+    if (!readRecords(cursor, context, header._numMethodRecords, _methodMap, _methodHead, _methodTail,
             context._methodRecords))
         return false;
-    if (!readRecords(f, context, header._numClassChainRecords, _classChainMap, _classChainHead, _classChainTail,
+    if (!readRecords(cursor, context, header._numClassChainRecords, _classChainMap, _classChainHead, _classChainTail,
             context._classChainRecords))
         return false;
-    if (!readRecords(f, context, header._numWellKnownClassesRecords, _wellKnownClassesMap, _wellKnownClassesHead,
-            _wellKnownClassesTail, context._wellKnownClassesRecords))
+    if (!readRecords(cursor, context, header._numWellKnownClassesRecords, _wellKnownClassesMap,
+            _wellKnownClassesHead, _wellKnownClassesTail, context._wellKnownClassesRecords))
         return false;
-    if (!readRecords(f, context, header._numAOTHeaderRecords, _aotHeaderMap, _aotHeaderHead, _aotHeaderTail,
+    if (!readRecords(cursor, context, header._numAOTHeaderRecords, _aotHeaderMap, _aotHeaderHead, _aotHeaderTail,
             context._aotHeaderRecords))
         return false;
-    if (!readRecords(f, context, header._numThunkRecords, _thunkMap, _thunkHead, _thunkTail, context._thunkRecords))
+    if (!readRecords(cursor, context, header._numThunkRecords, _thunkMap, _thunkHead, _thunkTail,
+            context._thunkRecords))
         return false;
 
     for (size_t i = 0; i < header._numCachedAOTMethods; ++i) {
-        if (!JITServerAOTCacheMap::cacheHasSpace())
+        // Records are padded to a multiple of the word size, so the method can be used in place
+        auto method = (const SerializedAOTMethod *)cursor.current();
+        if (!cursor.hasBytes(sizeof(SerializedAOTMethod)) || !method->isValidHeader(context)
+            || (method->size()
+                != SerializedAOTMethod::size(method->numRecords(), method->numDependencies(), method->codeSize(),
+                    method->dataSize(), method->signatureSize()))
+            || !cursor.skip(method->size())) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Header for %s record is invalid",
+                    CachedAOTMethod::getRecordName());
             return false;
+        }
 
-        auto record = AOTCacheRecord::readRecord<CachedAOTMethod>(f, context);
-        if (!record)
+        CachedMethodKey key(context._classChainRecords[method->definingClassChainId()], method->index(),
+            method->optLevel(), context._aotHeaderRecords[method->aotHeaderId()]);
+        if (!_snapshotMethodMap.insert({ key, method }).second) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Duplicate %s record",
+                    CachedAOTMethod::getRecordName());
             return false;
+        }
+    }
 
-        CachedMethodKey key(record->definingClassChainRecord(), record->data().index(), record->data().optLevel(),
-            context._aotHeaderRecords[record->data().aotHeaderId()]);
+    return true;
+}
 
-        if (!addToMap(_cachedMethodMap, _cachedMethodHead, _cachedMethodTail, key, record)) {
-            AOTCacheRecord::free(record);
+bool JITServerAOTCache::readCache(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheHeader &header)
+{
+    _classLoaderMap.reserve(header._numClassLoaderRecords);
+    _classMap.reserve(header._numClassRecords);
+    _methodMap.reserve(header._numMethodRecords);
+    _classChainMap.reserve(header._numClassChainRecords);
+    _wellKnownClassesMap.reserve(header._numWellKnownClassesRecords);
+    _aotHeaderMap.reserve(header._numAOTHeaderRecords);
+    _thunkMap.reserve(header._numThunkRecords);
+    _snapshotMethodMap.reserve(header._numTotalCachedAOTMethods);
+
+    _snapshotContext = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCacheReadContext(header);
+    if (!_snapshotContext)
+        return false;
+
+    if (!readSection(cursor, header))
+        return false;
+
+    for (size_t i = 0; i < header._numDeltas; ++i) {
+        JITServerAOTCacheHeader deltaHeader = { 0 };
+        if (!cursor.read(&deltaHeader, sizeof(JITServerAOTCacheHeader))
+            || !isCompatibleSnapshotVersion(deltaHeader._version)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to read header of delta %zu", i);
             return false;
         }
+
+        _snapshotContext->grow(deltaHeader);
+        if (!readSection(cursor, deltaHeader))
+            return false;
+    }
+
+    if (_snapshotMethodMap.size() != header._numTotalCachedAOTMethods) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "AOT cache: Read %zu methods from cache file, expected %zu", _snapshotMethodMap.size(),
+                header._numTotalCachedAOTMethods);
+        return false;
     }
 
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+            "AOT cache %s: indexed %zu methods in %zu deltas of %s snapshot", _name.c_str(),
+            _snapshotMethodMap.size(), header._numDeltas, _snapshot->isMapped() ? "memory-mapped" : "buffered");
+
     return true;
 }
 
 size_t JITServerAOTCache::getNumCachedMethods() const
 {
     OMR::CriticalSection cs(_cachedMethodMonitor);
-    return _cachedMethodMap.size();
+    return numCachedMethods();
 }
 
 bool JITServerAOTCache::triggerAOTCacheStoreToFileIfNeeded()
@@ -1461,7 +1830,7 @@ bool JITServerAOTCache::triggerAOTCacheStoreToFileIfNeeded()
             return false;
 
         // Check whether enough new methods were added to the in-memory cache to be worth attempting a save operation
-        if (_cachedMethodMap.size() < _minNumAOTMethodsToSave)
+        if (numCachedMethods() < _minNumAOTMethodsToSave)
             return false;
 
         // Prevent saving to file too often; wait some time between consecutive saves
@@ -1513,6 +1882,8 @@ void JITServerAOTCache::finalizeSaveOperation(bool success, size_t numMethodsSav
     OMR::CriticalSection cs(_cachedMethodMonitor);
     if (success) {
         _minNumAOTMethodsToSave = numMethodsSavedToFile + TR::Options::_aotCachePersistenceMinDeltaMethods;
+        _savedHeader = _pendingSavedHeader;
+        _savedCounts = _pendingSavedCounts;
     }
     // Overwite the time of the last save operation even if it failed
     // so that we don't try too often
@@ -1537,18 +1908,18 @@ bool JITServerAOTCache::isAOTCacheBetterThanSnapshot(const std::string &cacheFil
                 doSave = true;
             } else // Header is compatible, check the number of methods
             {
-                if (getNumCachedMethods() >= header._numCachedAOTMethods + numExtraMethods) {
+                if (getNumCachedMethods() >= header._numTotalCachedAOTMethods + numExtraMethods) {
                     // We have better data than the existing snaphot, so overwrite it
                     doSave = true;
                 } else // Existing snapshot has more methods (or same as us)
                 {
                     setMinNumAOTMethodsToSave(
-                        header._numCachedAOTMethods + TR::Options::_aotCachePersistenceMinDeltaMethods);
+                        header._numTotalCachedAOTMethods + TR::Options::_aotCachePersistenceMinDeltaMethods);
                     if (TR::Options::getVerboseOption(TR_VerboseJITServer))
                         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                             "AOT cache: Save operation aborted for cache '%s' because we don't have %zu more methods "
                             "than existing snapshot: %zu vs %zu.",
-                            name().c_str(), numExtraMethods, getNumCachedMethods(), header._numCachedAOTMethods);
+                            name().c_str(), numExtraMethods, getNumCachedMethods(), header._numTotalCachedAOTMethods);
                 }
             }
         } else // Read error
@@ -1665,13 +2036,26 @@ bool JITServerAOTCacheMap::saveNextQueuedAOTCacheToFile()
     try {
         std::string cacheFileName
             = buildCacheFileName(compInfo->getPersistentInfo()->getJITServerAOTCacheDir(), cacheName);
-
+        PORT_ACCESS_FROM_JITCONFIG(compInfo->getJITConfig());
+        OMRPORT_ACCESS_FROM_J9PORT(PORTLIB);
+        uint64_t startTime = TR::Options::getVerboseOption(TR_VerboseJITServer) ? j9time_hires_clock() : 0;
+
+        // If we wrote the existing file and nobody replaced it since, just append what is new to it.
+        // This is much cheaper than writing the whole cache again, so it can be done often.
+        if ((numAOTMethodsWritten = cache->appendDeltaToSnapshot(cacheFileName)) != 0) {
+            success = true;
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
+                uint64_t durationUsec
+                    = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "AOT cache: t=%llu Appended delta of cache '%s' to file %s in %llu usec. %zu methods in file.",
+                    compInfo->getPersistentInfo()->getElapsedTime(), cacheName.c_str(), cacheFileName.c_str(),
+                    durationUsec, numAOTMethodsWritten);
+            }
+        }
         // If a similarly named AOT cache file already exists, must determine if it's a better snapshot or not
-        if (cache->isAOTCacheBetterThanSnapshot(cacheFileName, TR::Options::_aotCachePersistenceMinDeltaMethods)) {
-            PORT_ACCESS_FROM_JITCONFIG(compInfo->getJITConfig());
-            OMRPORT_ACCESS_FROM_J9PORT(PORTLIB);
-            uint64_t startTime = TR::Options::getVerboseOption(TR_VerboseJITServer) ? j9time_hires_clock() : 0;
-
+        else if (cache->isAOTCacheBetterThanSnapshot(cacheFileName,
+                     TR::Options::_aotCachePersistenceMinDeltaMethods)) {
             // Create a temporary file based on the UID of this server and the cache name
             std::string tempFileName = buildCacheFileName(compInfo->getPersistentInfo()->getJITServerAOTCacheDir(),
                 std::to_string(compInfo->getPersistentInfo()->getServerUID()) + "." + cacheName + ".tmp");
@@ -1751,7 +2135,7 @@ bool JITServerAOTCacheMap::saveNextQueuedAOTCacheToFile()
     return success;
 }
 
-void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider)
+void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile()
 {
     std::string cacheName;
     {
@@ -1768,31 +2152,20 @@ void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider
     }
 
     JITServerAOTCache *cache = NULL;
-    FILE *cacheFile = NULL;
     try {
         TR::CompilationInfo *compInfo = TR::CompilationInfo::get();
         std::string cacheFileName
             = buildCacheFileName(compInfo->getPersistentInfo()->getJITServerAOTCacheDir(), cacheName);
 
-        // Open the AOT cache file and create a new JITServerAOTCache object
-        FILE *cacheFile = fopen(cacheFileName.c_str(), "rb");
-        if (cacheFile) {
+        // Map the AOT cache file and create a new JITServerAOTCache object from it
+        JITServerAOTCacheSnapshot *snapshot = JITServerAOTCacheSnapshot::open(cacheFileName);
+        if (snapshot) {
             if (TR::Options::getVerboseOption(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                     "AOT cache: t=%llu Opened file %s to load cache '%s' from file",
                     compInfo->getPersistentInfo()->getElapsedTime(), cacheFileName.c_str(), cacheName.c_str());
-            size_t segmentSize = scratchSegmentProvider.getPreferredSegmentSize();
-            if (!segmentSize)
-                segmentSize = 1 << 24 /*16 MB*/;
-            TR::RawAllocator rawAllocator(compInfo->getJITConfig()->javaVM);
-            J9::SystemSegmentProvider segmentProvider(1 << 16 /*64 KB*/, segmentSize,
-                TR::Options::getScratchSpaceLimit(), scratchSegmentProvider, rawAllocator);
-            TR::Region region(segmentProvider, rawAllocator);
-            TR_Memory trMemory(*compInfo->persistentMemory(), region);
-
-            cache = JITServerAOTCache::readCache(cacheFile, cacheName, trMemory); // This should not throw
-            fclose(cacheFile); // filestream not needed anymore
-            cacheFile = NULL;
+
+            cache = JITServerAOTCache::readCache(snapshot, cacheName); // This should not throw
 
             if (cache) {
                 // Update the number of AOT methods needed to be eligible for a save operation
@@ -1812,18 +2185,14 @@ void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider
         } else // Cannot open the AOT cache file
         {
             if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Failed to open cache file %s: %s",
-                    cacheFileName.c_str(), strerror(errno));
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Failed to open cache file %s",
+                    cacheFileName.c_str());
         }
     } catch (const std::exception &e) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                 "AOT cache: exception caught when trying to read-in cache '%s': %s", cacheName.c_str(), e.what());
         }
-        if (cacheFile) {
-            fclose(cacheFile);
-            cacheFile = NULL;
-        }
         if (cache) {
             cache->~JITServerAOTCache();
             TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
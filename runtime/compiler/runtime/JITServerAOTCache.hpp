@@ -32,7 +32,7 @@
 
 class JITServerSharedProfileCache;
 
-static const uint32_t JITSERVER_AOTCACHE_VERSION = 1;
+static const uint32_t JITSERVER_AOTCACHE_VERSION = 2;
 static const char JITSERVER_AOTCACHE_EYECATCHER[] = "AOTCACHE";
 // the eye-catcher is not null-terminated in the snapshot files
 static const size_t JITSERVER_AOTCACHE_EYECATCHER_LENGTH = sizeof(JITSERVER_AOTCACHE_EYECATCHER) - 1;
@@ -45,6 +45,8 @@ namespace J9 {
 class J9SegmentProvider;
 }
 
+struct J9MmapHandle;
+
 // Information relevant to the compatibility of a cache snapshot with the server.
 struct JITServerAOTCacheVersion {
     char _eyeCatcher[JITSERVER_AOTCACHE_EYECATCHER_LENGTH];
@@ -54,6 +56,11 @@ struct JITServerAOTCacheVersion {
 };
 
 // The header information for an AOT cache snapshot.
+//
+// A snapshot file consists of a base section followed by _numDeltas delta sections.
+// Each delta section starts with its own header, whose record counts describe only
+// the records in that section; the last three fields are only meaningful in the
+// header at the start of the file, which is rewritten whenever a delta is appended.
 struct JITServerAOTCacheHeader {
     JITServerAOTCacheVersion _version;
     uint64_t _serverUID;
@@ -72,8 +79,42 @@ struct JITServerAOTCacheHeader {
     size_t _nextWellKnownClassesId;
     size_t _nextAOTHeaderId;
     size_t _nextThunkId;
+    size_t _numDeltas;
+    size_t _numTotalCachedAOTMethods; // In the base and all delta sections
+    size_t _snapshotSize; // Size in bytes of the valid part of the file; anything after it is ignored
 };
 
+// A read-only view of an AOT cache snapshot file. The file is memory-mapped if the
+// platform supports it, and otherwise read into persistent memory in one go.
+// Cached AOT methods are left in the snapshot and only copied out when first looked up.
+class JITServerAOTCacheSnapshot {
+public:
+    TR_PERSISTENT_ALLOC(TR_Memory::JITServerAOTCache)
+
+    // Returns NULL if the file cannot be opened or read
+    static JITServerAOTCacheSnapshot *open(const std::string &fileName);
+    ~JITServerAOTCacheSnapshot();
+
+    const uint8_t *start() const { return _start; }
+
+    size_t size() const { return _size; }
+
+    bool isMapped() const { return _mmapHandle != NULL; }
+
+private:
+    JITServerAOTCacheSnapshot(J9MmapHandle *mmapHandle, const uint8_t *start, size_t size)
+        : _mmapHandle(mmapHandle)
+        , _start(start)
+        , _size(size)
+    {}
+
+    J9MmapHandle * const _mmapHandle;
+    const uint8_t * const _start;
+    const size_t _size;
+};
+
+struct JITServerAOTCacheSnapshotCursor;
+
 struct AOTCacheClassLoaderRecord;
 struct AOTCacheClassRecord;
 struct AOTCacheMethodRecord;
@@ -119,7 +160,8 @@ public:
     static void *allocate(size_t size);
     static void free(void *ptr);
 
-    template<class R> static R *readRecord(FILE *f, const JITServerAOTCacheReadContext &context);
+    template<class R>
+    static R *readRecord(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheReadContext &context);
 
     AOTCacheRecord *getNextRecord() const { return _nextRecord; }
 
@@ -151,7 +193,7 @@ public:
 private:
     using SerializationRecord = ClassLoaderSerializationRecord;
 
-    friend AOTCacheClassLoaderRecord *AOTCacheRecord::readRecord<>(FILE *f,
+    friend AOTCacheClassLoaderRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
         const JITServerAOTCacheReadContext &context);
 
     AOTCacheClassLoaderRecord(uintptr_t id, const uint8_t *name, size_t nameLength);
@@ -188,7 +230,8 @@ public:
 private:
     using SerializationRecord = ClassSerializationRecord;
 
-    friend AOTCacheClassRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheClassRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
         const JITServerROMClassHash &hash, uint32_t romClassSize, bool generated, const J9ROMClass *romClass,
@@ -222,7 +265,8 @@ public:
 private:
     using SerializationRecord = MethodSerializationRecord;
 
-    friend AOTCacheMethodRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheMethodRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheMethodRecord(uintptr_t id, const AOTCacheClassRecord *definingClassRecord, uint32_t index);
     AOTCacheMethodRecord(const JITServerAOTCacheReadContext &context, const MethodSerializationRecord &header);
@@ -271,7 +315,8 @@ private:
 
     using SerializationRecord = ClassChainSerializationRecord;
 
-    friend AOTCacheClassChainRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheClassChainRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     virtual bool setSubrecordPointers(const JITServerAOTCacheReadContext &context) override;
 
@@ -320,7 +365,7 @@ private:
 
     using SerializationRecord = WellKnownClassesSerializationRecord;
 
-    friend AOTCacheWellKnownClassesRecord *AOTCacheRecord::readRecord<>(FILE *f,
+    friend AOTCacheWellKnownClassesRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
         const JITServerAOTCacheReadContext &context);
 
     virtual bool setSubrecordPointers(const JITServerAOTCacheReadContext &context) override;
@@ -343,7 +388,8 @@ public:
 private:
     using SerializationRecord = AOTHeaderSerializationRecord;
 
-    friend AOTCacheAOTHeaderRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheAOTHeaderRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheAOTHeaderRecord(uintptr_t id, const TR_AOTHeader *header);
 
@@ -368,7 +414,8 @@ public:
 private:
     using SerializationRecord = ThunkSerializationRecord;
 
-    friend AOTCacheThunkRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheThunkRecord *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheThunkRecord(uintptr_t id, const uint8_t *signature, uint32_t signatureSize, const uint8_t *thunkStart,
         uint32_t thunkSize);
@@ -427,7 +474,8 @@ public:
 private:
     using SerializationRecord = SerializedAOTMethod;
 
-    friend CachedAOTMethod *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend CachedAOTMethod *AOTCacheRecord::readRecord<>(JITServerAOTCacheSnapshotCursor &cursor,
+        const JITServerAOTCacheReadContext &context);
 
     CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index, TR_Hotness optLevel,
         const AOTCacheAOTHeaderRecord *aotHeaderRecord,
@@ -539,10 +587,20 @@ public:
 
     void printStats(FILE *f) const;
 
-    size_t writeCache(FILE *f) const;
-    static JITServerAOTCache *readCache(FILE *f, const std::string &name, TR_Memory &trMemory);
+    // Write a full snapshot of the cache. Returns the number of AOT methods written, or 0 on failure.
+    size_t writeCache(FILE *f);
+    // Append the records and methods added since the last save by this server to the snapshot
+    // file it wrote. Returns the number of AOT methods in the file afterwards, or 0 if the file
+    // was written by someone else since then (or on failure), in which case a full save is needed.
+    size_t appendDeltaToSnapshot(const std::string &cacheFileName);
+    // Build a cache from a snapshot, taking ownership of the snapshot.
+    // Returns NULL if the snapshot is ill-formed or incompatible with the running server.
+    static JITServerAOTCache *readCache(JITServerAOTCacheSnapshot *snapshot, const std::string &name);
     size_t getNumCachedMethods() const;
 
+    // Signatures of all the methods in the cache, including the ones not yet materialized from its snapshot
+    void getCachedMethodSignatures(std::vector<std::string> &signatures) const;
+
     void setMinNumAOTMethodsToSave(size_t num) { _minNumAOTMethodsToSave = num; }
 
     /**
@@ -581,17 +639,11 @@ public:
     */
     bool isAOTCacheBetterThanSnapshot(const std::string &cacheFileName, size_t numExtraMethods);
 
-    CachedAOTMethod *getCachedMethodHead() { return _cachedMethodHead; }
-
-    TR::Monitor *getCachedMethodMonitor() { return _cachedMethodMonitor; }
-
     // NOTE: Current implementation doesn't support compatible differences in AOT headers.
     //       A cached method can only be sent to a client with the exact same AOT header.
     using CachedMethodKey
         = std::tuple<const AOTCacheClassChainRecord *, uint32_t /*index*/, TR_Hotness, const AOTCacheAOTHeaderRecord *>;
 
-    const PersistentUnorderedMap<CachedMethodKey, CachedAOTMethod *> &getCachedMethodMap() { return _cachedMethodMap; }
-
 private:
     static StringKey getRecordKey(const AOTCacheClassLoaderRecord *record)
     {
@@ -675,11 +727,30 @@ private:
     void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
         UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
     // Read a cache snapshot into an empty cache
-    bool readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory);
+    bool readCache(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheHeader &header);
+    // Read the base section or a delta section of a cache snapshot
+    bool readSection(JITServerAOTCacheSnapshotCursor &cursor, const JITServerAOTCacheHeader &header);
 
     template<typename K, typename V, typename H>
-    static bool readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-        PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records);
+    static bool readRecords(JITServerAOTCacheSnapshotCursor &cursor, JITServerAOTCacheReadContext &context,
+        size_t numRecordsToRead, PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail,
+        PersistentVector<V *> &records);
+
+    // Fill in the record counts and next IDs of a snapshot section holding the records that follow the first
+    // ones counted in `written`. Only the cached methods in the _cachedMethodHead traversal are counted.
+    void getSectionHeader(JITServerAOTCacheHeader &header, const JITServerAOTCacheHeader &written) const;
+    bool writeSection(FILE *f, const JITServerAOTCacheHeader &header, const JITServerAOTCacheHeader &written,
+        bool writeSnapshotMethods, size_t &bytesWritten) const;
+
+    // Number of methods stored in the cache or indexed in its snapshot; must be called with the _cachedMethodMonitor held
+    size_t numCachedMethods() const
+    {
+        return _cachedMethodMap.size() - _numMaterializedMethods + _snapshotMethodMap.size();
+    }
+
+    // Copy a cached AOT method out of the snapshot this cache was loaded from, if it is there.
+    // Must be called with the _cachedMethodMonitor held.
+    CachedAOTMethod *materializeSnapshotMethod(const CachedMethodKey &key);
 
     const std::string _name;
     JITServerSharedProfileCache * const _sharedProfileCache;
@@ -729,11 +800,27 @@ private:
     AOTCacheThunkRecord *_thunkTail;
     TR::Monitor * const _thunkMonitor;
 
+    // Methods materialized from the snapshot are in the map, but not in the traversal; the traversal
+    // only has the methods stored since the cache was created or loaded.
     PersistentUnorderedMap<CachedMethodKey, CachedAOTMethod *> _cachedMethodMap;
     CachedAOTMethod *_cachedMethodHead;
     CachedAOTMethod *_cachedMethodTail;
     TR::Monitor * const _cachedMethodMonitor;
 
+    // The snapshot this cache was loaded from, if any, and an index of the methods in it.
+    // Both are immutable once the cache is loaded, so they can be read without holding a monitor.
+    JITServerAOTCacheSnapshot *_snapshot;
+    JITServerAOTCacheReadContext *_snapshotContext;
+    PersistentUnorderedMap<CachedMethodKey, const SerializedAOTMethod *> _snapshotMethodMap;
+    size_t _numMaterializedMethods;
+
+    // Header at the start of the snapshot file last written by this server, and the cumulative number of
+    // records of each type in that file. Only accessed by the thread performing a save operation.
+    JITServerAOTCacheHeader _savedHeader;
+    JITServerAOTCacheHeader _savedCounts;
+    JITServerAOTCacheHeader _pendingSavedHeader;
+    JITServerAOTCacheHeader _pendingSavedCounts;
+
     uint64_t _timePrevSaveOperation; // Millis when this cache was last saved to file
     size_t _minNumAOTMethodsToSave; // Minimum number of AOT methods present in the cache before considering a save
                                     // operation
@@ -747,6 +834,7 @@ private:
     size_t _numDeserializedMethods;
     size_t _numDeserializationFailures;
     size_t _numGeneratedClasses;
+    size_t _numDeltaSaves;
 };
 
 // Maps AOT cache names to JITServerAOTCache instances
@@ -774,7 +862,7 @@ public:
        Any exceptions thrown by this method are caught and logged.
        This method acquires the AOTCacheMap monitor.
     */
-    void loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider);
+    void loadNextQueuedAOTCacheFromFile();
 
     /**
        @brief Obtain a pointer to a named AOT cache. If it doesn't exist, attempt to create one.
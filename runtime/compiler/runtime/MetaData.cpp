@@ -61,6 +61,7 @@
 #include "il/TreeTop_inlines.hpp"
 #include "runtime/ArtifactManager.hpp"
 #include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
 #include "runtime/MethodMetaData.h"
 #include "runtime/asmprotos.h"
 #include "env/VMJ9.h"
@@ -1400,6 +1401,11 @@ TR_MethodMetaData *createMethodMetaData(TR_J9VMBase &vmArg, TR_ResolvedMethod *v
         data->flags |= JIT_METADATA_IS_FSD_COMP;
     }
 
+    // The code cache uncounts hot code bytes for bodies with this flag when they are freed
+    if (TR::CodeCacheManager::isHotCodeCompilation(comp)) {
+        data->flags |= JIT_METADATA_IS_HOT_CODE;
+    }
+
 #if defined(J9VM_INTERP_AOT_COMPILE_SUPPORT)
     if (vm->isAOT_DEPRECATED_DO_NOT_USE()
 #if defined(J9VM_OPT_JITSERVER)
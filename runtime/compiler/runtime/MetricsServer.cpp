@@ -132,6 +132,12 @@ double ActiveThreadsMetric::computeValue(TR::CompilationInfo *compInfo)
     return getValue();
 }
 
+double MessageCompressionBytesSavedMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(JITServer::CommunicationStream::_compressionBytesSaved);
+    return getValue();
+}
+
 MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     : _compInfo(compInfo)
 {
@@ -139,7 +145,8 @@ MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     _metrics[1] = new (PERSISTENT_NEW) AvailableMemoryMetric();
     _metrics[2] = new (PERSISTENT_NEW) ConnectedClientsMetric();
     _metrics[3] = new (PERSISTENT_NEW) ActiveThreadsMetric();
-    static_assert(3 == MAX_METRICS - 1, "Unsupported number of metrics");
+    _metrics[4] = new (PERSISTENT_NEW) MessageCompressionBytesSavedMetric();
+    static_assert(4 == MAX_METRICS - 1, "Unsupported number of metrics");
 }
 
 MetricsDatabase::~MetricsDatabase()
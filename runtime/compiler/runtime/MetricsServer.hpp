@@ -129,6 +129,20 @@ public:
     virtual double computeValue(TR::CompilationInfo *compInfo);
 }; // class ActiveThreadsMetric
 
+/**
+   @brief Class used to serialize the number of bytes JITServer message compression kept off the network,
+   as a metric understood by Prometheus
+ */
+class MessageCompressionBytesSavedMetric : public PrometheusMetric {
+public:
+    MessageCompressionBytesSavedMetric()
+        : PrometheusMetric("jitserver_message_compression_bytes_saved",
+              "Number of bytes saved by compressing messages exchanged with clients")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class MessageCompressionBytesSavedMetric
+
 /**
    @class MetricsDatabase
    @brief Collection of metrics that need to be sent to Prometheus on demand
@@ -140,7 +154,7 @@ public:
  */
 class MetricsDatabase {
 public:
-    static const size_t MAX_METRICS = 4; // Maximum number of metrics our database can hold
+    static const size_t MAX_METRICS = 5; // Maximum number of metrics our database can hold
     MetricsDatabase(TR::CompilationInfo *compInfo);
     ~MetricsDatabase();
 
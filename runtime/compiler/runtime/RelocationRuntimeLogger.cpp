@@ -31,6 +31,7 @@
 #include "j9cp.h"
 #include "j9protos.h"
 #include "rommeth.h"
+#include "compile/Compilation.hpp"
 #include "env/FrontEnd.hpp"
 #include "control/CompilationThread.hpp"
 #include "control/Options.hpp"
@@ -42,6 +43,7 @@
 #include "runtime/RelocationRecord.hpp"
 #include "runtime/RelocationRuntime.hpp"
 #include "runtime/RelocationTarget.hpp"
+#include "runtime/SymbolValidationManager.hpp"
 
 // RelocationRuntimeLogger class
 static const char *headerTag = "relocatableDataRT";
@@ -199,9 +201,19 @@ void TR_RelocationRuntimeLogger::relocationTime()
             reinterpret_cast<void *>(reloRuntime()->exceptionTable()->startPC),
             reinterpret_cast<void *>(reloRuntime()->exceptionTable()->endPC));
 
-        rtlogPrintf(jitConfig(), reloRuntime()->fej9()->_compInfoPT, " Time: %d usec\n",
+        rtlogPrintf(jitConfig(), reloRuntime()->fej9()->_compInfoPT, " Time: %d usec",
             static_cast<uint32_t>(reloEndTime - _reloStartTime));
 
+        TR::Compilation *comp = reloRuntime()->comp();
+        TR::SymbolValidationManager *svm = comp->getOption(TR_UseSymbolValidationManager)
+            ? comp->getSymbolValidationManager()
+            : NULL;
+        if (svm)
+            rtlogPrintf(jitConfig(), reloRuntime()->fej9()->_compInfoPT, " SVM cache hits: %u misses: %u",
+                svm->getNumValidationCacheHits(), svm->getNumValidationCacheMisses());
+
+        rtlogPrintf(jitConfig(), reloRuntime()->fej9()->_compInfoPT, "\n");
+
         unlockLog(wasLocked);
     }
 }
@@ -29,6 +29,8 @@
 #include "env/PersistentCHTable.hpp"
 #include "env/VMAccessCriticalSection.hpp"
 #include "exceptions/AOTFailure.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "compile/J9Compilation.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/CompilationThread.hpp"
@@ -78,6 +80,10 @@ TR::SymbolValidationManager::SymbolValidationManager(TR::Region &region, TR_Reso
     , _chTable(_comp->getPersistentInfo()->getPersistentCHTable())
     , _rootClass(compilee->classOfMethod())
     , _wellKnownClassChainOffsets(NULL)
+    , _validatedWellKnownClassChainOffsets(NULL)
+    , _validationCache(_comp->getPersistentInfo()->getSymbolValidationCache())
+    , _numValidationCacheHits(0)
+    , _numValidationCacheMisses(0)
     ,
 #if defined(J9VM_OPT_JITSERVER)
     _aotCacheWellKnownClassesRecord(NULL)
@@ -317,22 +323,45 @@ bool TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *well
     // relocations, in which case the Compilation is reused.
     bool assignNewIDs = _wellKnownClassChainOffsets == NULL;
     int classCount = static_cast<int>(wellKnownClassChainOffsets[0]);
-    for (int i = 1; i <= classCount; i++) {
-        uintptr_t classChainOffset = wellKnownClassChainOffsets[i];
-        uintptr_t *classChain
-            = reinterpret_cast<uintptr_t *>(_fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
-        J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
-        J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+    TR_OpaqueClassBlock **classes
+        = static_cast<TR_OpaqueClassBlock **>(_region.allocate(classCount * sizeof(TR_OpaqueClassBlock *)));
+
+    // Bodies compiled with the same well-known classes share the class chain
+    // offsets in the SCC, so the lookups below only need to succeed once.
+    // Deserialized methods are excluded, since the deserializer's offsets do
+    // not outlive a reset and so cannot key the per-JVM cache.
+    bool useCache = _validationCache && !_comp->isDeserializedAOTMethod() && !_comp->ignoringLocalSCC();
+    if (useCache && _validationCache->getValidatedWellKnownClasses(wellKnownClassChainOffsets, classes)) {
+        _numValidationCacheHits++;
+    } else {
+        if (useCache)
+            _numValidationCacheMisses++;
 
-        TR_OpaqueClassBlock *clazz = _fej9->getSystemClassFromClassName(
-            reinterpret_cast<const char *>(J9UTF8_DATA(className)), J9UTF8_LENGTH(className));
+        for (int i = 0; i < classCount; i++) {
+            uintptr_t classChainOffset = wellKnownClassChainOffsets[i + 1];
+            uintptr_t *classChain = reinterpret_cast<uintptr_t *>(
+                _fej9->sharedCache()->pointerFromOffsetInSharedCache(classChainOffset));
+            J9ROMClass *romClass = _fej9->sharedCache()->startingROMClassOfClassChain(classChain);
+            J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
 
-        if (clazz == NULL)
-            return false;
+            TR_OpaqueClassBlock *clazz = _fej9->getSystemClassFromClassName(
+                reinterpret_cast<const char *>(J9UTF8_DATA(className)), J9UTF8_LENGTH(className));
 
-        if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
-            return false;
+            if (clazz == NULL)
+                return false;
+
+            if (!_fej9->sharedCache()->classMatchesCachedVersion(clazz, classChain))
+                return false;
+
+            classes[i] = clazz;
+        }
+
+        if (useCache)
+            _validationCache->cacheValidatedWellKnownClasses(wellKnownClassChainOffsets, classes);
+    }
 
+    for (int i = 0; i < classCount; i++) {
+        TR_OpaqueClassBlock *clazz = classes[i];
         _seenValuesSet.insert(clazz);
         if (assignNewIDs) {
             _wellKnownClasses.push_back(clazz);
@@ -340,6 +369,8 @@ bool TR::SymbolValidationManager::validateWellKnownClasses(const uintptr_t *well
                 setValueOfSymbolID(getNewSymbolID(), clazz, TR::SymbolType::typeClass);
         }
     }
+    if (useCache)
+        _validatedWellKnownClassChainOffsets = wellKnownClassChainOffsets;
 
     // These classes are definitely visible to any other class defined by the
     // bootstrap loader.
@@ -369,12 +400,22 @@ bool TR::SymbolValidationManager::classCanSeeWellKnownClasses(TR_OpaqueClassBloc
     J9ClassLoader *loader = reinterpret_cast<J9ClassLoader *>(_fej9->getClassLoader(beholder));
     {
         // Use linear search - the number of loaders will generally be small.
-        auto begin = _loadersOkForWellKnownClasses.end();
+        auto begin = _loadersOkForWellKnownClasses.begin();
         auto end = _loadersOkForWellKnownClasses.end();
         if (std::find(begin, end, loader) != end)
             return true;
     }
 
+    // During an AOT load, other loads may already have checked this loader.
+    if (_validatedWellKnownClassChainOffsets) {
+        if (_validationCache->loaderCanSeeWellKnownClasses(_validatedWellKnownClassChainOffsets, loader)) {
+            _numValidationCacheHits++;
+            _loadersOkForWellKnownClasses.push_back(loader);
+            return true;
+        }
+        _numValidationCacheMisses++;
+    }
+
     // Check that every well-known class can be found. It's good enough here to
     // find anything (non-null) for a given name, because these names can only
     // be defined by the bootstrap loader, so if the class is found, then it
@@ -392,6 +433,8 @@ bool TR::SymbolValidationManager::classCanSeeWellKnownClasses(TR_OpaqueClassBloc
     // All of the well-known classes are visible. This will be the case for all
     // classes using the same loader, because the well-known classes are public.
     _loadersOkForWellKnownClasses.push_back(loader);
+    if (_validatedWellKnownClassChainOffsets)
+        _validationCache->cacheLoaderCanSeeWellKnownClasses(_validatedWellKnownClassChainOffsets, loader);
     return true;
 }
 
@@ -2281,3 +2324,138 @@ void TR::MethodsFromClass::printFields()
     printClass(_clazz);
     log->printf("\t_startingSymbolID=%d\n", (uint32_t)_startingSymbolID);
 }
+
+TR::SymbolValidationCache::SymbolValidationCache(TR::Monitor *monitor)
+    : _monitor(monitor)
+    , _entries(NULL)
+{}
+
+TR::SymbolValidationCache::WellKnownClassesEntry *TR::SymbolValidationCache::findEntry(
+    const uintptr_t *wellKnownClassChainOffsets)
+{
+    for (WellKnownClassesEntry *entry = _entries; entry; entry = entry->_next) {
+        if (entry->_classChainOffsets == wellKnownClassChainOffsets)
+            return entry;
+    }
+    return NULL;
+}
+
+void TR::SymbolValidationCache::freeEntry(WellKnownClassesEntry *entry)
+{
+    LoaderEntry *loaderEntry = entry->_loaders;
+    while (loaderEntry) {
+        LoaderEntry *next = loaderEntry->_next;
+        TR_Memory::jitPersistentFree(loaderEntry);
+        loaderEntry = next;
+    }
+    TR_Memory::jitPersistentFree(entry->_classes);
+    TR_Memory::jitPersistentFree(entry);
+}
+
+bool TR::SymbolValidationCache::getValidatedWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets,
+    TR_OpaqueClassBlock **classes)
+{
+    OMR::CriticalSection searchingEntries(_monitor);
+    WellKnownClassesEntry *entry = findEntry(wellKnownClassChainOffsets);
+    if (!entry)
+        return false;
+
+    memcpy(classes, entry->_classes, wellKnownClassChainOffsets[0] * sizeof(TR_OpaqueClassBlock *));
+    return true;
+}
+
+void TR::SymbolValidationCache::cacheValidatedWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets,
+    TR_OpaqueClassBlock * const *classes)
+{
+    size_t classesSize = wellKnownClassChainOffsets[0] * sizeof(TR_OpaqueClassBlock *);
+    WellKnownClassesEntry *entry = (WellKnownClassesEntry *)TR_Memory::jitPersistentAlloc(
+        sizeof(WellKnownClassesEntry), TR_Memory::SymbolValidationManager);
+    TR_OpaqueClassBlock **cachedClasses
+        = (TR_OpaqueClassBlock **)TR_Memory::jitPersistentAlloc(classesSize, TR_Memory::SymbolValidationManager);
+    if (!entry || !cachedClasses) {
+        if (entry)
+            TR_Memory::jitPersistentFree(entry);
+        if (cachedClasses)
+            TR_Memory::jitPersistentFree(cachedClasses);
+        return;
+    }
+
+    memcpy(cachedClasses, classes, classesSize);
+    entry->_classChainOffsets = wellKnownClassChainOffsets;
+    entry->_classes = cachedClasses;
+    entry->_loaders = NULL;
+
+    OMR::CriticalSection addingEntry(_monitor);
+    // Another thread may have validated the same set concurrently
+    if (findEntry(wellKnownClassChainOffsets)) {
+        freeEntry(entry);
+        return;
+    }
+    entry->_next = _entries;
+    _entries = entry;
+}
+
+bool TR::SymbolValidationCache::loaderCanSeeWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets,
+    J9ClassLoader *loader)
+{
+    OMR::CriticalSection searchingLoaders(_monitor);
+    WellKnownClassesEntry *entry = findEntry(wellKnownClassChainOffsets);
+    if (!entry)
+        return false;
+
+    for (LoaderEntry *loaderEntry = entry->_loaders; loaderEntry; loaderEntry = loaderEntry->_next) {
+        if (loaderEntry->_loader == loader)
+            return true;
+    }
+    return false;
+}
+
+void TR::SymbolValidationCache::cacheLoaderCanSeeWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets,
+    J9ClassLoader *loader)
+{
+    OMR::CriticalSection addingLoader(_monitor);
+    // The entry is gone if classes were redefined since the well-known classes were validated
+    WellKnownClassesEntry *entry = findEntry(wellKnownClassChainOffsets);
+    if (!entry)
+        return;
+
+    for (LoaderEntry *loaderEntry = entry->_loaders; loaderEntry; loaderEntry = loaderEntry->_next) {
+        if (loaderEntry->_loader == loader)
+            return;
+    }
+
+    LoaderEntry *loaderEntry
+        = (LoaderEntry *)TR_Memory::jitPersistentAlloc(sizeof(LoaderEntry), TR_Memory::SymbolValidationManager);
+    if (!loaderEntry)
+        return;
+    loaderEntry->_loader = loader;
+    loaderEntry->_next = entry->_loaders;
+    entry->_loaders = loaderEntry;
+}
+
+void TR::SymbolValidationCache::invalidate()
+{
+    OMR::CriticalSection invalidatingEntries(_monitor);
+    while (_entries) {
+        WellKnownClassesEntry *next = _entries->_next;
+        freeEntry(_entries);
+        _entries = next;
+    }
+}
+
+void TR::SymbolValidationCache::onClassLoaderUnload(J9ClassLoader *loader)
+{
+    OMR::CriticalSection removingLoader(_monitor);
+    for (WellKnownClassesEntry *entry = _entries; entry; entry = entry->_next) {
+        LoaderEntry **prev = &entry->_loaders;
+        while (*prev) {
+            LoaderEntry *loaderEntry = *prev;
+            if (loaderEntry->_loader == loader) {
+                *prev = loaderEntry->_next;
+                TR_Memory::jitPersistentFree(loaderEntry);
+                break;
+            }
+            prev = &loaderEntry->_next;
+        }
+    }
+}
@@ -1543,6 +1543,101 @@ struct MethodsFromClass : public SymbolValidationRecord {
     TR_OpaqueClassBlock *_clazz;
 };
 
+class Monitor;
+
+/**
+ * @class SymbolValidationCache
+ * @brief Per-JVM memo of symbol validation results shared across AOT loads
+ *
+ * Symbol IDs are assigned per method, so validation records cannot be matched
+ * across AOT bodies by ID. What many bodies do share is their well-known
+ * classes' class chain offsets, which are stored once in the SCC and referenced
+ * by every body compiled with the same set of well-known classes. The result
+ * of validating such a set, and the loaders found to see all of its classes,
+ * are remembered here keyed by the SCC address of the offsets, so that later
+ * loads can skip the class lookups and class chain comparisons.
+ *
+ * Only successful validations are remembered, since a class that is missing
+ * now may be loaded later. All entries are dropped on class redefinition, and
+ * a loader is forgotten when it is unloaded.
+ */
+class SymbolValidationCache {
+public:
+    TR_PERSISTENT_ALLOC(TR_MemoryBase::SymbolValidationManager)
+
+    /**
+     * @brief Constructor
+     * @param monitor The monitor protecting the cache
+     */
+    SymbolValidationCache(TR::Monitor *monitor);
+
+    /**
+     * @brief Look up the classes of a previously validated set of well-known classes
+     * @param wellKnownClassChainOffsets The well-known classes' class chain offsets, keying the entry
+     * @param classes Receives the validated classes, in the order of the offsets
+     * @return true if the set was found, false otherwise
+     */
+    bool getValidatedWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, TR_OpaqueClassBlock **classes);
+
+    /**
+     * @brief Remember a successfully validated set of well-known classes
+     * @param wellKnownClassChainOffsets The well-known classes' class chain offsets, keying the entry
+     * @param classes The validated classes, in the order of the offsets
+     */
+    void cacheValidatedWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets,
+        TR_OpaqueClassBlock * const *classes);
+
+    /**
+     * @brief Check whether a loader is already known to see a set of well-known classes
+     * @param wellKnownClassChainOffsets The well-known classes' class chain offsets, keying the entry
+     * @param loader The class loader
+     * @return true if the loader was previously found to see all of the classes, false otherwise
+     */
+    bool loaderCanSeeWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, J9ClassLoader *loader);
+
+    /**
+     * @brief Remember that a loader sees a set of well-known classes
+     * @param wellKnownClassChainOffsets The well-known classes' class chain offsets, keying the entry
+     * @param loader The class loader
+     */
+    void cacheLoaderCanSeeWellKnownClasses(const uintptr_t *wellKnownClassChainOffsets, J9ClassLoader *loader);
+
+    /**
+     * @brief Drop all entries; called when classes are redefined
+     */
+    void invalidate();
+
+    /**
+     * @brief Forget an unloaded class loader
+     * @param loader The class loader being unloaded
+     */
+    void onClassLoaderUnload(J9ClassLoader *loader);
+
+private:
+    struct LoaderEntry {
+        LoaderEntry *_next;
+        J9ClassLoader *_loader;
+    };
+
+    struct WellKnownClassesEntry {
+        WellKnownClassesEntry *_next;
+        const uintptr_t *_classChainOffsets;
+        TR_OpaqueClassBlock **_classes;
+        LoaderEntry *_loaders;
+    };
+
+    /** Find the entry for a set of well-known classes; the monitor must be held */
+    WellKnownClassesEntry *findEntry(const uintptr_t *wellKnownClassChainOffsets);
+
+    /** Free an entry and its loader list */
+    static void freeEntry(WellKnownClassesEntry *entry);
+
+    /** Synchronizes the compilation threads performing AOT loads */
+    TR::Monitor *_monitor;
+    /** Validated sets of well-known classes; there is typically only one per SCC layer */
+    WellKnownClassesEntry *_entries;
+};
+
 /**
  * @class SymbolValidationManager
  * @brief Manages symbol validation for AOT compilation and loading
@@ -1609,6 +1704,18 @@ public:
      */
     const void *wellKnownClassChainOffsets() const { return _wellKnownClassChainOffsets; }
 
+    /**
+     * @brief Get the number of validations answered by the per-JVM validation cache
+     * @return The number of cache hits during this AOT load
+     */
+    uint32_t getNumValidationCacheHits() const { return _numValidationCacheHits; }
+
+    /**
+     * @brief Get the number of validations the per-JVM validation cache could not answer
+     * @return The number of cache misses during this AOT load
+     */
+    uint32_t getNumValidationCacheMisses() const { return _numValidationCacheMisses; }
+
 #if defined(J9VM_OPT_JITSERVER)
     /**
      * @brief Get the AOT cache well-known classes record (JITServer only)
@@ -2742,6 +2849,14 @@ private:
     TR_OpaqueClassBlock *_rootClass;
     /** Well-known class chain offsets */
     const void *_wellKnownClassChainOffsets;
+    /** Well-known class chain offsets validated during an AOT load, keying the per-JVM validation cache */
+    const uintptr_t *_validatedWellKnownClassChainOffsets;
+    /** Per-JVM validation cache; NULL if disabled */
+    SymbolValidationCache * const _validationCache;
+    /** Number of validations answered by the per-JVM validation cache */
+    uint32_t _numValidationCacheHits;
+    /** Number of validations the per-JVM validation cache could not answer */
+    uint32_t _numValidationCacheMisses;
 #if defined(J9VM_OPT_JITSERVER)
     /** AOT cache well-known classes record (JITServer only) */
     const AOTCacheWellKnownClassesRecord *_aotCacheWellKnownClassesRecord;
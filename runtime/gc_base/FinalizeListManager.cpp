@@ -63,7 +63,7 @@ GC_FinalizeListManager::newInstance(MM_EnvironmentBase *env)
 	manager = (GC_FinalizeListManager *)env->getForge()->allocate(sizeof(GC_FinalizeListManager), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
 	if (manager) {
 		new(manager) GC_FinalizeListManager(MM_GCExtensions::getExtensions(env));
-		if (!manager->initialize()) {
+		if (!manager->initialize(env)) {
 			manager->kill(env);
 			return NULL;
 		}
@@ -78,35 +78,74 @@ GC_FinalizeListManager::newInstance(MM_EnvironmentBase *env)
 void
 GC_FinalizeListManager::kill(MM_EnvironmentBase *env)
 {
-	tearDown();
+	tearDown(env);
 	env->getForge()->free(this);
 } 
 
 /**
- * initialize with default values and create the mutex
+ * initialize with default values, create the mutex and allocate one reference shard per reference thread
  * @return true if initialisation successful, false otherwise.
  */
 bool
-GC_FinalizeListManager::initialize()
+GC_FinalizeListManager::initialize(MM_EnvironmentBase *env)
 {
 	if (omrthread_monitor_init_with_name(&_mutex, 0, "FinalizeListManager")) {
 		_mutex = NULL;
 		return false;
 	}
+
+	_referenceShardCount = OMR_MAX(_extensions->finalizeReferenceThreadCount, 1);
+	_referenceShards = (GC_FinalizeReferenceShard *)env->getForge()->allocate(sizeof(GC_FinalizeReferenceShard) * _referenceShardCount, MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL == _referenceShards) {
+		_referenceShardCount = 0;
+		return false;
+	}
+	memset(_referenceShards, 0, sizeof(GC_FinalizeReferenceShard) * _referenceShardCount);
 	
 	return true;
 }
 
 /**
- * deinitialize FinalizeListManager (destroy the mutex)
+ * deinitialize FinalizeListManager (destroy the mutex and free the reference shards)
  */
 void
-GC_FinalizeListManager::tearDown()
+GC_FinalizeListManager::tearDown(MM_EnvironmentBase *env)
 {
 	if(NULL != _mutex) {
 		omrthread_monitor_destroy(_mutex);
 		_mutex = NULL;
 	}
+	if (NULL != _referenceShards) {
+		env->getForge()->free(_referenceShards);
+		_referenceShards = NULL;
+		_referenceShardCount = 0;
+	}
+}
+
+void
+GC_FinalizeListManager::jobsAdded()
+{
+	UDATA jobCount = getJobCountNoLock();
+
+	if (jobCount > _peakJobCount) {
+		_peakJobCount = jobCount;
+	}
+
+	UDATA threshold = _extensions->finalizeBacklogThreshold;
+	if ((0 != threshold) && !_backlogged && (jobCount > threshold)) {
+		_backlogged = true;
+		_backlogSignalCount += 1;
+	}
+}
+
+void
+GC_FinalizeListManager::jobConsumed()
+{
+	_consumedJobCount += 1;
+
+	if (_backlogged && (getJobCountNoLock() <= (_extensions->finalizeBacklogThreshold / 2))) {
+		_backlogged = false;
+	}
 }
 
 void
@@ -117,6 +156,7 @@ GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
 	_systemFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -142,6 +182,7 @@ GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
 	_defaultFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -164,24 +205,38 @@ GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UD
 {
 	lock();
 
-	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
-	_referenceObjects = head;
-	_referenceObjectCount += objectCount;
+	GC_FinalizeReferenceShard *shard = &_referenceShards[_nextReferenceShard];
+	_nextReferenceShard = (_nextReferenceShard + 1) % _referenceShardCount;
+
+	_extensions->accessBarrier->setReferenceLink(tail, shard->head);
+	if (NULL == shard->head) {
+		shard->tail = tail;
+	}
+	shard->head = head;
+	shard->count += objectCount;
+	jobsAdded();
 
 	unlock();
 }
 
 j9object_t
-GC_FinalizeListManager::popReferenceObject()
+GC_FinalizeListManager::popReferenceObject(UDATA shardIndex)
 {
-	j9object_t value = _referenceObjects;
-
-	if (NULL != value) {
-		_referenceObjects = _extensions->accessBarrier->getReferenceLink(value);
-		_referenceObjectCount -= 1;
+	for (UDATA i = 0; i < _referenceShardCount; i++) {
+		GC_FinalizeReferenceShard *shard = &_referenceShards[(shardIndex + i) % _referenceShardCount];
+		j9object_t value = shard->head;
+
+		if (NULL != value) {
+			shard->head = _extensions->accessBarrier->getReferenceLink(value);
+			if (NULL == shard->head) {
+				shard->tail = NULL;
+			}
+			shard->count -= 1;
+			return value;
+		}
 	}
 
-	return value;
+	return NULL;
 }
 
 void
@@ -192,6 +247,7 @@ GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
 	_classLoaderCount += count;
+	jobsAdded();
 
 	unlock();
 }
@@ -243,10 +299,12 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
 	
 	{
-		j9object_t referenceObject = popReferenceObject();
+		j9object_t referenceObject = popReferenceObject(0);
 		if (NULL != referenceObject) {
 			job->type = FINALIZE_JOB_TYPE_REFERENCE;
 			job->reference = referenceObject;
+			_referenceJobsInFlight += 1;
+			jobConsumed();
 
 			return job;
 		}
@@ -257,6 +315,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != loader) {
 			job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
 			job->classLoader = loader;
+			jobConsumed();
 
 			return job;
 		}
@@ -267,6 +326,7 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != defaultObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = defaultObject;
+			jobConsumed();
 
 			return job;
 		}
@@ -277,6 +337,40 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		if (NULL != systemObject) {
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
 			job->object = systemObject;
+			jobConsumed();
+
+			return job;
+		}
+	}
+
+	return NULL;
+}
+
+GC_FinalizeJob *
+GC_FinalizeListManager::consumeHelperJob(J9VMThread *vmThread, GC_FinalizeJob *job, UDATA shardIndex)
+{
+	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
+
+	j9object_t object = popReferenceObject(shardIndex);
+	if (NULL != object) {
+		job->type = FINALIZE_JOB_TYPE_REFERENCE;
+		job->reference = object;
+		_referenceJobsInFlight += 1;
+		jobConsumed();
+
+		return job;
+	}
+
+	if (_backlogged) {
+		object = popDefaultFinalizableObject();
+		if (NULL == object) {
+			object = popSystemFinalizableObject();
+		}
+		if (NULL != object) {
+			job->type = FINALIZE_JOB_TYPE_OBJECT;
+			job->object = object;
+			jobConsumed();
 
 			return job;
 		}
@@ -56,6 +56,17 @@ typedef struct GC_FinalizeJob {
 	};
 } GC_FinalizeJob;
 
+/**
+ * One shard of the pending reference list. Shards are filled round robin by the GC
+ * and drained by the finalize worker and the reference helper threads, each of which
+ * starts at its own shard and steals from the others once it is empty.
+ */
+typedef struct GC_FinalizeReferenceShard {
+	j9object_t head; /**< head of the linked list of reference objects in this shard */
+	j9object_t tail; /**< tail of the linked list of reference objects in this shard */
+	UDATA count; /**< count of the reference objects in this shard */
+} GC_FinalizeReferenceShard;
+
 /**
  * Provides facility for the management of the finalizer queue
  * @ingroup GC_Base
@@ -71,10 +82,16 @@ private:
     UDATA _systemFinalizableObjectCount; /** count of the system finalizable object  */
     j9object_t _defaultFinalizableObjects; /**< head of the linked list of objects allocated by non system classloaders that need to be finalized */
     UDATA _defaultFinalizableObjectCount; /** count of the default finalizable object  */
-    j9object_t _referenceObjects; /**< head of the linked list of reference objects that need to be enqueued */
-    UDATA _referenceObjectCount; /** count of the reference object */
+    GC_FinalizeReferenceShard *_referenceShards; /**< shards of the list of reference objects that need to be enqueued */
+    UDATA _referenceShardCount; /**< number of entries in _referenceShards */
+    UDATA _nextReferenceShard; /**< shard which receives the next list added by the GC */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+    UDATA _peakJobCount; /**< highest number of pending jobs seen since the last call to resetPeakJobCount() */
+    UDATA _consumedJobCount; /**< total number of jobs handed out to finalize threads */
+    UDATA _backlogSignalCount; /**< number of times the backlog rose above finalizeBacklogThreshold */
+    UDATA _referenceJobsInFlight; /**< number of reference jobs handed out to finalize threads and not yet processed */
+    bool _backlogged; /**< true from the time the backlog rises above finalizeBacklogThreshold until it drains to half of it */
 protected:
 public:
     
@@ -100,13 +117,54 @@ protected:
     j9object_t popDefaultFinalizableObject();
 
     /**
-     * Pop the head of the reference enqueue list
+     * Pop the head of a reference enqueue shard, starting at the given shard and
+     * stealing from the following ones if it is empty
      *
      * @note Must be called while holding this class' _mutex
      *
-     * @return the current head of the list, or NULL if the list is empty
+     * @param shardIndex[in] the shard preferred by the calling thread
+     *
+     * @return the head of the first non-empty shard, or NULL if all shards are empty
+     */
+    j9object_t popReferenceObject(UDATA shardIndex);
+
+    /**
+     * Find the first non-empty reference shard at or after the given index
+     *
+     * @param shardIndex[in] the index to start searching from
+     *
+     * @return the head of the first non-empty shard, or NULL if there is none
+     */
+    MMINLINE j9object_t firstReferenceObjectFrom(UDATA shardIndex)
+    {
+        for (UDATA i = shardIndex; i < _referenceShardCount; i++) {
+            if (NULL != _referenceShards[i].head) {
+                return _referenceShards[i].head;
+            }
+        }
+        return NULL;
+    }
+
+    /**
+     * Account for jobs added to the lists: update the peak backlog and raise the
+     * backlog signal if the total crosses finalizeBacklogThreshold.
+     *
+     * @note Must be called while holding this class' _mutex
      */
-    j9object_t popReferenceObject();
+    void jobsAdded();
+
+    /**
+     * Account for a job handed out to a finalize thread, dropping the backlog signal
+     * once the lists have drained to half of finalizeBacklogThreshold.
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void jobConsumed();
+
+    MMINLINE UDATA getJobCountNoLock() const
+    {
+        return _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + getReferenceCount();
+    }
 
     /**
      * Pop the head of the classloader list
@@ -128,7 +186,7 @@ public:
 	virtual UDATA getJobCount() const
 	{
 		lock();
-		UDATA count = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+		UDATA count = getJobCountNoLock();
 		unlock();
 		return count;
 	}
@@ -136,12 +194,59 @@ public:
 	virtual UDATA getSystemCount() {return _systemFinalizableObjectCount;}
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
-	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
+	MMINLINE UDATA getReferenceCount() const
+	{
+		UDATA count = 0;
+		for (UDATA i = 0; i < _referenceShardCount; i++) {
+			count += _referenceShards[i].count;
+		}
+		return count;
+	}
+	MMINLINE UDATA getReferenceShardCount() {return _referenceShardCount;}
+	MMINLINE UDATA getPeakJobCount() {return _peakJobCount;}
+	MMINLINE UDATA getConsumedJobCount() {return _consumedJobCount;}
+	MMINLINE UDATA getBacklogSignalCount() {return _backlogSignalCount;}
+
+	/**
+	 * Determine whether the pending job count has risen above finalizeBacklogThreshold
+	 * and not yet drained back. While this is the case the reference helper threads
+	 * also run finalizers. With a single reference thread there are no helpers, and
+	 * the state is only reported.
+	 * @return true if the finalize lists are backlogged
+	 */
+	MMINLINE bool isBacklogged() {return _backlogged;}
+
+	/**
+	 * Determine the number of reference jobs that are either pending or handed out to
+	 * a finalize thread and not yet reported processed by referenceJobProcessed().
+	 * @return the number of references still to be enqueued
+	 */
+	MMINLINE UDATA getUnprocessedReferenceCount() const {return getReferenceCount() + _referenceJobsInFlight;}
+
+	/**
+	 * Report that a reference job returned by consumeJob() or consumeHelperJob() has been processed.
+	 */
+	void referenceJobProcessed()
+	{
+		lock();
+		_referenceJobsInFlight -= 1;
+		unlock();
+	}
+
+	/**
+	 * Start a new peak backlog measurement period at the current job count.
+	 */
+	void resetPeakJobCount()
+	{
+		lock();
+		_peakJobCount = getJobCountNoLock();
+		unlock();
+	}
 
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
-	bool initialize();
-	void tearDown();
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
 
 	/**
 	 * Add the list of objects to the system finalizable list
@@ -160,7 +265,7 @@ public:
 	 */
 	virtual void addDefaultFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount);
 	/**
-	 * Add the list of reference objects to the reference list
+	 * Add the list of reference objects to the next reference shard
 	 *
 	 * @param head[in] head of the list to add
 	 * @param tail[in] tail of the list to add
@@ -201,15 +306,24 @@ public:
 		return value;
 	}
 	/**
-	 * Return the head of the reference enqueue list and set the list to NULL
+	 * Chain all reference shards into a single list, return its head and set all shards to NULL
 	 *
-	 * @return the current head of the list, or NULL if the list is empty
+	 * @return the head of the combined list, or NULL if all shards are empty
 	 */
 	j9object_t resetReferenceObjects()
 	{
-		j9object_t value = _referenceObjects;
-		_referenceObjects = NULL;
-		_referenceObjectCount = 0;
+		MM_ObjectAccessBarrier *barrier = _extensions->accessBarrier;
+		j9object_t value = NULL;
+		for (UDATA i = _referenceShardCount; i > 0; i--) {
+			GC_FinalizeReferenceShard *shard = &_referenceShards[i - 1];
+			if (NULL != shard->head) {
+				barrier->setReferenceLink(shard->tail, value);
+				value = shard->head;
+			}
+			shard->head = NULL;
+			shard->tail = NULL;
+			shard->count = 0;
+		}
 		return value;
 	}
 	/**
@@ -255,16 +369,17 @@ public:
 		return barrier->getFinalizeLink(current);
 	}
 	/**
-	 * Peek the head of the reference list
+	 * Peek the head of the reference list. The shards are walked as if they were one list.
 	 *
-	 * @return the current head of the list, or NULL if the list is empty
+	 * @return the head of the first non-empty shard, or NULL if all shards are empty
 	 */
 	MMINLINE j9object_t peekReferenceObject()
 	{
-		return _referenceObjects;
+		return firstReferenceObjectFrom(0);
 	}
 	/**
-	 * Peek the next of the reference list
+	 * Peek the next of the reference list, moving on to the next non-empty shard
+	 * at the tail of the current one.
 	 *
 	 * @param current[in] the current object to get the next from
 	 *
@@ -273,7 +388,16 @@ public:
 	MMINLINE j9object_t peekNextReferenceObject(j9object_t current)
 	{
 		MM_ObjectAccessBarrier *barrier = _extensions->accessBarrier;
-		return barrier->getReferenceLink(current);
+		j9object_t next = barrier->getReferenceLink(current);
+		if (NULL == next) {
+			for (UDATA i = 0; i < _referenceShardCount; i++) {
+				if (current == _referenceShards[i].tail) {
+					next = firstReferenceObjectFrom(i + 1);
+					break;
+				}
+			}
+		}
+		return next;
 	}
 	/**
 	 * Peek the head of the classloader list
@@ -331,6 +455,19 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop the next job for a reference helper thread: a reference from the helper's
+	 * shard or one stolen from another shard, or, while the lists are backlogged, a
+	 * finalizable object. Class loaders are left to the finalize worker.
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @param shardIndex[in] the shard owned by the calling helper
+	 *
+	 * @return the next job or NULL
+	 */
+	GC_FinalizeJob *consumeHelperJob(J9VMThread *vmThread, GC_FinalizeJob *job, UDATA shardIndex);
+
 
 	/**
 	 * Create a FinalizeListManager object
@@ -342,10 +479,16 @@ public:
 	    ,_systemFinalizableObjectCount(0)
 	    ,_defaultFinalizableObjects(NULL)
 	    ,_defaultFinalizableObjectCount(0)
-	    ,_referenceObjects(NULL)
-	    ,_referenceObjectCount(0)
+	    ,_referenceShards(NULL)
+	    ,_referenceShardCount(0)
+	    ,_nextReferenceShard(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_peakJobCount(0)
+	    ,_consumedJobCount(0)
+	    ,_backlogSignalCount(0)
+	    ,_referenceJobsInFlight(0)
+	    ,_backlogged(false)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -177,7 +177,24 @@ struct finalizeWorkerData {
 	IDATA wakeUp;
 };
 
+/* Reference helper threads share the reference shards with the worker. They are owned by the main
+ * finalizer thread, which wakes them at the start of each normal cycle in which references are pending
+ * or the finalize lists are backlogged.
+ */
+struct finalizeReferenceHelpers {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	UDATA threadCount; /* helper threads successfully forked */
+	UDATA reportedCount; /* helper threads which have finished attaching, successfully or not */
+	UDATA liveCount; /* helper threads which are attached */
+	UDATA wakeUpCount; /* bumped by the main to request another drain */
+	IDATA die;
+};
+
 static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
+static int J9THREAD_PROC FinalizeReferenceHelperThread(void *arg);
+static void FinalizeMainWakeReferenceHelpers(J9JavaVM *vm, struct finalizeReferenceHelpers **indirectHelpers);
+static void FinalizeMainShutdownReferenceHelpers(J9JavaVM *vm, struct finalizeReferenceHelpers *helpers);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeWorkerThread(void *entryArg);
@@ -188,6 +205,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	omrthread_t workerThreadHandle;
 	int noCycleWait;
 	struct finalizeWorkerData *workerData = NULL;
+	struct finalizeReferenceHelpers *referenceHelpers = NULL;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA workerMode, savedFinalizeMainFlags;
@@ -271,6 +289,13 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 
 		savedFinalizeMainFlags = vm->finalizeMainFlags;
 
+		/* Let the reference helpers drain their shards (and, when backlogged, the finalizable lists) alongside the worker */
+		if ((FINALIZE_WORKER_MODE_NORMAL == workerMode) && (extensions->finalizeReferenceThreadCount > 1)) {
+			if ((0 != finalizeListManager->getReferenceCount()) || finalizeListManager->isBacklogged()) {
+				FinalizeMainWakeReferenceHelpers(vm, &referenceHelpers);
+			}
+		}
+
 		IDATA result = FinalizeMainRunFinalization(vm, &workerThreadHandle, &workerData, finalizeCycleLimit, workerMode);
 		if(result < 0) {
 			/* give up this run and hope next time will be better */
@@ -318,6 +343,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 		forge->free(workerData);
 		omrthread_monitor_enter((omrthread_monitor_t)vm->finalizeMainMonitor);
 	}
+	if (NULL != referenceHelpers) {
+		omrthread_monitor_exit((omrthread_monitor_t)vm->finalizeMainMonitor);
+		FinalizeMainShutdownReferenceHelpers(vm, referenceHelpers);
+		omrthread_monitor_enter((omrthread_monitor_t)vm->finalizeMainMonitor);
+	}
 
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	if(NULL != vm->javaOffloadSwitchOffNoEnvWithReasonFunc) {
@@ -436,6 +466,79 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+/*
+ * Look up the Java methods used to run finalizers and enqueue references.
+ * Must be called without VM access.
+ */
+static void
+lookupFinalizeMethods(J9VMThread *env, jclass *j9VMInternalsClass, jmethodID *runFinalizeMID, jmethodID *referenceEnqueueImplMID)
+{
+	J9JavaVM *vm = env->javaVM;
+
+	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		/* Only look up finalization methods if the class library supports them */
+		jclass internalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (internalsClass) {
+			internalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(internalsClass);
+			if (internalsClass) {
+				*runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(internalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		*j9VMInternalsClass = internalsClass;
+		if (!*runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	
+		jclass referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
+		if (referenceClazz) {
+			*referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+		}
+		if (!*referenceEnqueueImplMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+}
+
+/*
+ * Mark reference processing active if references are pending, so that
+ * Reference.waitForReferenceProcessing() waits for the finalize threads.
+ */
+static void
+startReferenceProcessing(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		vm->processReferenceActive = 1;
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/*
+ * Report progress after a job has been processed, clearing the active flag once no references remain.
+ * With reference helper threads, other references may still be in the middle of being enqueued.
+ */
+static void
+reportReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager, const GC_FinalizeJob *finalizeJob)
+{
+	if (FINALIZE_JOB_TYPE_REFERENCE == (finalizeJob->type & FINALIZE_JOB_TYPE_REFERENCE)) {
+		finalizeListManager->referenceJobProcessed();
+	}
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		if (0 == finalizeListManager->getUnprocessedReferenceCount()) {
+			/* There is no more pending or in-flight reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
 /**
  * Worker thread consumes jobs from Finalize List Manager and process them
  */
@@ -445,7 +548,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	J9VMThread *env;
 	const GC_FinalizeJob *finalizeJob;
 	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jclass j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
 	omrthread_monitor_t monitor;
@@ -482,27 +585,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
-	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
-		/* Only look up finalization methods if the class library supports them */
-		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
-		if (j9VMInternalsClass) {
-			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
-			if (j9VMInternalsClass) {
-				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
-			}
-		}
-		if (!runFinalizeMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	
-		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
-		if (referenceClazz) {
-			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
-		}
-		if (!referenceEnqueueImplMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	}		
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
 	workerData->vmThread = env;
 
 	/* Notify that the worker has come on line (We should check the result from above) */
@@ -527,11 +610,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 		if(workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		{
-			if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				vm->processReferenceActive = 1;
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			startReferenceProcessing(vm, finalizeListManager);
 		}
 
 		do {
@@ -576,20 +655,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 			/* processing will release/acquire VM access */
 			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			reportReferenceProcessingProgress(vm, finalizeListManager, finalizeJob);
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
@@ -771,6 +837,198 @@ IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThr
 	return workerWaitResult;
 }
 
+/**
+ * Reference helper thread: drains its own reference shard, stealing from the others once it is empty.
+ * While the finalize lists are backlogged it also runs finalizers. Class loaders, forced finalization
+ * and forced class unloading are left to the worker.
+ */
+static int J9THREAD_PROC
+FinalizeReferenceHelperThread(void *arg)
+{
+	struct finalizeReferenceHelpers *helpers = (struct finalizeReferenceHelpers *)arg;
+	J9JavaVM *vm = helpers->vm;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	GC_FinalizeListManager *finalizeListManager = MM_GCExtensions::getExtensions(vm)->finalizeListManager;
+	J9VMThread *env = NULL;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	GC_FinalizeJob localJob;
+	UDATA shardIndex = 0;
+	UDATA wakeUpCount = 0;
+
+	if (JNI_OK != fns->attachSystemDaemonThread(vm, &env, "Reference helper thread")) {
+		omrthread_monitor_enter(helpers->monitor);
+		helpers->reportedCount += 1;
+		omrthread_monitor_notify_all(helpers->monitor);
+		omrthread_exit(helpers->monitor);		/* exit the monitor, and terminate the thread */
+		/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+		return 0;
+	}
+
+	fns->internalEnterVMFromJNI(env);
+	env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_WORKER | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+	fns->internalReleaseVMAccess(env);
+	env->gpProtected = 1;
+
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+
+	omrthread_monitor_enter(helpers->monitor);
+	helpers->reportedCount += 1;
+	helpers->liveCount += 1;
+	/* shard 0 belongs to the worker */
+	shardIndex = helpers->liveCount;
+	wakeUpCount = helpers->wakeUpCount;
+	omrthread_monitor_notify_all(helpers->monitor);
+
+	while (FINALIZE_WORKER_STAY_ALIVE == helpers->die) {
+		if (wakeUpCount == helpers->wakeUpCount) {
+			omrthread_monitor_wait(helpers->monitor);
+			continue;
+		}
+		wakeUpCount = helpers->wakeUpCount;
+		omrthread_monitor_exit(helpers->monitor);
+
+		fns->internalEnterVMFromJNI(env);
+		startReferenceProcessing(vm, finalizeListManager);
+		while (FINALIZE_WORKER_STAY_ALIVE == helpers->die) {
+			finalizeListManager->lock();
+			const GC_FinalizeJob *finalizeJob = finalizeListManager->consumeHelperJob(env, &localJob, shardIndex);
+			finalizeListManager->unlock();
+
+			if (NULL == finalizeJob) {
+				break;
+			}
+
+			/* processing will release/acquire VM access */
+			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+			reportReferenceProcessingProgress(vm, finalizeListManager, finalizeJob);
+			fns->jniResetStackReferences((JNIEnv *)env);
+		}
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(helpers->monitor);
+	}
+	omrthread_monitor_exit(helpers->monitor);
+
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+	omrthread_monitor_enter(helpers->monitor);
+	helpers->liveCount -= 1;
+	omrthread_monitor_notify_all(helpers->monitor);
+	omrthread_exit(helpers->monitor);		/* exit the monitor, and terminate the thread */
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+
+	return 0;
+}
+
+static UDATA
+FinalizeReferenceHelperThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeReferenceHelperThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeReferenceHelperThread(void *entryArg)
+{
+	struct finalizeReferenceHelpers *helpers = (struct finalizeReferenceHelpers *) entryArg;
+	PORT_ACCESS_FROM_PORT(helpers->vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeReferenceHelperThreadGlue, helpers,
+		helpers->vm->internalVMFunctions->structuredSignalHandlerVM, helpers->vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+/*
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ *
+ * Fork the reference helper threads on first use, then ask them to drain the lists.
+ * If the helpers cannot be created the worker still processes every job on its own.
+ */
+static void
+FinalizeMainWakeReferenceHelpers(J9JavaVM *vm, struct finalizeReferenceHelpers **indirectHelpers)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	struct finalizeReferenceHelpers *helpers = *indirectHelpers;
+
+	if (NULL == helpers) {
+		helpers = (struct finalizeReferenceHelpers *) forge->allocate(sizeof(struct finalizeReferenceHelpers), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+		if (NULL == helpers) {
+			return;
+		}
+		memset(helpers, 0, sizeof(struct finalizeReferenceHelpers));
+		helpers->vm = vm;
+		helpers->die = FINALIZE_WORKER_STAY_ALIVE;
+
+		if (0 != omrthread_monitor_init(&(helpers->monitor), 0)) {
+			forge->free(helpers);
+			return;
+		}
+		*indirectHelpers = helpers;
+
+		omrthread_monitor_exit(vm->finalizeMainMonitor);
+		omrthread_monitor_enter(helpers->monitor);
+		for (UDATA i = 1; i < extensions->finalizeReferenceThreadCount; i++) {
+			IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+								NULL,
+								vm->defaultOSStackSize,
+								extensions->finalizeWorkerPriority,
+								0,
+								&gpProtectedFinalizeReferenceHelperThread,
+								helpers,
+								J9THREAD_CATEGORY_APPLICATION_THREAD);
+			if (0 != result) {
+				break;
+			}
+			helpers->threadCount += 1;
+		}
+		while (helpers->reportedCount < helpers->threadCount) {
+			omrthread_monitor_wait(helpers->monitor);
+		}
+		omrthread_monitor_exit(helpers->monitor);
+		omrthread_monitor_enter(vm->finalizeMainMonitor);
+	}
+
+	omrthread_monitor_enter(helpers->monitor);
+	helpers->wakeUpCount += 1;
+	omrthread_monitor_notify_all(helpers->monitor);
+	omrthread_monitor_exit(helpers->monitor);
+}
+
+/*
+ * Preconditions:
+ * 	does not hold finalizeMainMonitor
+ *
+ * Tell the reference helpers to die, wait for them to detach, then free the shared data.
+ */
+static void
+FinalizeMainShutdownReferenceHelpers(J9JavaVM *vm, struct finalizeReferenceHelpers *helpers)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+
+	omrthread_monitor_enter(helpers->monitor);
+	helpers->die = FINALIZE_WORKER_SHOULD_DIE;
+	omrthread_monitor_notify_all(helpers->monitor);
+	while (0 != helpers->liveCount) {
+		omrthread_monitor_wait(helpers->monitor);
+	}
+	omrthread_monitor_exit(helpers->monitor);
+	omrthread_monitor_destroy(helpers->monitor);
+	forge->free(helpers);
+}
+
 static UDATA
 FinalizeWorkerThreadGlue(J9PortLibrary* portLib, void* userData)
 {
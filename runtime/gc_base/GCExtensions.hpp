@@ -139,6 +139,7 @@ public:
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 	U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision resolution in the String table */
+	U_32 _stringTableThreadCacheSize; /**< Number of entries in the per-thread interned String cache (rounded up to a power of two, 0 disables the cache) */
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	bool fvtest_forceFinalizeClassLoaders;
@@ -160,6 +161,8 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	uintptr_t finalizeMainPriority; /**< cmd line option to set finalize main thread priority */
 	uintptr_t finalizeWorkerPriority; /**< cmd line option to set finalize worker thread priority */
+	uintptr_t finalizeReferenceThreadCount; /**< number of threads enqueuing pending references (the finalize worker plus helpers), one reference shard each */
+	uintptr_t finalizeBacklogThreshold; /**< pending finalize job count above which the finalize lists are considered backlogged (0 to disable) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -225,8 +228,19 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	uintptr_t idleTrimInterval; /**< milliseconds between background heap trim ticks (0 disables background trimming) */
+	uintptr_t idleTrimColdTicks; /**< number of ticks free memory must stay unused before it is returned to the operating system */
+	uintptr_t idleTrimBatchSize; /**< maximum number of bytes decommitted or pre-faulted by one background trim tick */
 #endif
 
+	bool adaptiveHotFieldColocation; /**< true if balanced copy-forward disables depth copying of hot fields per class when copied hot children are not placed near their parent */
+	uintptr_t hotFieldColocationWindow; /**< maximum distance in bytes from a copied parent at which a depth copied hot child counts as co-located */
+	uintptr_t hotFieldColocationMinSamples; /**< minimum number of hot field copies observed for a class before its co-location rate is evaluated */
+	uintptr_t hotFieldColocationMissPercent; /**< percentage of scattered hot field copies above which depth copying is disabled for a class */
+	uintptr_t hotFieldColocationBackoff; /**< number of hot field sorts depth copying stays disabled for a class before it is measured again */
+
+	bool tarokEnableRegressionPgcTimePredictor; /**< true if eden sizing predicts PGC time with the online regression model rather than the eden size only model */
+
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 	uintptr_t minimumFreeSizeForSurvivor; /**< minimum free size can be reused by collector as survivor, for balanced GC only */
@@ -401,10 +415,13 @@ public:
 		, _classUnloadingAnonymousClassWeight(1.0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		, _stringTableListToTreeThreshold(1024)
+		, _stringTableThreadCacheSize(64)
 		, maxSoftReferenceAge(32)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeReferenceThreadCount(1)
+		, finalizeBacklogThreshold(100000)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -423,7 +440,16 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, idleTrimInterval(0)
+		, idleTrimColdTicks(5)
+		, idleTrimBatchSize(16 * 1024 * 1024)
 #endif
+		, adaptiveHotFieldColocation(true)
+		, hotFieldColocationWindow(256)
+		, hotFieldColocationMinSamples(1024)
+		, hotFieldColocationMissPercent(50)
+		, hotFieldColocationBackoff(8)
+		, tarokEnableRegressionPgcTimePredictor(false)
 		, maxRAMPercent(-1.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, minimumFreeSizeForSurvivor(DEFAULT_SURVIVOR_MINIMUM_FREESIZE)
@@ -50,6 +50,10 @@ MM_HotFieldUtil::sortAllHotFieldData(J9JavaVM *javaVM, uintptr_t gcCount)
 			if (hotFieldClassInfoTemp->isClassHotFieldListDirty) {
 				sortClassHotFieldList(javaVM, hotFieldClassInfoTemp);
 			}
+			/* only copy-forward measures co-location, so the scavenger sorts leave the state alone */
+			if (extensions->adaptiveHotFieldColocation && extensions->isVLHGC()) {
+				updateClassColocationState(extensions, hotFieldClassInfoTemp);
+			}
 			hotFieldClassInfoTemp = (struct J9ClassHotFieldsInfo*)pool_nextDo(&hotFieldClassInfoPoolState);
 		}
 		omrthread_monitor_exit(javaVM->hotFieldClassInfoPoolMutex);
@@ -141,6 +145,29 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 	hotFieldClassInfo->isClassHotFieldListDirty = false;
 }
 
+MMINLINE void
+MM_HotFieldUtil::updateClassColocationState(MM_GCExtensions *extensions, J9ClassHotFieldsInfo* hotFieldClassInfo)
+{
+	if (0 != hotFieldClassInfo->colocationBackoff) {
+		/* depth copying is disabled for the class; measure it again once the back-off period has elapsed */
+		hotFieldClassInfo->colocationBackoff -= 1;
+	} else {
+		uintptr_t hits = hotFieldClassInfo->colocationHits;
+		uintptr_t misses = hotFieldClassInfo->colocationMisses;
+		uintptr_t samples = hits + misses;
+		if (samples < extensions->hotFieldColocationMinSamples) {
+			/* keep accumulating until there are enough samples for a meaningful rate */
+			return;
+		}
+		/* hot children that land far from their parent cost copy work without saving a cache miss on traversal */
+		if ((misses * 100) > (samples * extensions->hotFieldColocationMissPercent)) {
+			hotFieldClassInfo->colocationBackoff = (uint8_t)extensions->hotFieldColocationBackoff;
+		}
+	}
+	hotFieldClassInfo->colocationHits = 0;
+	hotFieldClassInfo->colocationMisses = 0;
+}
+
 /**
  * Reset all hot fields for all classes.
  * Used when dynamicBreadthFirstScanOrdering is enabled and hotFieldResettingEnabled is true.
@@ -62,6 +62,28 @@ public:
 	 */
 	MMINLINE static void sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* hotFieldClassInfo);
 
+	/**
+	 * Evaluate the hot field co-location rate measured for a single class since the previous evaluation
+	 * and disable (or re-enable after a back-off period) depth copying of its hot fields.
+	 * Used by the balanced copy-forward when dynamicBreadthFirstScanOrdering and adaptiveHotFieldColocation are enabled;
+	 * the scavenger does not measure co-location and always depth copies hot fields.
+	 *
+	 * @param extensions[in] the GC extensions
+	 * @param hotFieldClassInfo[in] the hot field information of the class that will be evaluated
+	 */
+	MMINLINE static void updateClassColocationState(MM_GCExtensions *extensions, J9ClassHotFieldsInfo* hotFieldClassInfo);
+
+	/**
+	 * Check if the hot fields of a class should be depth copied next to their parent.
+	 *
+	 * @param hotFieldClassInfo[in] the hot field information of the class
+	 * @return true if depth copying has not been disabled for the class by adaptive co-location
+	 */
+	MMINLINE static bool isColocationEnabled(J9ClassHotFieldsInfo* hotFieldClassInfo)
+	{
+		return 0 == hotFieldClassInfo->colocationBackoff;
+	}
+
 	/**
 	 * Reset all hot fields for all classes.
 	 * Used when scavenger dynamicBreadthFirstScanOrdering is enabled and hotFieldResettingEnabled is true.
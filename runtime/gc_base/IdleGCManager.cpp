@@ -27,11 +27,17 @@
 #include "j9consts.h"
 #include "vmhook_internal.h"
 
+#include "AtomicOperations.hpp"
+
 #include "IdleGCManager.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionManager.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "VMAccess.hpp"
 
 MM_IdleGCManager *
@@ -58,18 +64,49 @@ MM_IdleGCManager::kill(MM_EnvironmentBase *env)
 void
 MM_IdleGCManager::tearDown(MM_EnvironmentBase *env)
 {
-	J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
-	if (NULL != hookInterface) {
-		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
+	if (_vmStateHookRegistered) {
+		J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+		if (NULL != hookInterface) {
+			(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
+		}
+		_vmStateHookRegistered = false;
+	}
+
+	shutdownTrimThread();
+
+	if (NULL != _trimMonitor) {
+		omrthread_monitor_destroy(_trimMonitor);
+		_trimMonitor = NULL;
+	}
+	if (NULL != _regionFreeTicks) {
+		env->getForge()->free(_regionFreeTicks);
+		_regionFreeTicks = NULL;
+	}
+	if (NULL != _regionDecommitted) {
+		env->getForge()->free(_regionDecommitted);
+		_regionDecommitted = NULL;
 	}
 }
 
 bool
 MM_IdleGCManager::initialize(MM_EnvironmentBase *env)
 {
-	J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
-	if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
-		return false;
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+
+	/* The idle GC is only enabled for the gencon policy; the background trimmer works for all policies */
+	if (ext->gcOnIdle && (gc_policy_gencon == ext->configurationOptions._gcPolicy)) {
+		J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+		if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
+			return false;
+		}
+		_vmStateHookRegistered = true;
+	}
+
+	if (0 != ext->idleTrimInterval) {
+		if (0 != omrthread_monitor_init_with_name(&_trimMonitor, 0, "MM_IdleGCManager::trimMonitor")) {
+			_trimMonitor = NULL;
+			return false;
+		}
 	}
 	return true;
 }
@@ -87,6 +124,269 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread *currentThread)
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
 }
 
+bool
+MM_IdleGCManager::startTrimThread(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+
+	if (NULL == _trimMonitor) {
+		/* background trimming is disabled */
+		return true;
+	}
+
+	/* The region table is sized for the maximum heap, so it does not change once the heap is initialized */
+	MM_HeapRegionManager *regionManager = ext->heapRegionManager;
+	_regionCount = regionManager->getTableRegionCount();
+	_regionFreeTicks = (uint32_t *)env->getForge()->allocate(sizeof(uint32_t) * _regionCount, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	_regionDecommitted = (uint8_t *)env->getForge()->allocate(sizeof(uint8_t) * _regionCount, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if ((NULL == _regionFreeTicks) || (NULL == _regionDecommitted)) {
+		return false;
+	}
+	memset(_regionFreeTicks, 0, sizeof(uint32_t) * _regionCount);
+	memset(_regionDecommitted, 0, sizeof(uint8_t) * _regionCount);
+
+	omrthread_monitor_enter(_trimMonitor);
+	_trimThreadActive = true;
+	IDATA rc = _javaVM->internalVMFunctions->createThreadWithCategory(
+			&_trimThread,
+			_javaVM->defaultOSStackSize,
+			J9THREAD_PRIORITY_MIN,
+			0,
+			trimThreadEntryPoint,
+			this,
+			J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 != rc) {
+		_trimThreadActive = false;
+		_trimThread = NULL;
+	}
+	omrthread_monitor_exit(_trimMonitor);
+
+	return (0 == rc);
+}
+
+void
+MM_IdleGCManager::shutdownTrimThread()
+{
+	if (NULL == _trimMonitor) {
+		return;
+	}
+
+	omrthread_monitor_enter(_trimMonitor);
+	_trimThreadShutdown = true;
+	omrthread_monitor_notify_all(_trimMonitor);
+	while (_trimThreadActive) {
+		omrthread_monitor_wait(_trimMonitor);
+	}
+	_trimThread = NULL;
+	omrthread_monitor_exit(_trimMonitor);
+}
+
+int J9THREAD_PROC
+MM_IdleGCManager::trimThreadEntryPoint(void *arg)
+{
+	MM_IdleGCManager *idleMgr = (MM_IdleGCManager *)arg;
+	idleMgr->trimThreadLoop();
+
+	omrthread_monitor_enter(idleMgr->_trimMonitor);
+	idleMgr->_trimThreadActive = false;
+	omrthread_monitor_notify_all(idleMgr->_trimMonitor);
+	omrthread_exit(idleMgr->_trimMonitor);		/* exit the monitor, and terminate the thread */
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+	return 0;
+}
+
+void
+MM_IdleGCManager::trimThreadLoop()
+{
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(_javaVM);
+	J9VMThread *vmThread = NULL;
+
+	omrthread_set_name(omrthread_self(), "GC heap trim");
+
+	omrthread_monitor_enter(_trimMonitor);
+	while (!_trimThreadShutdown) {
+		omrthread_monitor_wait_timed(_trimMonitor, (I_64)ext->idleTrimInterval, 0);
+		if (_trimThreadShutdown) {
+			break;
+		}
+		omrthread_monitor_exit(_trimMonitor);
+
+		/* Attach lazily: the heap is initialized before the VM can attach threads */
+		if ((NULL == vmThread) && (JNI_OK != _javaVM->internalVMFunctions->attachSystemDaemonThread(_javaVM, &vmThread, "GC heap trim"))) {
+			vmThread = NULL;
+		}
+
+		if (NULL != vmThread) {
+			MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+			_javaVM->internalVMFunctions->internalEnterVMFromJNI(vmThread);
+			trimTick(env);
+			_javaVM->internalVMFunctions->internalReleaseVMAccess(vmThread);
+		}
+
+		omrthread_monitor_enter(_trimMonitor);
+	}
+	omrthread_monitor_exit(_trimMonitor);
+
+	if (NULL != vmThread) {
+		_javaVM->internalVMFunctions->DetachCurrentThread((JavaVM *)_javaVM);
+	}
+}
+
+void
+MM_IdleGCManager::trimTick(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+	MM_HeapRegionManager *regionManager = ext->heapRegionManager;
+
+	/* Age free regions. This runs without exclusive access, so a region may change type under us; decommit and
+	 * recommit check again once exclusive. Decommitted regions handed out by the allocator are committed again by
+	 * regionAcquired(); here only regions removed from the heap by contraction are forgotten, since they stay
+	 * decommitted and cost nothing.
+	 */
+	for (uintptr_t i = 0; i < _regionCount; i++) {
+		MM_HeapRegionDescriptor *region = regionManager->physicalTableDescriptorForIndex(i);
+		if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+			if (_regionFreeTicks[i] < U_32_MAX) {
+				_regionFreeTicks[i] += 1;
+			}
+		} else {
+			_regionFreeTicks[i] = 0;
+			if ((0 != _regionDecommitted[i]) && (MM_HeapRegionDescriptor::RESERVED == region->getRegionType())) {
+				_regionDecommitted[i] = 0;
+				MM_AtomicOperations::subtract(&_decommittedBytes, region->getSize());
+			}
+		}
+	}
+
+	/* Predict the memory consumed over the next tick from a weighted average of recent ticks */
+	uintptr_t freeMemory = ext->heap->getApproximateActiveFreeMemorySize();
+	uintptr_t consumed = (freeMemory < _lastFreeMemory) ? (_lastFreeMemory - freeMemory) : 0;
+	_predictedConsumption = (_predictedConsumption / 2) + (consumed / 2);
+	_lastFreeMemory = freeMemory;
+
+	if (0 == consumed) {
+		_coldTicks += 1;
+	} else {
+		_coldTicks = 0;
+	}
+
+	uintptr_t committedFree = (freeMemory > _decommittedBytes) ? (freeMemory - _decommittedBytes) : 0;
+	if ((_predictedConsumption > committedFree) && (0 != _decommittedBytes)) {
+		/* An allocation burst is expected to reach into decommitted memory: fault it back in now. Exclusive access
+		 * for GC keeps both mutators and collector threads off the free lists; if a GC is already on its way, skip
+		 * this tick rather than wait behind it.
+		 */
+		if (env->acquireExclusiveVMAccessForGC(ext->getGlobalCollector(), true)) {
+			_recommittedBytes += recommitRegions(env, OMR_MIN(_predictedConsumption - committedFree, ext->idleTrimBatchSize));
+			env->releaseExclusiveVMAccessForGC();
+		}
+	} else if (_coldTicks >= ext->idleTrimColdTicks) {
+		uintptr_t released = 0;
+
+		if (!env->acquireExclusiveVMAccessForGC(ext->getGlobalCollector(), true)) {
+			/* A GC is about to run and will change the free memory anyway: try again next tick */
+			return;
+		}
+
+		if (gc_policy_balanced == ext->configurationOptions._gcPolicy) {
+			released = decommitColdRegions(env, ext->idleTrimBatchSize);
+		} else if (gc_policy_gencon == ext->configurationOptions._gcPolicy) {
+			/* The tenure space is a single region: give back the free pages of its free list instead */
+			if (!ext->isConcurrentScavengerInProgress()) {
+				MM_MemorySubSpace *tenureSubSpace = ext->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+				released += tenureSubSpace->releaseFreeMemoryPages(env, MEMORY_TYPE_OLD);
+			}
+		}
+		env->releaseExclusiveVMAccessForGC();
+
+		if (0 != released) {
+			_trimCount += 1;
+			_trimmedBytes += released;
+		}
+		/* Wait for another full cold period before releasing the next batch */
+		_coldTicks = 0;
+	}
+}
+
+uintptr_t
+MM_IdleGCManager::decommitColdRegions(MM_EnvironmentBase *env, uintptr_t budget)
+{
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+	MM_HeapRegionManager *regionManager = ext->heapRegionManager;
+	uintptr_t decommitted = 0;
+
+	for (uintptr_t i = 0; (i < _regionCount) && (decommitted < budget); i++) {
+		MM_HeapRegionDescriptor *region = regionManager->physicalTableDescriptorForIndex(i);
+		if ((0 == _regionDecommitted[i]) && (_regionFreeTicks[i] >= ext->idleTrimColdTicks)
+			&& (MM_HeapRegionDescriptor::FREE == region->getRegionType())
+		) {
+			void *low = region->getLowAddress();
+			void *high = region->getHighAddress();
+			uintptr_t size = region->getSize();
+			if (ext->heap->decommitMemory(low, size, low, high)) {
+				_regionDecommitted[i] = 1;
+				MM_AtomicOperations::add(&_decommittedBytes, size);
+				decommitted += size;
+			}
+		}
+	}
+
+	return decommitted;
+}
+
+uintptr_t
+MM_IdleGCManager::recommitRegions(MM_EnvironmentBase *env, uintptr_t budget)
+{
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+	MM_HeapRegionManager *regionManager = ext->heapRegionManager;
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	uintptr_t pageSize = j9vmem_supported_page_sizes()[0];
+	uintptr_t recommitted = 0;
+
+	for (uintptr_t i = 0; (i < _regionCount) && (recommitted < budget); i++) {
+		MM_HeapRegionDescriptor *region = regionManager->physicalTableDescriptorForIndex(i);
+		if ((0 != _regionDecommitted[i]) && (MM_HeapRegionDescriptor::FREE == region->getRegionType())) {
+			uint8_t *low = (uint8_t *)region->getLowAddress();
+			uintptr_t size = region->getSize();
+			if (ext->heap->commitMemory(low, size)) {
+				/* The region is free, so its contents do not matter: touch each page to fault it in */
+				for (uintptr_t offset = 0; offset < size; offset += pageSize) {
+					low[offset] = 0;
+				}
+				_regionDecommitted[i] = 0;
+				_regionFreeTicks[i] = 0;
+				MM_AtomicOperations::subtract(&_decommittedBytes, size);
+				recommitted += size;
+			}
+		}
+	}
+
+	return recommitted;
+}
+
+void
+MM_IdleGCManager::regionAcquired(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region)
+{
+	if (NULL == _regionDecommitted) {
+		/* background trimming is disabled */
+		return;
+	}
+
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
+	uintptr_t index = ext->heapRegionManager->mapDescriptorToRegionTableIndex(region);
+	if (0 != _regionDecommitted[index]) {
+		/* The trimmer only decommits under exclusive access, and the caller owns the region now, so the flag can not change under us */
+		uintptr_t size = region->getSize();
+		ext->heap->commitMemory(region->getLowAddress(), size);
+		_regionDecommitted[index] = 0;
+		_regionFreeTicks[index] = 0;
+		MM_AtomicOperations::subtract(&_decommittedBytes, size);
+		MM_AtomicOperations::add(&_refaultedBytes, size);
+		MM_AtomicOperations::addU64(&_refaultedRegionCount, 1);
+	}
+}
+
 extern "C" {
 void
 idleGCManagerVMStateHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
@@ -34,6 +34,8 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 
+class MM_HeapRegionDescriptor;
+
 extern "C" {
 /**
  * Hook "J9HOOK_VM_RUNTIME_STATE_CHANGED" callback function
@@ -43,7 +45,16 @@ void idleGCManagerVMStateHook(J9HookInterface **hook, uintptr_t eventNum, void *
 }
 
 /**
- * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook
+ * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook.
+ *
+ * When -XXgc:idleTrimInterval is set, a background thread also trims the heap continuously: every interval it
+ * ages free heap regions and, once the heap has been cold (free memory not shrinking) for idleTrimColdTicks
+ * intervals, returns free memory to the operating system under exclusive VM access, without a garbage
+ * collection. Balanced decommits up to idleTrimBatchSize bytes of regions that have been free for that long;
+ * gencon releases the free pages of the tenure free list. Heap changes are made under exclusive VM access for GC, so neither
+ * mutators nor collector threads are using the free lists. A decommitted Balanced region stays on its free list and is committed
+ * again by regionAcquired() when the allocator hands it out. If the allocation rate predicts that the committed free memory will
+ * run out in the next interval, decommitted regions are committed and pre-faulted ahead of the burst instead.
  */
 class MM_IdleGCManager : public MM_BaseNonVirtual
 {
@@ -53,10 +64,60 @@ private:
 	 */
 	J9JavaVM *_javaVM;
 
+	bool _vmStateHookRegistered; /**< true if the idle GC is driven by the VM runtime state hook */
+
+	omrthread_monitor_t _trimMonitor; /**< protects the trim thread state below */
+	omrthread_t _trimThread; /**< background trim thread, NULL if not running */
+	bool _trimThreadShutdown; /**< set to ask the trim thread to exit */
+	bool _trimThreadActive; /**< true while the trim thread is running */
+
+	uintptr_t _regionCount; /**< number of entries in the region tracking tables */
+	uint32_t *_regionFreeTicks; /**< per region: number of consecutive trim intervals the region has been free */
+	uint8_t *_regionDecommitted; /**< per region: non-zero if the region was decommitted and has not been reused since */
+	volatile uintptr_t _decommittedBytes; /**< bytes currently decommitted by the trimmer and not yet reused */
+
+	uintptr_t _lastFreeMemory; /**< approximate free heap memory at the previous tick */
+	uintptr_t _predictedConsumption; /**< weighted average of free memory consumed per tick */
+	uintptr_t _coldTicks; /**< consecutive ticks in which free memory did not shrink */
+
+	/* Counters reported in verbose GC output */
+	uintptr_t _trimCount; /**< number of ticks in which memory was decommitted */
+	uintptr_t _trimmedBytes; /**< total bytes returned to the operating system */
+	volatile uintptr_t _refaultedBytes; /**< total bytes of decommitted regions which were reused, and so faulted back in by the mutator */
+	volatile uint64_t _refaultedRegionCount; /**< number of decommitted regions which were reused */
+	uintptr_t _recommittedBytes; /**< total bytes committed and pre-faulted ahead of a predicted allocation burst */
+
 protected:
 public:
 
 private:
+	/**
+	 * Body of the background trim thread.
+	 */
+	static int J9THREAD_PROC trimThreadEntryPoint(void *arg);
+	void trimThreadLoop();
+
+	/**
+	 * Age free regions, then decommit or pre-fault heap memory according to the predicted allocation rate.
+	 * @note Caller must hold VM access; exclusive access for GC is acquired only to change the heap.
+	 */
+	void trimTick(MM_EnvironmentBase *env);
+
+	/**
+	 * Decommit up to budget bytes of free regions which have been free for at least idleTrimColdTicks ticks.
+	 * @note Caller must hold exclusive VM access for GC.
+	 * @return the number of bytes decommitted
+	 */
+	uintptr_t decommitColdRegions(MM_EnvironmentBase *env, uintptr_t budget);
+
+	/**
+	 * Commit and touch up to budget bytes of decommitted free regions so that an upcoming allocation burst
+	 * does not pay the page fault cost.
+	 * @note Caller must hold exclusive VM access for GC.
+	 * @return the number of bytes pre-faulted
+	 */
+	uintptr_t recommitRegions(MM_EnvironmentBase *env, uintptr_t budget);
+
 protected:
 	/**
 	 * Initialize the object of this class and registers for Runtime State hook
@@ -80,12 +141,57 @@ public:
 	  */
 	void manageFreeHeap(J9VMThread *currentThread);
 
+	/**
+	 * Start the background trim thread, if -XXgc:idleTrimInterval is set.
+	 * @return true on success or if trimming is disabled, false if the thread could not be started
+	 */
+	bool startTrimThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the background trim thread and wait for it to detach from the VM.
+	 */
+	void shutdownTrimThread();
+
+	/**
+	 * Called by the allocator when it takes a free region off its free list. If the trimmer decommitted
+	 * the region, commit it again before it is used and count it as refaulted.
+	 * @param region the region being handed out, owned by the caller
+	 */
+	void regionAcquired(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region);
+
+	/**
+	 * Report the background trim counters.
+	 */
+	MMINLINE uintptr_t getTrimCount() { return _trimCount; }
+	MMINLINE uintptr_t getTrimmedBytes() { return _trimmedBytes; }
+	MMINLINE uintptr_t getDecommittedBytes() { return _decommittedBytes; }
+	MMINLINE uintptr_t getRefaultedBytes() { return _refaultedBytes; }
+	MMINLINE uint64_t getRefaultedRegionCount() { return _refaultedRegionCount; }
+	MMINLINE uintptr_t getRecommittedBytes() { return _recommittedBytes; }
+
 	/**
 	 * construct the object
 	 */
 	MM_IdleGCManager(MM_EnvironmentBase *env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _vmStateHookRegistered(false)
+		, _trimMonitor(NULL)
+		, _trimThread(NULL)
+		, _trimThreadShutdown(false)
+		, _trimThreadActive(false)
+		, _regionCount(0)
+		, _regionFreeTicks(NULL)
+		, _regionDecommitted(NULL)
+		, _decommittedBytes(0)
+		, _lastFreeMemory(0)
+		, _predictedConsumption(0)
+		, _coldTicks(0)
+		, _trimCount(0)
+		, _trimmedBytes(0)
+		, _refaultedBytes(0)
+		, _refaultedRegionCount(0)
+		, _recommittedBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	}
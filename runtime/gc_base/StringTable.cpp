@@ -46,6 +46,8 @@ static UDATA stringHashFn (void *key, void *userData);
 static BOOLEAN stringHashEqualFn (void *leftKey, void *rightKey, void *userData);
 static IDATA stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struct J9AVLTreeNode *rightNode);
 static j9object_t setupCharArray(J9VMThread *vmThread, j9object_t sourceString, j9object_t newString);
+static j9object_t probeInternCaches(J9VMThread *vmThread, MM_StringTable *stringTable, UDATA hash, void *key);
+static void updateInternCaches(J9VMThread *vmThread, MM_StringTable *stringTable, UDATA hash, j9object_t string);
 
 MM_StringTable *
 MM_StringTable::newInstance(MM_EnvironmentBase *env, UDATA tableCount)
@@ -81,6 +83,12 @@ MM_StringTable::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_mutex, 0, sizeof(omrthread_monitor_t) * _tableCount);
 
+	_counters = (SubTableCounters *)j9mem_allocate_memory(sizeof(SubTableCounters) * _tableCount, OMRMEM_CATEGORY_MM);
+	if (NULL == _counters) {
+		return false;
+	}
+	memset(_counters, 0, sizeof(SubTableCounters) * _tableCount);
+
 	for (UDATA tableIndex = 0; tableIndex < _tableCount; tableIndex++) {
 		_table[tableIndex] = collisionResilientHashTableNew(OMRPORT_FROM_J9PORT(javaVM->portLibrary), J9_GET_CALLSITE(), initialSize, sizeof(UDATA), 0, OMRMEM_CATEGORY_MM, listToTreeThreshold, stringHashFn, stringComparatorFn, NULL, javaVM);
 		if (NULL == _table[tableIndex]) {
@@ -93,6 +101,15 @@ MM_StringTable::initialize(MM_EnvironmentBase *env)
 
 	memset(_cache, 0, sizeof(_cache));
 
+	/* Per-thread caches are indexed by masking the hash, so round the requested size up to a power of two */
+	U_32 threadCacheSize = MM_GCExtensions::getExtensions(env)->_stringTableThreadCacheSize;
+	if (0 != threadCacheSize) {
+		_threadCacheSize = 1;
+		while (_threadCacheSize < threadCacheSize) {
+			_threadCacheSize <<= 1;
+		}
+	}
+
 	return true;
 }
 
@@ -123,6 +140,11 @@ MM_StringTable::tearDown(MM_EnvironmentBase *env)
 		j9mem_free_memory(_mutex);
 		_mutex = NULL;
 	}
+
+	if (NULL != _counters) {
+		j9mem_free_memory(_counters);
+		_counters = NULL;
+	}
 }
 
 
@@ -144,8 +166,10 @@ MM_StringTable::hashAt(UDATA tableIndex, j9object_t string)
 {
 	j9object_t *result;
 
+	_counters[tableIndex].lookups += 1;
 	result = (j9object_t*)hashTableFind(_table[tableIndex], &string);
 	if (NULL != result) {
+		_counters[tableIndex].hits += 1;
 		return *result;
 	} else {
 		return NULL;
@@ -173,10 +197,47 @@ MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 		/* Failure to allocate a new node */
 		return NULL;
 	} else {
+		_counters[tableIndex].inserts += 1;
 		return string;
 	}
 }
 
+J9InternStringCache *
+MM_StringTable::getThreadInternCache(J9VMThread *vmThread)
+{
+	J9InternStringCache *cache = vmThread->internStringCache;
+
+	if ((NULL == cache) && (0 != _threadCacheSize)) {
+		PORT_ACCESS_FROM_VMC(vmThread);
+		UDATA allocSize = sizeof(J9InternStringCache) + (_threadCacheSize * sizeof(j9object_t));
+		/* Failure to allocate the cache is non-fatal, lookups go to the shared cache and the table */
+		cache = (J9InternStringCache *)j9mem_allocate_memory(allocSize, OMRMEM_CATEGORY_MM);
+		if (NULL != cache) {
+			memset(cache, 0, allocSize);
+			cache->size = _threadCacheSize;
+			vmThread->internStringCache = cache;
+		}
+	}
+
+	return cache;
+}
+
+void
+MM_StringTable::getStatistics(UDATA *lookups, UDATA *hits, UDATA *inserts, UDATA *entries)
+{
+	*lookups = 0;
+	*hits = 0;
+	*inserts = 0;
+	*entries = 0;
+
+	for (UDATA tableIndex = 0; tableIndex < _tableCount; tableIndex++) {
+		*lookups += _counters[tableIndex].lookups;
+		*hits += _counters[tableIndex].hits;
+		*inserts += _counters[tableIndex].inserts;
+		*entries += hashTableGetCount(_table[tableIndex]);
+	}
+}
+
 
 j9object_t
 MM_StringTable::addStringToInternTable(J9VMThread *vmThread, j9object_t string)
@@ -508,6 +569,70 @@ j9gc_stringHashFn(void *key, void *userData)
 	return stringHashFn(key, userData);
 }
 
+/**
+ * Look for a live interned string in the calling thread's cache and then in the shared
+ * cache. Neither cache is locked, so this is the fast path for strings which are already interned.
+ * @param vmThread pointer to J9VMThread struct
+ * @param stringTable the string table owning the shared cache
+ * @param hash hash value of the string being looked up
+ * @param key pointer to a String object or to a low-tagged pointer to a stringTableUTF8Query
+ * @return the interned string or NULL if neither cache holds a match
+ */
+static j9object_t
+probeInternCaches(J9VMThread *vmThread, MM_StringTable *stringTable, UDATA hash, void *key)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9InternStringCache *threadCache = stringTable->getThreadInternCache(vmThread);
+	j9object_t result = NULL;
+	j9object_t candidate = NULL;
+
+	/* Cached strings are only returned if they are live. Pass in candidate twice since we only have one string. */
+	if (NULL != threadCache) {
+		candidate = *MM_StringTable::getThreadInternCacheSlot(threadCache, hash);
+		if ((NULL != candidate) && stringHashEqualFn(&candidate, key, vm) && checkStringConstantsLive(vm, candidate, candidate)) {
+			result = candidate;
+		}
+	}
+
+	if (NULL == result) {
+		candidate = *stringTable->getStringInternCache(hash);
+		if ((NULL != candidate) && stringHashEqualFn(&candidate, key, vm) && checkStringConstantsLive(vm, candidate, candidate)) {
+			result = candidate;
+			if (NULL != threadCache) {
+				*MM_StringTable::getThreadInternCacheSlot(threadCache, hash) = result;
+			}
+		}
+	}
+
+	if (NULL != threadCache) {
+		if (NULL != result) {
+			threadCache->hits += 1;
+		} else {
+			threadCache->misses += 1;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Remember an interned string in the calling thread's cache and in the shared cache.
+ * @param vmThread pointer to J9VMThread struct
+ * @param stringTable the string table owning the shared cache
+ * @param hash hash value of the interned string
+ * @param string the interned string
+ */
+static void
+updateInternCaches(J9VMThread *vmThread, MM_StringTable *stringTable, UDATA hash, j9object_t string)
+{
+	J9InternStringCache *threadCache = vmThread->internStringCache;
+
+	if (NULL != threadCache) {
+		*MM_StringTable::getThreadInternCacheSlot(threadCache, hash) = string;
+	}
+	*stringTable->getStringInternCache(hash) = string;
+}
+
 /**
  * Assuming incoming UTF8 byte stream contains only ISO-8859-1/Latin-1 characters.
  * Decode data & store to byteArray.
@@ -631,6 +756,8 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 
 	if (internString && !translateSlashes && !isUnicode) {
 		UDATA hash = 0;
+		stringTableUTF8Query query;
+		void *key = NULL;
 
 		if (isASCII) {
 			for (UDATA i = 0; i < length; ++i) {
@@ -646,11 +773,26 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 			hash = VM_VMHelpers::computeHashForUTF8(data, length);
 		}
 
-		UDATA tableIndex = stringTable->getTableIndex(hash);
+		/* Strings are hashed to 32 bits, so discard any overflow before selecting the cache slot and sub-table */
+		hash = (U_32)hash;
 
-		stringTable->lockTable(tableIndex);
-		result = stringTable->hashAtUTF8(tableIndex, data, length, (U_32)hash);
-		stringTable->unlockTable(tableIndex);
+		query.utf8Data = data;
+		query.utf8Length = length;
+		query.hash = (U_32)hash;
+		key = (void *)((UDATA)&query | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
+		result = probeInternCaches(vmThread, stringTable, hash, &key);
+
+		if (NULL == result) {
+			UDATA tableIndex = stringTable->getTableIndex(hash);
+
+			stringTable->lockTable(tableIndex);
+			result = stringTable->hashAtUTF8(tableIndex, data, length, (U_32)hash);
+			stringTable->unlockTable(tableIndex);
+
+			if (NULL != result) {
+				updateInternCaches(vmThread, stringTable, hash, result);
+			}
+		}
 	}
 
 	if (NULL == result) {
@@ -979,23 +1121,13 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
 	MM_StringTable *stringTable = extensions->getStringTable();
 	j9object_t internedString = NULL;
-	j9object_t *candidatePtr = NULL;
-	j9object_t candidate = NULL;
 
 	UDATA hash = stringHashFn(&sourceString, vm);
 
-	candidatePtr = stringTable->getStringInternCache(hash);
-	candidate = *candidatePtr;
-
-	if ((NULL != candidate) && stringHashEqualFn(&candidate, &sourceString, vm)) {
-		/*
-		 * This can only be used if the current candidate pointer is live.
-		 * Pass in candidate twice since we only have one string.
-		 */
-		if (checkStringConstantsLive(vm, candidate, candidate)) {
-			Trc_MM_stringTableCacheHit(vmThread, candidate);
-			return candidate;
-		}
+	internedString = probeInternCaches(vmThread, stringTable, hash, &sourceString);
+	if (NULL != internedString) {
+		Trc_MM_stringTableCacheHit(vmThread, internedString);
+		return internedString;
 	}
 
 	UDATA tableIndex = stringTable->getTableIndex(hash);
@@ -1023,7 +1155,9 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 		}
 	}
 
-	*candidatePtr = internedString;
+	if (NULL != internedString) {
+		updateInternCaches(vmThread, stringTable, hash, internedString);
+	}
 	Trc_MM_stringTableCacheMiss(vmThread, internedString);
 	return internedString;
 }
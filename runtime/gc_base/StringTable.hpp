@@ -37,9 +37,20 @@ class MM_EnvironmentBase;
 
 class MM_StringTable : public MM_BaseVirtual {
 private:
+	/**
+	 * Lookup statistics for a hash sub-table, only updated while the sub-table is locked.
+	 */
+	struct SubTableCounters {
+		UDATA lookups;              /**< number of lookups which reached the sub-table */
+		UDATA hits;                 /**< number of sub-table lookups which found an interned string */
+		UDATA inserts;              /**< number of strings added to the sub-table */
+	};
+
 	UDATA _tableCount;              /**< count of hash sub-tables */
 	J9HashTable **_table;           /**< pointer to an array of hash sub-tables */
 	omrthread_monitor_t *_mutex;    /**< pointer to an array of monitors associated with each hash sub-table */
+	SubTableCounters *_counters;    /**< pointer to an array of counters associated with each hash sub-table */
+	UDATA _threadCacheSize;         /**< number of entries in each per-thread interned string cache (power of two, 0 if disabled) */
 
     ddr_constant(cacheSize, 511);
 	j9object_t _cache[cacheSize];   /**< interned string table cash */
@@ -65,6 +76,29 @@ public:
 	 */
 	j9object_t *getStringInternCache(UDATA hash) { return &_cache[hash % cacheSize]; }
 
+	/**
+	 * Fetch the calling thread's interned string cache, allocating it on first use.
+	 * @param vmThread pointer to J9VMThread struct
+	 * @return the per-thread cache, or NULL if the cache is disabled or could not be allocated
+	 */
+	J9InternStringCache *getThreadInternCache(J9VMThread *vmThread);
+	/**
+	 * @param cache a per-thread interned string cache
+	 * @param hash hash value of the string being cached
+	 * @return the address of an entry into the per-thread cache
+	 */
+	static j9object_t *getThreadInternCacheSlot(J9InternStringCache *cache, UDATA hash) { return &J9INTERNSTRINGCACHE_ENTRIES(cache)[hash & (cache->size - 1)]; }
+
+	/**
+	 * Sum the lookup statistics of all hash sub-tables. The sums are not synchronized
+	 * with concurrent lookups and are intended for reporting only.
+	 * @param[out] lookups number of lookups which had to lock a sub-table
+	 * @param[out] hits number of those lookups which found an interned string
+	 * @param[out] inserts number of strings added
+	 * @param[out] entries number of strings currently held by the table
+	 */
+	void getStatistics(UDATA *lookups, UDATA *hits, UDATA *inserts, UDATA *entries);
+
 	/**
 	 * @return hash sub-table count
 	 */
@@ -136,7 +170,9 @@ public:
 		MM_BaseVirtual(),
 		_tableCount(tableCount),
 		_table(NULL),
-		_mutex(NULL)
+		_mutex(NULL),
+		_counters(NULL),
+		_threadCacheSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -533,13 +533,18 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 	}
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	if (extensions->gcOnIdle) {
-		/* Enable idle tuning only for gencon policy */
-		if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
+	{
+		/* Enable idle tuning only for gencon policy; background trimming also supports balanced */
+		bool gencon = (gc_policy_gencon == extensions->configurationOptions._gcPolicy);
+		bool balanced = (gc_policy_balanced == extensions->configurationOptions._gcPolicy);
+		if ((extensions->gcOnIdle && gencon) || ((0 != extensions->idleTrimInterval) && (gencon || balanced))) {
 			extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
 			if (NULL == extensions->idleGCManager) {
 				goto error_no_memory;
 			}
+			if (!extensions->idleGCManager->startTrimThread(&env)) {
+				goto error_no_memory;
+			}
 		}
 	}
 #endif
@@ -803,6 +808,13 @@ gcShutdownHeapManagement(J9JavaVM *javaVM)
 	j9gc_finalizer_shutdown(javaVM);
 #endif /* J9VM_GC_FINALIZATION */
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/* stop the background heap trimmer while it can still detach from the VM */
+	if (NULL != extensions->idleGCManager) {
+		extensions->idleGCManager->shutdownTrimThread();
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	if (extensions->dispatcher) {
 		extensions->dispatcher->shutDownThreads();
 	}
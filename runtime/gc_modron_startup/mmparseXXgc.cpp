@@ -382,6 +382,14 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableDynamicCollectionSetSelection = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnableRegressionPgcTimePredictor")) {
+			extensions->tarokEnableRegressionPgcTimePredictor = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableRegressionPgcTimePredictor")) {
+			extensions->tarokEnableRegressionPgcTimePredictor = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokDynamicCollectionSetSelectionAbsoluteBudget=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokDynamicCollectionSetSelectionAbsoluteBudget, "tarokDynamicCollectionSetSelectionAbsoluteBudget=")) {
 				returnValue = JNI_EINVAL;
@@ -826,6 +834,57 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if(try_scan(&scan_start, "dbfDisableAdaptiveHotFieldColocation")) {
+			extensions->adaptiveHotFieldColocation = false;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldColocationWindow=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->hotFieldColocationWindow, "dbfHotFieldColocationWindow=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldColocationMinSamples=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->hotFieldColocationMinSamples, "dbfHotFieldColocationMinSamples=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldColocationMissPercent=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfHotFieldColocationMissPercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(value > 100) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfHotFieldColocationMissPercent=", (UDATA)0, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldColocationMissPercent = value;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldColocationBackoff=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfHotFieldColocationBackoff=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(value > 250) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfHotFieldColocationBackoff=", (UDATA)0, (UDATA)250);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldColocationBackoff = value;
+			continue;
+		}
+
 		if(try_scan(&scan_start, "dbfMaxHotFieldListLength=")) {
 			UDATA value;
 			if(!scan_udata_helper(vm, &scan_start, &value, "dbfMaxHotFieldListLength=")) {
@@ -1266,6 +1325,27 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->pageFragmentationCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+		if (try_scan(&scan_start, "idleTrimInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->idleTrimInterval, "idleTrimInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "idleTrimColdTicks=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->idleTrimColdTicks, "idleTrimColdTicks=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "idleTrimBatchSize=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->idleTrimBatchSize, "idleTrimBatchSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
@@ -1544,6 +1624,14 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "stringTableThreadCacheSize=")) {
+			if(!scan_u32_helper(vm, &scan_start, &(extensions->_stringTableThreadCacheSize), "stringTableThreadCacheSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
 		if (try_scan(&scan_start, "objectListFragmentCount=")) {
 			if(!scan_udata_helper(vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
 				returnValue = JNI_EINVAL;
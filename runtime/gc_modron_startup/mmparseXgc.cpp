@@ -1328,6 +1328,25 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeReferenceThreads=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->finalizeReferenceThreadCount, "finalizeReferenceThreads=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if (0 == extensions->finalizeReferenceThreadCount) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "finalizeReferenceThreads=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "finalizeBacklogThreshold=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->finalizeBacklogThreshold, "finalizeBacklogThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
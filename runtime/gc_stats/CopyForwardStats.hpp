@@ -67,6 +67,13 @@ public:
 	uintptr_t _monitorReferenceCleared; /**< The number of monitor references that have been cleared during marking */
 	uintptr_t _monitorReferenceCandidates; /**< The number of monitor references that have been visited in monitor table during marking */
 
+	uintptr_t _hotFieldColocated; /**< The number of depth copied hot fields that were placed within the co-location window of their parent */
+	uintptr_t _hotFieldScattered; /**< The number of depth copied hot fields that ended up outside the co-location window of their parent */
+
+	uintptr_t _numaLocalCopyBytes; /**< The number of bytes copied by GC threads into regions on their own NUMA node */
+	uintptr_t _numaRemoteCopyBytes; /**< The number of bytes copied by GC threads into regions on a different NUMA node */
+	uintptr_t _numaRemoteScanCaches; /**< The number of scan caches GC threads took from another NUMA node's scan list */
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 	uintptr_t _offHeapRegionsCleared; /**< The number of sparse heap allocated regions that have been cleared during marking */
 	uintptr_t _offHeapRegionCandidates; /**< The number of sparse heap allocated regions that have been visited during marking */
@@ -101,6 +108,13 @@ public:
 		_monitorReferenceCleared = 0;
 		_monitorReferenceCandidates = 0;
 
+		_hotFieldColocated = 0;
+		_hotFieldScattered = 0;
+
+		_numaLocalCopyBytes = 0;
+		_numaRemoteCopyBytes = 0;
+		_numaRemoteScanCaches = 0;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared = 0;
 		_offHeapRegionCandidates = 0;
@@ -129,6 +143,13 @@ public:
 		_monitorReferenceCleared += stats->_monitorReferenceCleared;
 		_monitorReferenceCandidates += stats->_monitorReferenceCandidates;
 
+		_hotFieldColocated += stats->_hotFieldColocated;
+		_hotFieldScattered += stats->_hotFieldScattered;
+
+		_numaLocalCopyBytes += stats->_numaLocalCopyBytes;
+		_numaRemoteCopyBytes += stats->_numaRemoteCopyBytes;
+		_numaRemoteScanCaches += stats->_numaRemoteScanCaches;
+
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		_offHeapRegionsCleared += stats->_offHeapRegionsCleared;
 		_offHeapRegionCandidates += stats->_offHeapRegionCandidates;
@@ -148,6 +169,11 @@ public:
 		, _stringConstantsCandidates(0)
 		, _monitorReferenceCleared(0)
 		, _monitorReferenceCandidates(0)
+		, _hotFieldColocated(0)
+		, _hotFieldScattered(0)
+		, _numaLocalCopyBytes(0)
+		, _numaRemoteCopyBytes(0)
+		, _numaRemoteScanCaches(0)
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 		, _offHeapRegionsCleared(0)
 		, _offHeapRegionCandidates(0)
@@ -79,6 +79,8 @@ void
 MM_VerboseHandlerOutputStandardJava::outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *statsBase)
 {
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStringTableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputHeapTrimInfo(_manager, env, indent);
 	outputContinuationObjectInfo(env, indent);
 }
 
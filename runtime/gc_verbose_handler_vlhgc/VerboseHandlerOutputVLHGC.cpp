@@ -35,6 +35,7 @@
 #include "SparseVirtualMemory.hpp"
 #endif /* defined(J9VM_GC_SPARSE_HEAP_ALLOCATION) */
 #include "ReferenceStats.hpp"
+#include "SchedulingDelegate.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseHandlerJava.hpp"
@@ -58,6 +59,7 @@ static void verboseHandlerCopyForwardStart(J9HookInterface** hook, UDATA eventNu
 static void verboseHandlerCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void verboseHandlerVlhgcGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerGMPMarkStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerGMPMarkEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerGlobalGCMarkStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -155,6 +157,9 @@ MM_VerboseHandlerOutputVLHGC::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, OMR_GET_CALLSITE(), this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_END, verboseHandlerConcurrentEnd, OMR_GET_CALLSITE(), this);
 
+	/* PGC time prediction */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerVlhgcGarbageCollectCompleted, OMR_GET_CALLSITE(), (void *)this);
+
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
 
@@ -214,6 +219,9 @@ MM_VerboseHandlerOutputVLHGC::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_END, verboseHandlerConcurrentEnd, NULL);
 
+	/* PGC time prediction */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerVlhgcGarbageCollectCompleted, NULL);
+
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
 
@@ -262,6 +270,26 @@ MM_VerboseHandlerOutputVLHGC::handleTaxationEntryPoint(J9HookInterface** hook, U
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::handleVlhgcGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_VlhgcGarbageCollectCompletedEvent* event = (MM_VlhgcGarbageCollectCompletedEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CycleStateVLHGC *cycleState = (MM_CycleStateVLHGC *)env->_cycleState;
+
+	/* the event is also raised when a GMP completes; only copy-forward PGCs train and report the prediction */
+	if ((MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == cycleState->_collectionType) && cycleState->_shouldRunCopyForward) {
+		MM_SchedulingDelegate *schedulingDelegate = cycleState->_schedulingDelegate;
+		MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+		enterAtomicReportingBlock();
+		writer->formatAndOutput(env, 0, "<pgc-prediction model=\"%s\" predictedms=\"%.3f\" actualms=\"%.3f\" targetms=\"%zu\" />",
+				schedulingDelegate->getPgcTimePredictorName(), schedulingDelegate->getPredictedPgcTimeMillis(), schedulingDelegate->getActualPgcTimeMillis(), _extensions->tarokTargetMaxPauseTime);
+		writer->flush(env);
+		exitAtomicReportingBlock();
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::outputUnfinalizedInfo(MM_EnvironmentBase *env, UDATA indent, UDATA unfinalizedCandidates, UDATA unfinalizedEnqueued)
 {
@@ -385,6 +413,8 @@ MM_VerboseHandlerOutputVLHGC::outputMemoryInfoInnerStanza(MM_EnvironmentBase *en
 	}
 
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputStringTableInfo(_manager, env, indent);
+	MM_VerboseHandlerJava::outputHeapTrimInfo(_manager, env, indent);
 	outputContinuationObjectInfo(env, indent);
 	UDATA rememberedSetFreePercent = (UDATA)((100 * (U_64)stats->_rememberedSetBytesFree) / ((U_64)stats->_rememberedSetBytesTotal));
 
@@ -465,6 +495,15 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	outputStringConstantInfo(env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
 	outputMonitorReferenceInfo(env, 1, copyForwardStats->_monitorReferenceCandidates, copyForwardStats->_monitorReferenceCleared);
 
+	if ((0 != copyForwardStats->_hotFieldColocated) || (0 != copyForwardStats->_hotFieldScattered)) {
+		writer->formatAndOutput(env, 1, "<hot-field-copy colocated=\"%zu\" scattered=\"%zu\" />",
+				copyForwardStats->_hotFieldColocated, copyForwardStats->_hotFieldScattered);
+	}
+	if (extensions->_numaManager.isPhysicalNUMASupported()) {
+		writer->formatAndOutput(env, 1, "<numa-copy localbytes=\"%zu\" remotebytes=\"%zu\" remotescancaches=\"%zu\" />",
+				copyForwardStats->_numaLocalCopyBytes, copyForwardStats->_numaRemoteCopyBytes, copyForwardStats->_numaRemoteScanCaches);
+	}
+
 	if(0 != copyForwardStats->_heapExpandedCount) {
 		U_64 expansionMicros = j9time_hires_delta(0, copyForwardStats->_heapExpandedTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
 		outputCollectorHeapResizeInfo(env, 1, HEAP_EXPAND, copyForwardStats->_heapExpandedBytes, copyForwardStats->_heapExpandedCount, MEMORY_TYPE_OLD, SATISFY_COLLECTOR, expansionMicros);
@@ -814,6 +853,12 @@ verboseHandlerTaxationEntryPoint(J9HookInterface** hook, UDATA eventNum, void* e
 	((MM_VerboseHandlerOutputVLHGC *)userData)->handleTaxationEntryPoint(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerVlhgcGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputVLHGC *)userData)->handleVlhgcGarbageCollectCompleted(hook, eventNum, eventData);
+}
+
 void
 verboseHandlerGCStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
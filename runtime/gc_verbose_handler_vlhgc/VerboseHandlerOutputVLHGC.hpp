@@ -145,6 +145,14 @@ public:
 	 */
 	void handleTaxationEntryPoint(J9HookInterface** hook, UDATA eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza comparing the predicted and measured time of a completed copy-forward PGC.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleVlhgcGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the copy forward start event.
 	 * @param hook Hook interface used by the JVM.
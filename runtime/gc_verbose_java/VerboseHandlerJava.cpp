@@ -33,6 +33,10 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#include "IdleGCManager.hpp"
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#include "StringTable.hpp"
 #include "VerboseBuffer.hpp"
 
 void
@@ -49,6 +53,61 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
 	}
+
+	/* Peak backlog is measured between two consecutive reports */
+	UDATA peakCount = finalizeListManager->getPeakJobCount();
+	if (0 != peakCount) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-backlog peak=\"%zu\" processed=\"%zu\" referenceShards=\"%zu\" backlogged=\"%s\" backlogSignals=\"%zu\" />",
+			peakCount, finalizeListManager->getConsumedJobCount(), finalizeListManager->getReferenceShardCount(),
+			finalizeListManager->isBacklogged() ? "true" : "false", finalizeListManager->getBacklogSignalCount());
+		finalizeListManager->resetPeakJobCount();
+	}
+}
+
+void
+MM_VerboseHandlerJava::outputHeapTrimInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_IdleGCManager *idleGCManager = MM_GCExtensions::getExtensions(env)->idleGCManager;
+
+	if ((NULL != idleGCManager) && ((0 != idleGCManager->getTrimmedBytes()) || (0 != idleGCManager->getRecommittedBytes()))) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<heap-trim trims=\"%zu\" trimmedbytes=\"%zu\" decommittedbytes=\"%zu\" refaultedbytes=\"%zu\" refaultedregions=\"%llu\" recommittedbytes=\"%zu\" />",
+			idleGCManager->getTrimCount(), idleGCManager->getTrimmedBytes(), idleGCManager->getDecommittedBytes(),
+			idleGCManager->getRefaultedBytes(), idleGCManager->getRefaultedRegionCount(), idleGCManager->getRecommittedBytes());
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+}
+
+void
+MM_VerboseHandlerJava::outputStringTableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	MM_StringTable *stringTable = MM_GCExtensions::getExtensions(env)->getStringTable();
+	J9VMThread *mainThread = ((J9JavaVM *)env->getLanguageVM())->mainThread;
+	UDATA lookups = 0;
+	UDATA hits = 0;
+	UDATA inserts = 0;
+	UDATA entries = 0;
+	UDATA cacheHits = 0;
+	UDATA cacheMisses = 0;
+
+	stringTable->getStatistics(&lookups, &hits, &inserts, &entries);
+
+	/* The caller has exclusive VM access, so the thread list is stable */
+	if (NULL != mainThread) {
+		J9VMThread *walkThread = mainThread;
+		do {
+			J9InternStringCache *cache = walkThread->internStringCache;
+			if (NULL != cache) {
+				cacheHits += cache->hits;
+				cacheMisses += cache->misses;
+			}
+		} while ((walkThread = walkThread->linkNext) != mainThread);
+	}
+
+	if ((0 != entries) || (0 != lookups) || (0 != cacheHits)) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<string-table entries=\"%zu\" lookups=\"%zu\" hits=\"%zu\" inserts=\"%zu\" cachehits=\"%zu\" cachemisses=\"%zu\" />",
+				entries, lookups, hits, inserts, cacheHits, cacheMisses);
+	}
 }
 
 bool
@@ -43,6 +43,23 @@ public:
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output interned string table summary, including the hit rates of the lock-free caches.
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputStringTableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
+	/**
+	 * Output background heap trimming summary: memory returned to the operating system,
+	 * and the cost of faulting it back in.
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputHeapTrimInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
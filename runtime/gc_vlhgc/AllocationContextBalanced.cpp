@@ -37,6 +37,9 @@
 #include "EnvironmentVLHGC.hpp"
 #include "HeapRegionDescriptorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#include "IdleGCManager.hpp"
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #include "MemoryPool.hpp"
 #include "MemorySubSpaceTarok.hpp"
 #include "ObjectAllocationInterface.hpp"
@@ -778,6 +781,13 @@ MM_AllocationContextBalanced::acquireMPRegionFromContext(MM_EnvironmentBase *env
 	_freeListLock.release();
 	if (NULL != region) {
 		if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+			/* the idle trimmer may have decommitted this region while it sat on the free list */
+			MM_IdleGCManager *idleGCManager = MM_GCExtensions::getExtensions(env)->idleGCManager;
+			if (NULL != idleGCManager) {
+				idleGCManager->regionAcquired(env, region);
+			}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 			if (region->_allocateData.taskAsMemoryPool(env, requestingContext)) {
 				/* this is a new region. Initialize it for the given pool */
 				region->resetAge(env, (U_64)_subspace->getBytesRemainingBeforeTaxation());
@@ -849,6 +859,13 @@ MM_AllocationContextBalanced::acquireFreeRegionFromContext(MM_EnvironmentBase *e
 	_freeListLock.release();
 	if (NULL != region) {
 		Assert_MM_true(getNumaNode() == region->getNumaNode());
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		/* the idle trimmer may have decommitted this region while it sat on the free list */
+		MM_IdleGCManager *idleGCManager = MM_GCExtensions::getExtensions(env)->idleGCManager;
+		if (NULL != idleGCManager) {
+			idleGCManager->regionAcquired(env, region);
+		}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 	}
 	return region;
 	
@@ -700,6 +700,7 @@ MM_CopyForwardScheme::reinitCache(MM_EnvironmentVLHGC *env, MM_CopyScanCacheVLHG
 	Assert_MM_true(0.0 == cache->_allocationAgeSizeProduct);
 	
 	MM_HeapRegionDescriptorVLHGC * region = (MM_HeapRegionDescriptorVLHGC *)_regionManager->tableDescriptorForAddress(cache->cacheBase);
+	cache->_numaNode = region->getNumaNode();
 	Trc_MM_CopyForwardScheme_reinitCache(env->getLanguageVMThread(), _regionManager->mapDescriptorToRegionTableIndex(region), cache,
 			region->getAllocationAgeSizeProduct() / (1024 * 1024) / (1024 * 1024), (double)((uintptr_t)cache->cacheAlloc - (uintptr_t)region->getLowAddress()) / (1024 * 1024));
 
@@ -716,6 +717,7 @@ MM_CopyForwardScheme::reinitArraySplitCache(MM_EnvironmentVLHGC *env, MM_CopySca
 	cache->_hasPartiallyScannedObject = false;
 	cache->cacheTop = array;
 	cache->_arraySplitIndex = nextIndex;
+	cache->_numaNode = _regionManager->tableDescriptorForAddress(array)->getNumaNode();
 
 	/* store back the appropriate flags */
 	cache->flags = (OMR_COPYSCAN_CACHE_TYPE_SPLIT_ARRAY | OMR_COPYSCAN_CACHE_TYPE_CLEARED) | (cache->flags & OMR_COPYSCAN_CACHE_MASK_PERSISTENT);
@@ -1481,6 +1483,13 @@ MM_CopyForwardScheme::workerSetupForCopyForward(MM_EnvironmentVLHGC *env)
 		env->_copyForwardCompactGroups[compactGroup].initialize(env);
 	}
 
+	/* if we aren't using NUMA, we don't want to check the thread affinity since we will have only one list of scan caches */
+	env->_copyForwardNumaNode = 0;
+	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
+		env->_copyForwardNumaNode = env->getNumaAffinity();
+		Assert_MM_true(env->_copyForwardNumaNode <= _extensions->_numaManager.getMaximumNodeNumber());
+	}
+
 	Assert_MM_true(NULL == env->_lastOverflowedRsclWithReleasedBuffers);
 }
 
@@ -1770,8 +1779,7 @@ MM_CopyForwardScheme::addCacheEntryToFreeCacheList(MM_EnvironmentVLHGC *env, MM_
 void
 MM_CopyForwardScheme::addCacheEntryToScanCacheListAndNotify(MM_EnvironmentVLHGC *env, MM_CopyScanCacheVLHGC *newCacheEntry)
 {
-	uintptr_t numaNode = _regionManager->tableDescriptorForAddress(newCacheEntry->scanCurrent)->getNumaNode();
-	_cacheScanLists[numaNode].pushCache(env, newCacheEntry);
+	_cacheScanLists[newCacheEntry->_numaNode].pushCache(env, newCacheEntry);
 	if (0 != *_workQueueWaitCountPtr) {
 		/* Added an entry to the scan list - notify any other threads that a new entry has appeared on the list */
 		omrthread_monitor_enter(*_workQueueMonitorPtr);
@@ -2088,6 +2096,14 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 				copyCache->_objectSize += objectReserveSizeInBytes;
 				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
 				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
+				if (0 != env->_copyForwardNumaNode) {
+					/* regions without node affinity (node 0) are not attributed to either side */
+					if (copyCache->_numaNode == env->_copyForwardNumaNode) {
+						env->_copyForwardStats._numaLocalCopyBytes += objectCopySizeInBytes;
+					} else if (0 != copyCache->_numaNode) {
+						env->_copyForwardStats._numaRemoteCopyBytes += objectCopySizeInBytes;
+					}
+				}
 
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
@@ -2139,33 +2155,69 @@ MM_CopyForwardScheme::depthCopyHotFields(MM_EnvironmentVLHGC *env, J9Class *claz
 	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax && NULL != hotFieldsInfo) {
 		uint8_t hotFieldOffset = hotFieldsInfo->hotFieldOffset1;
 		if (U_8_MAX != hotFieldOffset) {
-			copyHotField(env, destinationObjectPtr, hotFieldOffset, reservingContext);
-			uint8_t hotFieldOffset2 = hotFieldsInfo->hotFieldOffset2;
-			if (U_8_MAX !=hotFieldOffset2) {
-				copyHotField(env, destinationObjectPtr, hotFieldOffset2, reservingContext);
-				uint8_t hotFieldOffset3 = hotFieldsInfo->hotFieldOffset3;
-				if (U_8_MAX != hotFieldOffset3) {
-					copyHotField(env, destinationObjectPtr, hotFieldOffset3, reservingContext);
+			/* classes whose hot children keep landing away from them are left to the breadth first scan */
+			if (MM_HotFieldUtil::isColocationEnabled(hotFieldsInfo)) {
+				copyHotField(env, destinationObjectPtr, hotFieldOffset, reservingContext, hotFieldsInfo);
+				uint8_t hotFieldOffset2 = hotFieldsInfo->hotFieldOffset2;
+				if (U_8_MAX !=hotFieldOffset2) {
+					copyHotField(env, destinationObjectPtr, hotFieldOffset2, reservingContext, hotFieldsInfo);
+					uint8_t hotFieldOffset3 = hotFieldsInfo->hotFieldOffset3;
+					if (U_8_MAX != hotFieldOffset3) {
+						copyHotField(env, destinationObjectPtr, hotFieldOffset3, reservingContext, hotFieldsInfo);
+					}
 				}
 			}
 		} else if ((_extensions->alwaysDepthCopyFirstOffset) && (false == _extensions->objectModel.isIndexable(destinationObjectPtr))) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET, reservingContext);
+			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET, reservingContext, NULL);
 		}
 	}	
 }
 
 MMINLINE void
-MM_CopyForwardScheme::copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinationObjectPtr, uint8_t offset, MM_AllocationContextTarok *reservingContext) {
+MM_CopyForwardScheme::copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinationObjectPtr, uint8_t offset, MM_AllocationContextTarok *reservingContext, J9ClassHotFieldsInfo *hotFieldsInfo) {
 	bool const compressed = _extensions->compressObjectReferences();
 	GC_SlotObject hotFieldObject(_javaVM->omrVM, GC_SlotObject::addToSlotAddress((fomrobject_t*)((uintptr_t)destinationObjectPtr), offset, compressed));
 	omrobjectptr_t objectPtr = hotFieldObject.readReferenceFromSlot();							
 	if (isObjectInEvacuateMemory(objectPtr)) {
 		/* Hot field needs to be copy and forwarded.  Check if the work has already been done */
 		MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
+		J9Object *hotFieldDestinationPtr = NULL;
 		if (!forwardHeaderHotField.isForwardedPointer()) {
 			env->_hotFieldCopyDepthCount += 1;
-			copy(env, reservingContext, &forwardHeaderHotField);
+			hotFieldDestinationPtr = copy(env, reservingContext, &forwardHeaderHotField);
 			env->_hotFieldCopyDepthCount -= 1;
+		} else {
+			hotFieldDestinationPtr = forwardHeaderHotField.getForwardedObject();
+		}
+		if ((NULL != hotFieldsInfo) && _extensions->adaptiveHotFieldColocation) {
+			recordHotFieldColocation(env, hotFieldsInfo, destinationObjectPtr, hotFieldDestinationPtr);
+		}
+	}
+}
+
+MMINLINE void
+MM_CopyForwardScheme::recordHotFieldColocation(MM_EnvironmentVLHGC *env, J9ClassHotFieldsInfo *hotFieldsInfo, J9Object *parentPtr, J9Object *childPtr)
+{
+	/* A hot child within the co-location window of its parent is likely to share its cache lines (or at least
+	 * its page) when the structure is traversed, so the distance serves as a cheap cache miss proxy. Children
+	 * that were already forwarded elsewhere, or that could not be copied, count as misses.
+	 */
+	bool colocated = (childPtr > parentPtr) && (((uintptr_t)childPtr - (uintptr_t)parentPtr) <= _extensions->hotFieldColocationWindow);
+	if (colocated) {
+		env->_copyForwardStats._hotFieldColocated += 1;
+	} else {
+		env->_copyForwardStats._hotFieldScattered += 1;
+	}
+
+	/* The per class counters are shared by all GC threads and updated without synchronization; they only feed
+	 * a heuristic, so lost updates are acceptable. Sampling stops once enough copies were seen for the class
+	 * to keep the shared cache line from being written on every copy.
+	 */
+	if ((hotFieldsInfo->colocationHits + hotFieldsInfo->colocationMisses) < _extensions->hotFieldColocationMinSamples) {
+		if (colocated) {
+			hotFieldsInfo->colocationHits += 1;
+		} else {
+			hotFieldsInfo->colocationMisses += 1;
 		}
 	}
 }
@@ -2764,15 +2816,22 @@ MM_CopyScanCacheVLHGC *
 MM_CopyForwardScheme::getSurvivorCacheForScan(MM_EnvironmentVLHGC *env)
 {
 	MM_CopyScanCacheVLHGC *cache = NULL;
+	MM_CopyScanCacheVLHGC *remoteCache = NULL;
 
+	/* prefer the copy caches backed by memory on this thread's node; fall back to the first one on another node */
 	for (uintptr_t index = 0; index < _compactGroupMaxCount; index++) {
 		cache = env->_copyForwardCompactGroups[index]._copyCache;
 		if ((NULL != cache) && cache->isScanWorkAvailable()) {
-			return cache;
+			if ((0 == env->_copyForwardNumaNode) || (cache->_numaNode == env->_copyForwardNumaNode)) {
+				return cache;
+			}
+			if (NULL == remoteCache) {
+				remoteCache = cache;
+			}
 		}
 	}
 
-	return NULL;
+	return remoteCache;
 }
 
 MM_CopyForwardScheme::ScanReason
@@ -2888,6 +2947,9 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, uintptr_t
 		while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
 			if (COMMON_CONTEXT_INDEX != nextNode) {
 				ret = getNextWorkUnitOnNode(env, nextNode);
+				if ((SCAN_REASON_NONE != ret) && (COMMON_CONTEXT_INDEX != preferredNumaNode)) {
+					env->_copyForwardStats._numaRemoteScanCaches += 1;
+				}
 			}
 			nextNode = (nextNode + 1) % nodeLists;
 		}
@@ -3421,13 +3483,7 @@ MM_CopyForwardScheme::completeScanWorkPacket(MM_EnvironmentVLHGC *env)
 void
 MM_CopyForwardScheme::completeScan(MM_EnvironmentVLHGC *env)
 {
-	uintptr_t nodeOfThread = 0;
-
-	/* if we aren't using NUMA, we don't want to check the thread affinity since we will have only one list of scan caches */
-	if (_extensions->_numaManager.isPhysicalNUMASupported()) {
-		nodeOfThread = env->getNumaAffinity();
-		Assert_MM_true(nodeOfThread <= _extensions->_numaManager.getMaximumNodeNumber());
-	}
+	uintptr_t nodeOfThread = env->_copyForwardNumaNode;
 	ScanReason scanReason = SCAN_REASON_NONE;
 	while (SCAN_REASON_NONE != (scanReason = getNextWorkUnit(env, nodeOfThread))) {
 		if (SCAN_REASON_COPYSCANCACHE == scanReason) {
@@ -859,8 +859,16 @@ private:
 	 * Valid if scavenger dynamicBreadthScanOrdering is enabled.
 	 * @param destinationObjectPtr - the object who's hot field will be copied
 	 * @param offset  - the object field offset of the hot field to be copied
+	 * @param hotFieldsInfo - hot field information of the object's class, used to record whether the hot field was co-located (may be NULL)
 	 */
-	MMINLINE void copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinationObjectPtr, uint8_t offset, MM_AllocationContextTarok *reservingContext);
+	MMINLINE void copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinationObjectPtr, uint8_t offset, MM_AllocationContextTarok *reservingContext, J9ClassHotFieldsInfo *hotFieldsInfo);
+
+	/* Record whether a depth copied hot field ended up next to its parent.
+	 * @param hotFieldsInfo - hot field information of the parent's class
+	 * @param parentPtr - the new location of the parent object
+	 * @param childPtr - the new location of the hot field object
+	 */
+	MMINLINE void recordHotFieldColocation(MM_EnvironmentVLHGC *env, J9ClassHotFieldsInfo *hotFieldsInfo, J9Object *parentPtr, J9Object *childPtr);
 	/**
 	 * Push any remaining cached mark map data out before the copy scan cache is released.
 	 * @param env GC thread.
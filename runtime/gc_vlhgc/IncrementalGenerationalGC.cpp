@@ -297,6 +297,7 @@ MM_IncrementalGenerationalGC::tearDown(MM_EnvironmentVLHGC *env)
 
 	_collectionSetDelegate.tearDown(env);
 	_projectedSurvivalCollectionSetDelegate.tearDown(env);
+	_schedulingDelegate.tearDown(env);
 
 	_mainGCThread.tearDown(env);
 	
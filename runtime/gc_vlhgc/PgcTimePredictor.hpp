@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(PGCTIMEPREDICTOR_HPP_)
+#define PGCTIMEPREDICTOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentVLHGC;
+
+/**
+ * The observable shape of a partial GC. The scheduling delegate fills this in from the statistics of a
+ * completed PGC to train a predictor, and from projected values to ask what a PGC of a given shape would cost.
+ * @ingroup GC_Modron_Tarok
+ */
+struct MM_PgcTimePredictorInputs {
+	double edenBytes; /**< Bytes of eden in the collection set */
+	double survivorBytes; /**< Bytes copied out of (or expected to survive in) the collection set */
+	double cardCleanBytes; /**< Bytes scanned through remembered set cards into the collection set */
+	double nonEdenRegionCount; /**< Number of non-eden regions in the collection set */
+
+	MM_PgcTimePredictorInputs()
+		: edenBytes(0.0)
+		, survivorBytes(0.0)
+		, cardCleanBytes(0.0)
+		, nonEdenRegionCount(0.0)
+	{}
+};
+
+/**
+ * Interface for models that predict partial GC pause times for the scheduling delegate's eden sizing.
+ * When no predictor is installed (or a predictor declines to predict) the scheduling delegate falls back to
+ * its built-in model, which scales the historic PGC time with eden size.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_PgcTimePredictor : public MM_BaseVirtual
+{
+	/* Data Members */
+private:
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+	virtual bool initialize(MM_EnvironmentVLHGC *env) = 0;
+	virtual void tearDown(MM_EnvironmentVLHGC *env) = 0;
+
+public:
+	/**
+	 * Train the model with a completed partial GC.
+	 * @param env[in] The main GC thread
+	 * @param inputs[in] The shape of the completed PGC
+	 * @param pgcTimeMillis[in] The measured duration of the PGC
+	 */
+	virtual void recordPartialGC(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double pgcTimeMillis) = 0;
+
+	/**
+	 * Predict the duration of a partial GC.
+	 * @param env[in] The main GC thread
+	 * @param inputs[in] The projected shape of the PGC
+	 * @param pgcTimeMillis[out] The predicted duration of the PGC
+	 * @return true if the model produced a prediction, false if it has not been trained enough to be trusted
+	 */
+	virtual bool predictPgcTime(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double *pgcTimeMillis) = 0;
+
+	/**
+	 * @return a short name for the model, reported in verbose GC
+	 */
+	virtual const char *getName() = 0;
+
+	virtual void kill(MM_EnvironmentVLHGC *env) = 0;
+
+	MM_PgcTimePredictor()
+		: MM_BaseVirtual()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PGCTIMEPREDICTOR_HPP_ */
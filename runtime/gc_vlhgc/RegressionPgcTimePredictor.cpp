@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "RegressionPgcTimePredictor.hpp"
+
+#include "EnvironmentVLHGC.hpp"
+
+/* Weight given to past observations on each update; 0.98 forgets half of the history in roughly 35 PGCs */
+const double regressionForgettingFactor = 0.98;
+/* Initial diagonal of the covariance matrix; large values mean the first observations move the coefficients quickly */
+const double regressionInitialCovariance = 1000.0;
+/* Covariance diagonal above which the matrix is reset, to avoid wind-up when some inputs stop varying */
+const double regressionMaximumCovariance = 1000000.0;
+/* Number of trained PGCs before predictions are trusted (twice the number of features) */
+const uintptr_t regressionMinimumSampleCount = 10;
+/* Byte inputs are scaled to megabytes to keep the features within a few orders of magnitude of each other */
+const double regressionBytesPerUnit = 1024.0 * 1024.0;
+
+MM_RegressionPgcTimePredictor *
+MM_RegressionPgcTimePredictor::newInstance(MM_EnvironmentVLHGC *env)
+{
+	MM_RegressionPgcTimePredictor *predictor = (MM_RegressionPgcTimePredictor *)env->getForge()->allocate(sizeof(MM_RegressionPgcTimePredictor), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != predictor) {
+		new(predictor) MM_RegressionPgcTimePredictor();
+		if (!predictor->initialize(env)) {
+			predictor->kill(env);
+			predictor = NULL;
+		}
+	}
+	return predictor;
+}
+
+void
+MM_RegressionPgcTimePredictor::kill(MM_EnvironmentVLHGC *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RegressionPgcTimePredictor::initialize(MM_EnvironmentVLHGC *env)
+{
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		_coefficients[i] = 0.0;
+	}
+	resetCovariance();
+	return true;
+}
+
+void
+MM_RegressionPgcTimePredictor::tearDown(MM_EnvironmentVLHGC *env)
+{
+}
+
+void
+MM_RegressionPgcTimePredictor::resetCovariance()
+{
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		for (uintptr_t j = 0; j < FEATURE_COUNT; j++) {
+			_covariance[i][j] = (i == j) ? regressionInitialCovariance : 0.0;
+		}
+	}
+}
+
+void
+MM_RegressionPgcTimePredictor::getFeatures(MM_PgcTimePredictorInputs *inputs, double *features)
+{
+	features[FEATURE_BIAS] = 1.0;
+	features[FEATURE_EDEN] = inputs->edenBytes / regressionBytesPerUnit;
+	features[FEATURE_SURVIVOR] = inputs->survivorBytes / regressionBytesPerUnit;
+	features[FEATURE_CARD_CLEAN] = inputs->cardCleanBytes / regressionBytesPerUnit;
+	features[FEATURE_NON_EDEN_REGIONS] = inputs->nonEdenRegionCount;
+}
+
+double
+MM_RegressionPgcTimePredictor::evaluate(double *features)
+{
+	double result = 0.0;
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		result += _coefficients[i] * features[i];
+	}
+	return result;
+}
+
+void
+MM_RegressionPgcTimePredictor::recordPartialGC(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double pgcTimeMillis)
+{
+	double features[FEATURE_COUNT];
+	double gain[FEATURE_COUNT];
+	getFeatures(inputs, features);
+
+	/* gain = P * x / (lambda + x' * P * x) */
+	double denominator = regressionForgettingFactor;
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		gain[i] = 0.0;
+		for (uintptr_t j = 0; j < FEATURE_COUNT; j++) {
+			gain[i] += _covariance[i][j] * features[j];
+		}
+		denominator += features[i] * gain[i];
+	}
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		gain[i] /= denominator;
+	}
+
+	/* move the coefficients along the gain by the prediction error */
+	double error = pgcTimeMillis - evaluate(features);
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		_coefficients[i] += gain[i] * error;
+	}
+
+	/* P = (P - gain * x' * P) / lambda; P is symmetric so x' * P is the unscaled gain */
+	bool windUp = false;
+	for (uintptr_t i = 0; i < FEATURE_COUNT; i++) {
+		for (uintptr_t j = 0; j < FEATURE_COUNT; j++) {
+			_covariance[i][j] = (_covariance[i][j] - (gain[i] * gain[j] * denominator)) / regressionForgettingFactor;
+		}
+		windUp = windUp || (_covariance[i][i] > regressionMaximumCovariance);
+	}
+	if (windUp) {
+		resetCovariance();
+	}
+
+	_sampleCount += 1;
+}
+
+bool
+MM_RegressionPgcTimePredictor::predictPgcTime(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double *pgcTimeMillis)
+{
+	bool result = false;
+	if (_sampleCount >= regressionMinimumSampleCount) {
+		double features[FEATURE_COUNT];
+		getFeatures(inputs, features);
+		double prediction = evaluate(features);
+		/* a non-positive time means the linear model is extrapolating beyond what it has seen; let the caller fall back */
+		if (prediction > 0.0) {
+			*pgcTimeMillis = prediction;
+			result = true;
+		}
+	}
+	return result;
+}
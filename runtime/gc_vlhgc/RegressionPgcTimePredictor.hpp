@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(REGRESSIONPGCTIMEPREDICTOR_HPP_)
+#define REGRESSIONPGCTIMEPREDICTOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "PgcTimePredictor.hpp"
+
+/**
+ * Predicts PGC time with an online multivariate linear regression over the PGC inputs (eden bytes, survivor
+ * bytes, remembered set card bytes and non-eden region count), fitted by recursive least squares.
+ * Older observations are exponentially forgotten so that the model follows live set shifts over the run.
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_RegressionPgcTimePredictor : public MM_PgcTimePredictor
+{
+	/* Data Members */
+private:
+	enum {
+		FEATURE_BIAS = 0,
+		FEATURE_EDEN,
+		FEATURE_SURVIVOR,
+		FEATURE_CARD_CLEAN,
+		FEATURE_NON_EDEN_REGIONS,
+		FEATURE_COUNT
+	};
+
+	double _coefficients[FEATURE_COUNT]; /**< Regression coefficients, in milliseconds per feature unit */
+	double _covariance[FEATURE_COUNT][FEATURE_COUNT]; /**< Inverse correlation matrix maintained by recursive least squares */
+	uintptr_t _sampleCount; /**< Number of PGCs the model has been trained with */
+
+protected:
+public:
+
+	/* Member Functions */
+private:
+	/**
+	 * Convert PGC inputs to the scaled feature vector used by the model.
+	 */
+	void getFeatures(MM_PgcTimePredictorInputs *inputs, double *features);
+
+	/**
+	 * Evaluate the current model for the given feature vector.
+	 */
+	double evaluate(double *features);
+
+	/**
+	 * Reset the covariance to its initial (uninformed) state, keeping the coefficients.
+	 */
+	void resetCovariance();
+
+protected:
+	virtual bool initialize(MM_EnvironmentVLHGC *env);
+	virtual void tearDown(MM_EnvironmentVLHGC *env);
+
+public:
+	static MM_RegressionPgcTimePredictor *newInstance(MM_EnvironmentVLHGC *env);
+	virtual void kill(MM_EnvironmentVLHGC *env);
+
+	virtual void recordPartialGC(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double pgcTimeMillis);
+	virtual bool predictPgcTime(MM_EnvironmentVLHGC *env, MM_PgcTimePredictorInputs *inputs, double *pgcTimeMillis);
+	virtual const char *getName() { return "regression"; }
+
+	MM_RegressionPgcTimePredictor()
+		: MM_PgcTimePredictor()
+		, _sampleCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* REGRESSIONPGCTIMEPREDICTOR_HPP_ */
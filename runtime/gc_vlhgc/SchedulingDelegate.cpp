@@ -46,6 +46,7 @@
 #include "HeapRegionManager.hpp"
 #include "IncrementalGenerationalGC.hpp"
 #include "MemoryPoolAddressOrderedList.hpp"
+#include "RegressionPgcTimePredictor.hpp"
 #if defined(J9VM_GC_SPARSE_HEAP_ALLOCATION)
 #include "SparseVirtualMemory.hpp"
 #include "SparseAddressOrderedFixedSizeDataPool.hpp"
@@ -126,6 +127,10 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _concurrentMarkGCThreadsTotalWorkTime(0)
 	, _dynamicGlobalMarkIncrementTimeMillis(50)
 	, _pgcTimeIncreasePerEdenFactor(1.0001)
+	, _pgcTimePredictor(NULL)
+	, _lastPgcInputs()
+	, _predictedPgcTimeMillis(0.0)
+	, _actualPgcTimeMillis(0.0)
 	, _edenSizeFactor(0)
 	, _pgcCountSinceGMPEnd(0)
 	, _averagePgcInterval(0)
@@ -147,9 +152,25 @@ MM_SchedulingDelegate::initialize(MM_EnvironmentVLHGC *env)
 	_maxEdenRegionCount = _extensions->tarokIdealEdenMaximumBytes / _regionManager->getRegionSize();
 	_partialGcOverhead = _extensions->dnssExpectedRatioMaximum._valueSpecified;
 
+	if (_extensions->tarokEnableRegressionPgcTimePredictor) {
+		_pgcTimePredictor = MM_RegressionPgcTimePredictor::newInstance(env);
+		if (NULL == _pgcTimePredictor) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
+void
+MM_SchedulingDelegate::tearDown(MM_EnvironmentVLHGC *env)
+{
+	if (NULL != _pgcTimePredictor) {
+		_pgcTimePredictor->kill(env);
+		_pgcTimePredictor = NULL;
+	}
+}
+
 uintptr_t
 MM_SchedulingDelegate::getInitialTaxationThreshold(MM_EnvironmentVLHGC *env)
 {
@@ -415,6 +436,11 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 	uint64_t partialGcEndTime = j9time_hires_clock();
 	uint64_t pgcTime = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MILLISECONDS);
 
+	if (env->_cycleState->_shouldRunCopyForward) {
+		/* train the predictor before eden is resized below, so that the resizing sees this PGC */
+		updatePgcTimePredictor(env, copyForwardStats, pgcTime);
+	}
+
 	_pgcCountSinceGMPEnd += 1;
 
 	/* Check eden size based off of new PGC stats */
@@ -817,6 +843,23 @@ MM_SchedulingDelegate::predictPgcTime(MM_EnvironmentVLHGC *env, uintptr_t curren
 	double pgcTimeDeltaForEdenChange = log(edenChangeRatio) / log(_pgcTimeIncreasePerEdenFactor);
 	double predictedPgcTime = (double)_historicalPartialGCTime + pgcTimeDeltaForEdenChange;
 
+	if ((NULL != _pgcTimePredictor) && (0.0 < _lastPgcInputs.edenBytes)) {
+		/*
+		 * Project the shape of the most recent PGC onto the new eden size: eden survivors scale with eden at the observed
+		 * survival rate, while the non-eden part of the collection set (copied bytes, card cleaning and regions) is kept as is.
+		 */
+		MM_PgcTimePredictorInputs inputs = _lastPgcInputs;
+		double edenSurvivorBytes = _edenSurvivalRateCopyForward * _lastPgcInputs.edenBytes;
+		double nonEdenSurvivorBytes = OMR_MAX(_lastPgcInputs.survivorBytes - edenSurvivorBytes, 0.0);
+		inputs.edenBytes = (double)currentEdenSize + (double)edenSizeChange;
+		inputs.survivorBytes = nonEdenSurvivorBytes + (_edenSurvivalRateCopyForward * inputs.edenBytes);
+
+		double modelPgcTime = 0.0;
+		if (_pgcTimePredictor->predictPgcTime(env, &inputs, &modelPgcTime)) {
+			predictedPgcTime = modelPgcTime;
+		}
+	}
+
 	/* If the prediction returned a value less than minimumPgcTime, then there may have been a small rounding mistake */
 	predictedPgcTime = OMR_MAX(predictedPgcTime, (double)minimumPgcTime);
 
@@ -824,6 +867,30 @@ MM_SchedulingDelegate::predictPgcTime(MM_EnvironmentVLHGC *env, uintptr_t curren
 	return predictedPgcTime * 1000.0;
 }
 
+void
+MM_SchedulingDelegate::updatePgcTimePredictor(MM_EnvironmentVLHGC *env, MM_CopyForwardStats *copyForwardStats, uint64_t pgcTime)
+{
+	if (U_32_MAX < pgcTime) {
+		/* Time likely traveled backwards due to a clock adjustment - just ignore this round */
+	} else {
+		MM_PgcTimePredictorInputs inputs;
+		inputs.edenBytes = (double)(copyForwardStats->_edenEvacuateRegionCount * _regionManager->getRegionSize());
+		inputs.survivorBytes = (double)copyForwardStats->_copyBytesTotal;
+		inputs.cardCleanBytes = (double)copyForwardStats->_bytesCardClean;
+		inputs.nonEdenRegionCount = (double)copyForwardStats->_nonEdenEvacuateRegionCount;
+
+		/* predict with the actual shape of this PGC, but before any model has seen its time (for the eden size only model, the unchanged eden term is 0) */
+		double predictedPgcTime = OMR_MAX((double)_historicalPartialGCTime, (double)minimumPgcTime);
+		if (NULL != _pgcTimePredictor) {
+			_pgcTimePredictor->predictPgcTime(env, &inputs, &predictedPgcTime);
+			_pgcTimePredictor->recordPartialGC(env, &inputs, (double)pgcTime);
+		}
+		_predictedPgcTimeMillis = predictedPgcTime;
+		_actualPgcTimeMillis = (double)pgcTime;
+		_lastPgcInputs = inputs;
+	}
+}
+
 
 uintptr_t
 MM_SchedulingDelegate::estimateGlobalMarkIncrements(MM_EnvironmentVLHGC *env, double liveSetAdjustedForScannableBytesRatio) const
@@ -33,7 +33,9 @@
 
 #include "EnvironmentVLHGC.hpp"
 #include "GCExtensions.hpp"
+#include "PgcTimePredictor.hpp"
 
+class MM_CopyForwardStats;
 class MM_HeapRegionDescriptorVLHGC;
 
 class MM_SchedulingDelegate : public MM_BaseNonVirtual
@@ -96,6 +98,10 @@ private:
 	uintptr_t _dynamicGlobalMarkIncrementTimeMillis;  /**< The dynamically calculated current time to be spent per GMP increment (subject to change over the course of the run) */
 
 	double _pgcTimeIncreasePerEdenFactor; /**< Used to keep track of how much pgc time will increase as eden size increases */
+	MM_PgcTimePredictor *_pgcTimePredictor; /**< Optional model used to predict PGC time for eden sizing (NULL when the eden size only model above is used) */
+	MM_PgcTimePredictorInputs _lastPgcInputs; /**< Shape of the most recent copy-forward PGC, used as the base when projecting the shape of PGCs for other eden sizes */
+	double _predictedPgcTimeMillis; /**< PGC time predicted for the most recent PGC before it ran, measured in ms */
+	double _actualPgcTimeMillis; /**< Measured time of the most recent PGC, measured in ms */
 
 	intptr_t _edenSizeFactor; /**< Used to indicate how far eden should increase or decrease from current value. Positive values indicate max eden should be larger, while - values indicate max eden should shrink. Value corresponds to number of regions */
 	uintptr_t _pgcCountSinceGMPEnd; /**< Counts the number of PGC's from end of last GMP cycle, to the end of current(next) GMP cycle */
@@ -205,6 +211,15 @@ private:
 	 */
 	double predictPgcTime(MM_EnvironmentVLHGC *env, uintptr_t currentEdenSize, intptr_t edenSizeChange);
 
+	/**
+	 * Train the installed PGC time predictor (if any) with a completed copy-forward PGC, and remember the time
+	 * that was predicted for it so that predicted and actual times can be reported.
+	 * @param env[in] The main GC thread
+	 * @param copyForwardStats[in] Statistics of the completed PGC
+	 * @param pgcTime The measured time of the completed PGC, in ms
+	 */
+	void updatePgcTimePredictor(MM_EnvironmentVLHGC *env, MM_CopyForwardStats *copyForwardStats, uint64_t pgcTime);
+
 	/**
 	 * @return The estimated number of bytes which we have remaining to scan for the current GMP cycle.
 	 * If there is not currently a GMP running, returns calculateEstimatedGlobalBytesToScan()
@@ -407,6 +422,12 @@ public:
 	 */
 	bool initialize(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Tear down the receiver.
+	 * @param env[in] The thread tearing down the collector
+	 */
+	void tearDown(MM_EnvironmentVLHGC *env);
+
 	uintptr_t initializeKickoffHeadroom(MM_EnvironmentVLHGC *env);
 
 	/**
@@ -614,6 +635,21 @@ public:
 	 */
 	void partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env, uintptr_t reclaimableRegions, uintptr_t defragmentReclaimableRegions);
 
+	/**
+	 * @return the name of the model used to predict PGC time for eden sizing
+	 */
+	const char *getPgcTimePredictorName() const { return (NULL != _pgcTimePredictor) ? _pgcTimePredictor->getName() : "eden"; }
+
+	/**
+	 * @return the time predicted for the most recent PGC before it ran, in ms (0 if no prediction was made)
+	 */
+	double getPredictedPgcTimeMillis() const { return _predictedPgcTimeMillis; }
+
+	/**
+	 * @return the measured time of the most recent PGC, in ms
+	 */
+	double getActualPgcTimeMillis() const { return _actualPgcTimeMillis; }
+
 	/**
 	 * Determine what type of PGC should be run next PGC cycle (Copy-Forward, Mark-Sweep-Compact etc)
 	 * The result is not explicitly returned, but implicitly through CycleState, class member flag etc.
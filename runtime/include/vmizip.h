@@ -60,6 +60,7 @@ extern "C" {
 /* flags used in zip_openZipFile() */
 #define ZIP_FLAG_OPEN_CACHE 1
 #define ZIP_FLAG_BOOTSTRAP 2
+#define ZIP_FLAG_MAP_FILE 4
 
 typedef struct VMIZipEntry
 {
@@ -96,6 +97,7 @@ typedef struct VMIZipFile
   I_64 pointer;
   U_8 internalFilename[80];
   U_8 type;
+  void *mmapHandle;
 } VMIZipFile;
 
 typedef struct VMIZipFunctionTable {
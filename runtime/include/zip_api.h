@@ -52,6 +52,9 @@ extern "C" {
 /* Accept the file as a zip file even if it does not start with a local header */
 #define J9ZIP_OPEN_ALLOW_NONSTANDARD_ZIP 2
 
+/* Map the file into memory and read entry data from the mapping rather than with file reads. */
+#define J9ZIP_OPEN_MAP_FILE 4
+
 /* Empty set of options */
 #define J9ZIP_GETENTRY_NO_FLAGS 0
 
@@ -467,6 +470,18 @@ I_32
 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8* buffer, U_32 bufferSize);
 
 
+/**
+* @brief
+* @param portLib
+* @param zipFile
+* @param entry
+* @param data
+* @return I_32
+*/
+I_32
+zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data);
+
+
 /**
 * @brief
 * @param portLib
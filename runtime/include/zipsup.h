@@ -135,6 +135,7 @@ typedef struct J9ZipFile {
     I_64 pointer;
     U_8 internalFilename[80];
     U_8 type;
+    void* mmapHandle;
 } J9ZipFile;
 
 typedef struct J9ZipChunkHeader {
@@ -169,6 +170,21 @@ typedef struct J9ZipDirEntry {
 #define J9ZIPDIRENTRY_FILELIST(base) WSRP_GET((base)->fileList, struct J9ZipFileRecord*)
 #define J9ZIPDIRENTRY_DIRLIST(base) WSRP_GET((base)->dirList, struct J9ZipDirEntry*)
 
+typedef struct J9ZipCacheIndexSlot {
+    UDATA hash;
+    J9WSRP entry;
+    J9WSRP parent;
+} J9ZipCacheIndexSlot;
+
+#define J9ZIPCACHEINDEXSLOT_ENTRY(base) WSRP_GET((base)->entry, void*)
+#define J9ZIPCACHEINDEXSLOT_PARENT(base) WSRP_GET((base)->parent, struct J9ZipDirEntry*)
+
+typedef struct J9ZipCacheIndex {
+    UDATA slotCount;
+} J9ZipCacheIndex;
+
+#define J9ZIPCACHEINDEX_SLOTS(base) ((struct J9ZipCacheIndexSlot*)((base) + 1))
+
 typedef struct J9ZipCacheEntry {
     J9WSRP zipFileName;
     IDATA zipFileSize;
@@ -176,12 +192,15 @@ typedef struct J9ZipCacheEntry {
     IDATA startCentralDir;
     J9WSRP currentChunk;
     J9WSRP chunkActiveDir;
+    UDATA entryCount;
+    J9WSRP index;
     struct J9ZipDirEntry root;
 } J9ZipCacheEntry;
 
 #define J9ZIPCACHEENTRY_ZIPFILENAME(base) WSRP_GET((base)->zipFileName, U_8*)
 #define J9ZIPCACHEENTRY_CURRENTCHUNK(base) WSRP_GET((base)->currentChunk, struct J9ZipChunkHeader*)
 #define J9ZIPCACHEENTRY_CHUNKACTIVEDIR(base) WSRP_GET((base)->chunkActiveDir, struct J9ZipDirEntry*)
+#define J9ZIPCACHEENTRY_INDEX(base) WSRP_GET((base)->index, struct J9ZipCacheIndex*)
 #define J9ZIPCACHEENTRY_NEXT(base) WSRP_GET((&((base)->root))->next, struct J9ZipDirEntry*)
 #define J9ZIPCACHEENTRY_FILELIST(base) WSRP_GET((&((base)->root))->fileList, struct J9ZipFileRecord*)
 #define J9ZIPCACHEENTRY_DIRLIST(base) WSRP_GET((&((base)->root))->dirList, struct J9ZipDirEntry*)
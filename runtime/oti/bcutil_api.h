@@ -105,6 +105,23 @@ j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDA
 void
 shutdownROMClassBuilder(J9JavaVM *vm);
 
+/**
+* Create the ROMClass preparser, which parses the classes of the bootstrap and
+* application class path jars on background threads. Does nothing if threadCount is 0.
+* @param vm
+* @param threadCount number of preparser threads
+* @param memoryBudget bytes of preparsed class files that may be held at once
+*/
+void
+initializeROMClassPreparser(J9JavaVM *vm, UDATA threadCount, UDATA memoryBudget);
+
+/**
+* Stop the preparser threads and free any preparsed class files that were not consumed.
+* @param vm
+*/
+void
+shutdownROMClassPreparser(J9JavaVM *vm);
+
 #if defined(J9DYN_TEST)
 IDATA
 j9bcutil_compareRomClass(
@@ -387,6 +387,7 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME3_JAVA_STACK_GUARD_PAGES 0x80
 #define J9_EXTENDED_RUNTIME3_ENABLE_JFR_CLASSLOAD_TRANSFORM 0x100
 #define J9_EXTENDED_RUNTIME3_JFR_V2_SUPPORT 0x200
+#define J9_EXTENDED_RUNTIME3_MAP_BOOTSTRAP_JARS 0x400
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
 #define J9_OBJECT_HEADER_SHAPE_MASK 0xE /* OBJECT_HEADER_SHAPE_MASK */
@@ -986,6 +987,11 @@ extern "C" {
 #define J9JFR_EVENT_TYPE_YOUNG_GC_ENTRY 14
 #define J9JFR_EVENT_TYPE_GARBAGE_COLLECTION_ENTRY 15
 #define J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY 16
+#define J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE 17
+#define J9JFR_EVENT_TYPE_COMPILATION 18
+#define J9JFR_EVENT_TYPE_DEOPTIMIZATION 19
+#define J9JFR_EVENT_TYPE_CODE_CACHE_FULL 20
+#define J9JFR_EVENT_TYPE_CODE_CACHE_STATISTICS 21
 
 /* JFR thread states. */
 
@@ -374,6 +374,7 @@ struct J9VMContinuation;
 typedef struct J9ThreadJFRState {
 	omrthread_thread_time_t prevThreadCPUTimes;
 	int64_t prevTimestamp;
+	UDATA prevAllocatedBytes;
 } J9ThreadJFRState;
 
 typedef struct J9JFRBufferWalkState {
@@ -395,8 +396,13 @@ typedef struct J9JFRBuffer {
 	UDATA eventType; \
 	struct J9VMThread *vmThread;
 
+/* stackTraceID is the 1-based slot of the trace in JFRState.stackTraceTable, in which case
+ * stackTraceSize is 0. Traces that could not be recorded in the table are stored inline
+ * with stackTraceID 0.
+ */
 #define J9JFR_EVENT_WITH_STACKTRACE_FIELDS \
 	J9JFR_EVENT_COMMON_FIELDS \
+	UDATA stackTraceID; \
 	UDATA stackTraceSize;
 
 typedef struct J9JFREvent {
@@ -407,6 +413,14 @@ typedef struct J9JFREventWithStackTrace {
 	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
 } J9JFREventWithStackTrace;
 
+/* Variable-size structure - frameCount worth of UDATA follow the fixed portion */
+typedef struct J9JFRStackTrace {
+	UDATA hash;
+	UDATA frameCount;
+} J9JFRStackTrace;
+
+#define J9JFRSTACKTRACE_FRAMES(stackTrace) ((UDATA*)(((J9JFRStackTrace*)(stackTrace)) + 1))
+
 /* Variable-size structure - stackTraceSize worth of UDATA follow the fixed portion */
 typedef struct J9JFRExecutionSample {
 	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
@@ -544,6 +558,47 @@ typedef struct J9JFRGCHeapSummary {
 	I_64 heapUsed;
 } J9JFRGCHeapSummary;
 
+typedef struct J9JFRObjectAllocationSample {
+	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
+	struct J9Class *objectClass;
+	UDATA objectSize;
+	UDATA weight;
+} J9JFRObjectAllocationSample;
+
+#define J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRObjectAllocationSample *)(jfrEvent)) + 1))
+
+typedef struct J9JFRCompilation {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	struct J9Method *method;
+	UDATA compileID;
+	UDATA compileLevel;
+	UDATA codeSize;
+	UDATA inlinedBytes;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+} J9JFRCompilation;
+
+typedef struct J9JFRDeoptimization {
+	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
+	struct J9Method *method;
+	UDATA bytecodeIndex;
+	UDATA reason;
+} J9JFRDeoptimization;
+
+#define J9JFRDEOPTIMIZATION_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRDeoptimization *)(jfrEvent)) + 1))
+
+/* Used for both the CodeCacheFull and CodeCacheStatistics events */
+typedef struct J9JFRCodeCacheStatistics {
+	J9JFR_EVENT_COMMON_FIELDS
+	U_64 startAddress;
+	U_64 committedTopAddress;
+	U_64 reservedTopAddress;
+	UDATA methodCount;
+	U_64 unallocatedCapacity;
+	UDATA fullCount;
+} J9JFRCodeCacheStatistics;
+
 typedef struct J9JFRTypeID {
 	jlong id;
 	struct J9UTF8 *className;
@@ -892,6 +947,7 @@ typedef struct J9JITExceptionTable {
 #define JIT_METADATA_IS_PRECHECKPOINT_COMP 0x40
 #define JIT_METADATA_IS_FSD_COMP 0x80
 #define JIT_METADATA_VECTORIZED_CODE 0x100
+#define JIT_METADATA_IS_HOT_CODE 0x200
 
 typedef struct J9JIT16BitExceptionTableEntry {
 	U_16 startPC;
@@ -971,6 +1027,9 @@ typedef struct J9ClassHotFieldsInfo {
 	uint8_t hotFieldOffset3;
 	uint8_t consecutiveHotFieldSelections;
 	uint8_t hotFieldListLength;
+	uint8_t colocationBackoff;
+	uint32_t colocationHits;
+	uint32_t colocationMisses;
 } J9ClassHotFieldsInfo;
 
 typedef struct J9ROMNameAndSignature {
@@ -1542,7 +1601,7 @@ typedef struct J9SharedCacheHeader {
 	UDATA corruptValue;
 	UDATA lastMetadataType;
 	UDATA writerCount;
-	UDATA unused5;
+	UDATA lookupIndexSRP; /* Offset from the cache header to the LookupIndexHeader of the most recent lookup index, 0 if none */
 	UDATA unused6;
 	U_32 softMaxBytes;
 	UDATA unused8;
@@ -1601,6 +1660,9 @@ typedef struct J9SharedCacheAPI {
 	U_8 usingJITServerAOTCacheLayer;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 	I_32 newStartupHints;
+	U_32 timestampCheckThreads; /* threads used to check classpath entry timestamps in one batch at startup, 0 to check them lazily */
+	U_32 timestampCacheWindow; /* milliseconds for which the batched timestamps answer later checks */
+	char* imageManifest; /* file whose content identifies an immutable image, in which case jar timestamps validated under the same content are trusted */
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -2229,6 +2291,7 @@ typedef struct J9TranslationBufferSet {
 	U_8* classFileError;
 	UDATA classFileSize;
 	void* romClassBuilder;
+	void* romClassPreparser;
 	IDATA  ( *findLocallyDefinedClassFunction)(struct J9VMThread * vmThread, struct J9Module * j9module, U_8 * className, U_32 classNameLength, struct J9ClassLoader * classLoader, UDATA options, struct J9TranslationLocalBuffer *localBuffer) ;
 	struct J9Class*  ( *internalDefineClassFunction)(struct J9VMThread* vmThread, void* className, UDATA classNameLength, U_8* classData, UDATA classDataLength, j9object_t classDataObject, struct J9ClassLoader* classLoader, j9object_t protectionDomain, UDATA options, struct J9ROMClass *existingROMClass, struct J9Class *hostClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	I_32  ( *closeZipFileFunction)(struct J9VMInterface* vmi, struct VMIZipFile* zipFile) ;
@@ -3623,6 +3686,20 @@ typedef struct J9MemberNameListNode {
 } J9MemberNameListNode;
 #endif /* defined(J9VM_OPT_OPENJDK_METHODHANDLE) */
 
+/**
+ * Open-addressed hash index over the name and signature of the methods of a RAM class,
+ * used in place of a linear search when the ROM methods are not sorted. Each of the
+ * (mask + 1) U_16 buckets following the header holds the index of a method in ramMethods
+ * plus one, or zero if the bucket is empty.
+ */
+typedef struct J9MethodLookupIndex {
+	struct J9ROMClass* romClass;
+	U_32 mask;
+	U_32 reserved;
+} J9MethodLookupIndex;
+
+#define J9METHODLOOKUPINDEX_BUCKETS(index) ((U_16 *)((index) + 1))
+
 typedef struct J9Class {
 	UDATA eyecatcher;
 	struct J9ROMClass* romClass;
@@ -3686,6 +3763,7 @@ typedef struct J9Class {
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	struct J9FlattenedClassCache* flattenedClassCache;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
 	/* A linked list of weak global references to every resolved MemberName whose clazz is this class. */
 	J9MemberNameListNode *memberNames;
@@ -3787,6 +3865,7 @@ typedef struct J9ArrayClass {
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
 	/* A linked list of weak global references to every resolved MemberName whose clazz is this class. */
 	J9MemberNameListNode *memberNames;
@@ -5137,6 +5216,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_arraylet_getLeafLogSize)(struct J9JavaVM* javaVM) ;
 	void  ( *j9gc_get_offheap_data)(struct J9JavaVM *javaVM, void **offheapControlStructure, void **base, void **top, UDATA *usage);
 	void  ( *j9gc_set_allocation_sampling_interval)(struct J9JavaVM *vm, UDATA samplingInterval);
+	UDATA  ( *j9gc_get_allocation_sampling_interval)(struct J9JavaVM *vm);
 	void  ( *j9gc_set_allocation_threshold)(struct J9VMThread *vmThread, UDATA low, UDATA high) ;
 	void  ( *j9gc_objaccess_recentlyAllocatedObject)(struct J9VMThread *vmThread, J9Object *dstObject) ;
 	void  ( *j9gc_objaccess_postStoreClassToClassLoader)(struct J9VMThread *vmThread, J9ClassLoader *destClassLoader, J9Class *srcClass) ;
@@ -5632,6 +5712,9 @@ typedef struct J9InternalVMFunctions {
 	void  (*jfrOldGarbageCollection)(struct OMR_VMThread *omrVMThread) ;
 	void  (*jfrYoungGarbageCollection)(struct OMR_VMThread *omrVMThread) ;
 	void  (*jfrGarbageCollection)(struct OMR_VMThread *omrVMThread) ;
+	void (*jfrCompilation)(struct J9VMThread *currentThread, struct J9Method *method, I_64 startTicks, UDATA compileLevel, BOOLEAN succeeded, BOOLEAN isOSR, UDATA codeSize, UDATA inlinedBytes);
+	void (*jfrDeoptimization)(struct J9VMThread *currentThread, struct J9Method *method, UDATA bytecodeIndex, UDATA reason);
+	void (*jfrCodeCacheFull)(struct J9VMThread *currentThread);
 	jboolean (*setJFRRecordingFileName)(struct J9JavaVM *vm, char *fileName);
 	void (*tearDownJFR)(struct J9JavaVM *vm);
 	jlong (*getTypeIdUTF8)(struct J9VMThread *currentThread, struct J9ClassLoader *classLoader, struct J9UTF8 *className, BOOLEAN freeName);
@@ -5788,6 +5871,20 @@ typedef struct J9VMContinuation {
 #define IS_J9_OBJECT_MONITOR_OWNER_DETACHED(owner) FALSE
 #endif /* JAVA_SPEC_VERSION >= 24 */
 
+/**
+ * Per-thread cache of interned Strings, consulted without locking before the
+ * GC string table. Entries are weak and are discarded whenever exclusive VM
+ * access is released, so they never have to be updated by the collector.
+ * The entries array of 'size' (a power of two) slots immediately follows the header.
+ */
+typedef struct J9InternStringCache {
+	UDATA size;
+	UDATA hits;
+	UDATA misses;
+} J9InternStringCache;
+
+#define J9INTERNSTRINGCACHE_ENTRIES(cache) ((j9object_t *)((cache) + 1))
+
 #if JAVA_SPEC_VERSION >= 22
 typedef struct J9CloseScopeListNode {
 	jobject closeScope;
@@ -6034,6 +6131,7 @@ typedef struct J9VMThread {
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	UDATA safePointCount;
 	struct J9HashTable * volatile utfCache;
+	struct J9InternStringCache *internStringCache;
 #if defined(J9VM_OPT_JFR)
 	J9JFRBuffer jfrBuffer;
 #endif /* defined(J9VM_OPT_JFR) */
@@ -6164,6 +6262,15 @@ typedef struct JFRState {
 	jclass jfrInternalEventClassRef;
 	jclass jfrEventClassRef;
 	J9Method *onRetransformUpcallMethod;
+	struct J9JFRStackTrace **stackTraceTable;
+	UDATA stackTraceCount;
+	BOOLEAN isAllocationSamplingEnabled;
+	UDATA previousAllocationSamplingInterval;
+	I_64 allocationSampleWindowStart;
+	UDATA allocationSampleWindowCount;
+	UDATA compilationCount;
+	UDATA compiledMethodCount;
+	UDATA codeCacheFullCount;
 } JFRState;
 
 typedef struct J9ReflectFunctionTable {
@@ -384,6 +384,8 @@ enum INIT_STAGE {
 #define VMOPT_OPT_XXNOINTERLEAVEMEMORY "-XX:-InterleaveMemory"
 #define VMOPT_OPT_XXINTERLEAVEMEMORY "-XX:+InterleaveMemory"
 #define VMOPT_ROMMETHODSORTTHRESHOLD_EQUALS "-XX:ROMMethodSortThreshold="
+#define VMOPT_XXROMCLASSPREPARSETHREADS_EQUALS "-XX:ROMClassPreparseThreads="
+#define VMOPT_XXROMCLASSPREPARSEMEMORY_EQUALS "-XX:ROMClassPreparseMemory="
 #define VMOPT_VALUEFLATTENINGTHRESHOLD_EQUALS "-XX:ValueTypeFlatteningThreshold="
 #define VMOPT_VTARRAYFLATTENING_EQUALS "-XX:+EnableArrayFlattening"
 #define VMOPT_VTDISABLEARRAYFLATTENING_EQUALS "-XX:-EnableArrayFlattening"
@@ -407,6 +409,8 @@ enum INIT_STAGE {
 #define VMOPT_XXENABLELEGACYMANGLING "-XX:+UseLegacyJNINameEscaping"
 #define VMOPT_XXENABLEUTFCACHE "-XX:+UTFCache"
 #define VMOPT_XXDISABLEUTFCACHE "-XX:-UTFCache"
+#define VMOPT_XXENABLEMAPBOOTSTRAPJARS "-XX:+MapBootstrapJars"
+#define VMOPT_XXDISABLEMAPBOOTSTRAPJARS "-XX:-MapBootstrapJars"
 #define VMOPT_XXENABLEENSUREHASHED "-XX:+EnsureHashed:"
 #define VMOPT_XXDISABLEENSUREHASHED "-XX:-EnsureHashed:"
 #define VMOPT_XXOPENJ9COMMANDLINEENV "-XX:+OpenJ9CommandLineEnv"
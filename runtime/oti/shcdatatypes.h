@@ -224,6 +224,53 @@ typedef struct AttachedDataWrapper {
 #define ADWDATA(adw) (((U_8*)(adw)) + sizeof(AttachedDataWrapper))
 #define ADWITEM(adw) (((U_8*)(adw)) - sizeof(ShcItem))
 
+/*
+ * Lookup index stored as unindexed byte data and located through J9SharedCacheHeader.lookupIndexSRP.
+ * All offsets are relative, so the index is valid wherever the cache is mapped. Each index only describes
+ * the items below the coveredOffset of the index stored before it, which it links to through previousIndexOffset.
+ * Items at or above coveredOffset of the most recent index are described by the chain and are not passed to
+ * SH_Manager::storeNew() at startup.
+ */
+#define LOOKUPINDEX_MAGIC 0x58444E49 /* "INDX" */
+#define LOOKUPINDEX_VERSION 2
+
+typedef struct LookupIndexHeader {
+	U_32 magic;
+	U_32 version;
+	U_32 sectionCount;
+	U_32 totalLength;
+	U_32 coveredOffset; /* offset from the cache header of the lowest ShcItem covered by the index */
+	U_32 previousIndexOffset; /* offset from the cache header of the previous LookupIndexHeader, 0 if none */
+} LookupIndexHeader;
+
+/* One section per manager, identified by the first data type the manager represents */
+typedef struct LookupIndexSection {
+	U_32 itemType;
+	U_32 slotCount;
+	U_32 slotsOffset; /* offset from the LookupIndexHeader to the first LookupIndexSlot */
+	U_32 padding;
+} LookupIndexSection;
+
+/* Slots are sorted by hash, and within a hash in cache order (highest itemOffset first) */
+typedef struct LookupIndexSlot {
+	U_32 hash;
+	U_32 itemOffset; /* offset from the cache header of the ShcItem */
+} LookupIndexSlot;
+
+#define LOOKUPINDEX_SECTIONS(lih) ((LookupIndexSection*)(((U_8*)(lih)) + sizeof(LookupIndexHeader)))
+#define LOOKUPINDEX_SLOTS(lih, lis) ((LookupIndexSlot*)(((U_8*)(lih)) + J9SHR_READMEM((lis)->slotsOffset)))
+
+/*
+ * Stored as byte data by a JVM running with -Xshareclasses:imageManifest=<file>. Jar and jimage classpath
+ * entries at or above validatedOffset were checked against the file system, and marked stale if they had
+ * changed, by a JVM whose manifest content hashed to manifestHash.
+ */
+typedef struct ImageManifestRecord {
+	U_64 manifestHash;
+	U_32 validatedOffset; /* offset from the cache header */
+	U_32 padding;
+} ImageManifestRecord;
+
 #ifdef __cplusplus
 }
 #endif
@@ -5836,6 +5836,42 @@ jfrYoungGarbageCollection(OMR_VMThread *omrVMThread);
 void
 jfrGarbageCollection(OMR_VMThread *omrVMThread);
 
+/**
+ * Record a JIT compilation. The compile ID is assigned by JFR. The event is
+ * dropped if the current thread does not hold VM access.
+ *
+ * @param currentThread[in] the compilation thread
+ * @param method[in] the compiled method
+ * @param startTicks[in] the time the compilation started
+ * @param compileLevel[in] the optimization level of the compilation
+ * @param succeeded[in] whether the compilation succeeded
+ * @param isOSR[in] whether this is an on-stack replacement compilation
+ * @param codeSize[in] the size in bytes of the generated code
+ * @param inlinedBytes[in] the total bytecode size of the inlined methods
+ */
+void
+jfrCompilation(J9VMThread *currentThread, J9Method *method, I_64 startTicks, UDATA compileLevel, BOOLEAN succeeded, BOOLEAN isOSR, UDATA codeSize, UDATA inlinedBytes);
+
+/**
+ * Record the decompilation of a JIT frame on the current thread. Must be called with VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param method[in] the outermost method of the decompiled frame
+ * @param bytecodeIndex[in] the bytecode index execution resumes at
+ * @param reason[in] the JITDECOMP_* reason for the decompilation
+ */
+void
+jfrDeoptimization(J9VMThread *currentThread, J9Method *method, UDATA bytecodeIndex, UDATA reason);
+
+/**
+ * Record that the JIT code cache is full. The full count is always updated, but
+ * the event is dropped if the current thread does not hold VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ */
+void
+jfrCodeCacheFull(J9VMThread *currentThread);
+
 /**
  * Set JFR recording file name.
  *
@@ -185,6 +185,7 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 		vm->sharedCacheAPI->maxJIT = -1;
 		vm->sharedCacheAPI->layer = -1;
 		vm->sharedCacheAPI->newStartupHints = -1;
+		vm->sharedCacheAPI->timestampCacheWindow = 1000; /* only used if timestamps are checked in a batch */
 		if (index >= 0) {
 			/* -Xshareclasses is specified */
 			char optionsBuffer[SHR_SUBOPT_BUFLEN];
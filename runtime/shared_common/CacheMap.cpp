@@ -69,6 +69,13 @@ static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
 #define DEFAULT_WRITE_HASH_WAIT_MILLIS 10
 #define WRITE_HASH_DEFAULT_MAX_MICROS 20000
 
+#define LOOKUPINDEX_MAX_SECTIONS 8
+#define LOOKUPINDEX_MIN_NEW_ITEMS 256
+
+#define IMAGEMANIFEST_KEY "j9shr_imageManifest"
+#define IMAGEMANIFEST_READ_BUFFER_SIZE 4096
+#define DEFAULT_TIMESTAMP_CHECK_THREADS 4
+
 #define MARK_STALE_RETRY_TIMES 10
 #define VERBOSE_BUFFER_SIZE 255
 
@@ -286,6 +293,7 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_writeHashAverageTimeMicros = 0;
 	_writeHashContendedResetHash = 0;
 	_bytesRead = 0;
+	_lookupIndexSlotsStored = 0;
 	_isAssertEnabled = true;
 	_metadataReleaseCounter = 0;
 	_ccPool = NULL;
@@ -357,6 +365,7 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 
 	Trc_SHR_CM_cleanup_Entry(currentThread);
 
+	_tsm->cleanup(currentThread);
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
 		walkManager->cleanup(currentThread);
@@ -731,10 +740,156 @@ error:
 
 	updateROMSegmentList(currentThread, false, false);
 
+	validateClasspathTimestamps(currentThread);
+
 	Trc_SHR_CM_startup_ExitOK(currentThread);
 	return 0;
 }
 
+/**
+ * Checks the timestamps of all jar and jimage classpath entries known to the cache in one batch at startup,
+ * rather than one at a time as classes are found, if -Xshareclasses:timestampCheckThreads=<n> is specified.
+ *
+ * With -Xshareclasses:imageManifest=<file>, the content of the file identifies an immutable image. If it
+ * matches the content recorded in the cache, entries already validated under that image are trusted and
+ * not checked at all. Otherwise all entries are checked, the ones that changed are marked stale, and the
+ * new manifest is recorded together with the extent of the metadata that has been validated.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_CacheMap::validateClasspathTimestamps(J9VMThread* currentThread)
+{
+	J9SharedCacheAPI* sharedCacheAPI = currentThread->javaVM->sharedCacheAPI;
+	const char* manifest = sharedCacheAPI->imageManifest;
+	UDATA threadCount = sharedCacheAPI->timestampCheckThreads;
+	U_64 manifestHash = 0;
+	bool trusted = false;
+	ClasspathEntryItem** cpeis = NULL;
+	UDATA count = 0;
+	UDATA checked = 0;
+	I_64 startMillis = 0;
+	SH_ClasspathManager* localCPM = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS)
+		|| ((0 == threadCount) && (NULL == manifest))
+	) {
+		return;
+	}
+
+	if (NULL != manifest) {
+		if (hashImageManifest(currentThread, manifest, &manifestHash)) {
+			J9SharedDataDescriptor found;
+
+			if ((1 == findSharedData(currentThread, IMAGEMANIFEST_KEY, strlen(IMAGEMANIFEST_KEY), J9SHR_DATA_TYPE_VM, FALSE, &found, NULL))
+				&& (sizeof(ImageManifestRecord) == found.length)
+				&& (((const ImageManifestRecord*)found.address)->manifestHash == manifestHash)
+			) {
+				U_8* cacheHeader = (U_8*)_ccHead->getCacheHeaderAddress();
+
+				_tsm->setTrustedRange(cacheHeader + ((const ImageManifestRecord*)found.address)->validatedOffset, _ccHead->getCacheEndAddress());
+				trusted = true;
+				CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_IMAGE_MANIFEST_TRUSTED, manifest);
+			}
+		} else {
+			CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_WARNING, J9NLS_SHRC_CM_IMAGE_MANIFEST_READ_FAILED, manifest);
+			manifest = NULL;
+		}
+	}
+	if (trusted && (0 == threadCount)) {
+		/* Entries added since the manifest was recorded are checked lazily */
+		return;
+	}
+	if (0 == threadCount) {
+		threadCount = DEFAULT_TIMESTAMP_CHECK_THREADS;
+	}
+
+	if (NULL == (localCPM = getClasspathManager(currentThread))) {
+		return;
+	}
+	count = localCPM->collectTimestampCandidates(currentThread, NULL, 0);
+	if (0 != count) {
+		cpeis = (ClasspathEntryItem**)j9mem_allocate_memory(count * sizeof(ClasspathEntryItem*), J9MEM_CATEGORY_CLASSES);
+		if (NULL == cpeis) {
+			return;
+		}
+		/* Classpaths may have been added by another JVM since counting */
+		count = OMR_MIN(count, localCPM->collectTimestampCandidates(currentThread, cpeis, count));
+	}
+
+	startMillis = j9time_current_time_millis();
+	checked = _tsm->prefetchTimeStamps(currentThread, cpeis, count, threadCount, sharedCacheAPI->timestampCacheWindow);
+	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_TIMESTAMPS_BATCH_CHECKED, checked, (I_64)(j9time_current_time_millis() - startMillis));
+
+	if ((NULL != manifest) && !trusted && !_ccHead->isRunningReadOnly()) {
+		bool allMarked = true;
+		ImageManifestRecord record;
+		J9SharedDataDescriptor data;
+
+		/* Before recording the new manifest, mark stale whatever changed so that later JVMs need not check it */
+		record.manifestHash = manifestHash;
+		record.validatedOffset = (U_32)((U_8*)_ccHead->getMetaAllocPtr() - (U_8*)_ccHead->getCacheHeaderAddress());
+		record.padding = 0;
+		for (UDATA i = 0; i < count; i++) {
+			I_64 newTS = _tsm->checkCPEITimeStamp(currentThread, cpeis[i]);
+
+			if ((TIMESTAMP_UNCHANGED != newTS) && (TIMESTAMP_DOES_NOT_EXIST != newTS)) {
+				if (0 != markStale(currentThread, cpeis[i], false)) {
+					allMarked = false;
+				}
+			}
+		}
+		if (allMarked) {
+			data.address = (U_8*)&record;
+			data.length = sizeof(ImageManifestRecord);
+			data.type = J9SHR_DATA_TYPE_VM;
+			data.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE;
+			storeSharedData(currentThread, IMAGEMANIFEST_KEY, strlen(IMAGEMANIFEST_KEY), &data);
+		}
+	}
+
+	if (NULL != cpeis) {
+		j9mem_free_memory(cpeis);
+	}
+}
+
+/**
+ * Computes a 64-bit FNV-1a hash of the content of the image manifest file.
+ *
+ * @param [in] currentThread The current thread
+ * @param [in] manifest Path of the manifest file
+ * @param [out] hash The hash of the file content
+ *
+ * @return true if the file was read, false otherwise
+ */
+bool
+SH_CacheMap::hashImageManifest(J9VMThread* currentThread, const char* manifest, U_64* hash)
+{
+	U_8 buffer[IMAGEMANIFEST_READ_BUFFER_SIZE];
+	U_64 result = J9CONST64(0xcbf29ce484222325);
+	IDATA bytesRead = 0;
+	IDATA fd = -1;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	fd = j9file_open(manifest, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+	while ((bytesRead = j9file_read(fd, buffer, sizeof(buffer))) > 0) {
+		for (IDATA i = 0; i < bytesRead; i++) {
+			result ^= buffer[i];
+			result *= J9CONST64(0x100000001b3);
+		}
+	}
+	j9file_close(fd);
+	if (bytesRead < 0) {
+		return false;
+	}
+	*hash = result;
+	return true;
+}
+
 /**
  * Handle the SH_CompositeCacheImpl start up error
  *
@@ -1152,6 +1307,7 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	IDATA result = 0;
 	IDATA expectedCntr = expectedUpdates;
 	SH_Manager* manager = NULL;
+	const LookupIndexHeader* lookupIndex = NULL;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
 	if (!cache->hasWriteMutex(currentThread)) {
@@ -1160,6 +1316,11 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 
 	Trc_SHR_CM_readCache_Entry(currentThread, expectedUpdates);
 
+	/* A manager can only take over items from a lookup index before it has been given any item from this cache */
+	if (!startupForStats && !cache->hasReadEntries()) {
+		lookupIndex = cache->getLookupIndex();
+	}
+
 	/* For each cached item, find a suitable manager and store it */
 	do {
 		it = (ShcItem*)cache->nextEntry(currentThread, NULL);		/* IMPORTANT: Do not skip stale entries (can end up with lone orphans) */
@@ -1183,7 +1344,16 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 					++result;
 				} else if ((rc > 0) && ((UDATA)rc == itemType)) {
 					/* Success - we have a started manager */
-					if (manager->storeNew(currentThread, it, cache)) {
+					if ((NULL != lookupIndex) && manager->usesLookupIndex()) {
+						manager->attachLookupIndex(currentThread, cache, lookupIndex);
+					}
+					if (manager->isCoveredByLookupIndex(cache, it)) {
+						/* The manager adds the item to its hashtable from the lookup index when a lookup first needs it */
+						if (expectedCntr != -1) {
+							--expectedCntr;
+						}
+						++result;
+					} else if (manager->storeNew(currentThread, it, cache)) {
 						if (expectedCntr != -1) {
 							--expectedCntr;
 						}
@@ -5295,6 +5465,125 @@ SH_CacheMap::printShutdownStats(void)
 
 	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_READ_STORED, bytesRead, bytesStored);
 	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
+	if (NULL != _rcm) {
+		CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_LOOKUPINDEX, _rcm->getLookupIndexItemsMaterialized(), _lookupIndexSlotsStored);
+	}
+}
+
+/**
+ * Store a new lookup index for the top layer cache if enough ROMClass items have been added since the
+ * current index was built, so that the next JVM to attach need not pass every item to storeNew().
+ * The new index only describes the items which are not covered by the current one, and links to it,
+ * so the space used by the chain grows with the number of items rather than with the number of rebuilds.
+ *
+ * @param [in] currentThread The current thread
+ */
+void
+SH_CacheMap::storeLookupIndex(J9VMThread* currentThread)
+{
+	const char* fnName = "storeLookupIndex";
+	SH_CompositeCacheImpl* cache = _ccHead;
+	const LookupIndexHeader* oldIndex = NULL;
+	LookupIndexSlot* sectionSlots[LOOKUPINDEX_MAX_SECTIONS];
+	UDATA sectionSlotCounts[LOOKUPINDEX_MAX_SECTIONS];
+	UDATA sectionTypes[LOOKUPINDEX_MAX_SECTIONS];
+	UDATA sectionCount = 0;
+	UDATA totalSlots = 0;
+	U_32 previousCoveredOffset = U_32_MAX;
+	U_32 previousIndexOffset = 0;
+	U_32 coveredOffset = U_32_MAX;
+	SH_Manager* walkManager = NULL;
+	SH_Managers::ManagerWalkState state;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == currentThread)
+		|| (NULL == cache)
+		|| !cache->isStarted()
+		|| cache->isRunningReadOnly()
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES)
+		|| cache->isWriteMutexOwned()
+	) {
+		return;
+	}
+	if (0 != cache->enterWriteMutex(currentThread, false, fnName)) {
+		return;
+	}
+	if (-1 == runEntryPointChecks(currentThread, NULL, NULL)) {
+		cache->exitWriteMutex(currentThread, fnName);
+		return;
+	}
+
+	oldIndex = cache->getLookupIndex();
+	if (NULL != oldIndex) {
+		previousCoveredOffset = oldIndex->coveredOffset;
+		previousIndexOffset = (U_32)((U_8*)oldIndex - (U_8*)cache->getCacheHeaderAddress());
+	}
+	walkManager = managers()->startDo(currentThread, 0, &state);
+	while ((NULL != walkManager) && (sectionCount < LOOKUPINDEX_MAX_SECTIONS)) {
+		UDATA slotCount = 0;
+		LookupIndexSlot* slots = walkManager->collectLookupIndexSlots(currentThread, cache, previousCoveredOffset, &slotCount);
+
+		if (NULL != slots) {
+			for (UDATA i = 0; i < slotCount; i++) {
+				if (slots[i].itemOffset < coveredOffset) {
+					coveredOffset = slots[i].itemOffset;
+				}
+			}
+			sectionSlots[sectionCount] = slots;
+			sectionSlotCounts[sectionCount] = slotCount;
+			sectionTypes[sectionCount] = walkManager->getDataTypeRepresented();
+			sectionCount += 1;
+			totalSlots += slotCount;
+		}
+		walkManager = managers()->nextDo(&state);
+	}
+
+	/* Every index in the chain is attached separately at startup, so do not store very small ones */
+	if (totalSlots >= LOOKUPINDEX_MIN_NEW_ITEMS) {
+		UDATA indexLength = sizeof(LookupIndexHeader) + (sectionCount * sizeof(LookupIndexSection)) + (totalSlots * sizeof(LookupIndexSlot));
+		U_8* buffer = (U_8*)j9mem_allocate_memory(indexLength, J9MEM_CATEGORY_CLASSES);
+		SH_ByteDataManager* localBDM = getByteDataManager(currentThread);
+
+		if ((NULL != buffer) && (NULL != localBDM)) {
+			LookupIndexHeader* header = (LookupIndexHeader*)buffer;
+			LookupIndexSection* section = LOOKUPINDEX_SECTIONS(header);
+			U_32 slotsOffset = (U_32)(sizeof(LookupIndexHeader) + (sectionCount * sizeof(LookupIndexSection)));
+			J9SharedDataDescriptor data;
+			const U_8* stored = NULL;
+
+			header->magic = LOOKUPINDEX_MAGIC;
+			header->version = LOOKUPINDEX_VERSION;
+			header->sectionCount = (U_32)sectionCount;
+			header->totalLength = (U_32)indexLength;
+			header->coveredOffset = coveredOffset;
+			header->previousIndexOffset = previousIndexOffset;
+			for (UDATA i = 0; i < sectionCount; i++, section++) {
+				section->itemType = (U_32)sectionTypes[i];
+				section->slotCount = (U_32)sectionSlotCounts[i];
+				section->slotsOffset = slotsOffset;
+				section->padding = 0;
+				memcpy(buffer + slotsOffset, sectionSlots[i], sectionSlotCounts[i] * sizeof(LookupIndexSlot));
+				slotsOffset += (U_32)(sectionSlotCounts[i] * sizeof(LookupIndexSlot));
+			}
+
+			memset(&data, 0, sizeof(J9SharedDataDescriptor));
+			data.address = buffer;
+			data.length = indexLength;
+			data.type = J9SHR_DATA_TYPE_UNKNOWN;
+			data.flags = J9SHRDATA_NOT_INDEXED;
+			stored = (const U_8*)addByteDataToCache(currentThread, localBDM, NULL, &data, cache, false);
+			if (NULL != stored) {
+				cache->setLookupIndex(currentThread, (const LookupIndexHeader*)stored);
+				_lookupIndexSlotsStored = totalSlots;
+			}
+		}
+		j9mem_free_memory(buffer);
+	}
+
+	for (UDATA i = 0; i < sectionCount; i++) {
+		j9mem_free_memory(sectionSlots[i]);
+	}
+	cache->exitWriteMutex(currentThread, fnName);
 }
 
 /**
@@ -5307,6 +5596,8 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_Managers::ManagerWalkState state;
 	SH_CompositeCacheImpl* cache = _ccHead;
 
+	storeLookupIndex(currentThread);
+
 	printShutdownStats();
 
 	walkManager = managers()->startDo(currentThread, 0, &state);
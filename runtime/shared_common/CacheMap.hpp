@@ -321,6 +321,7 @@ private:
 
 	UDATA _verboseFlags;
 	UDATA _bytesRead;
+	UDATA _lookupIndexSlotsStored;
 	U_32 _actualSize;
 	J9Pool* _ccPool;
 	int32_t _metadataReleaseCounter;
@@ -402,6 +403,12 @@ private:
 
 	SH_ByteDataManager* getByteDataManager(J9VMThread* currentThread);
 
+	void storeLookupIndex(J9VMThread* currentThread);
+
+	void validateClasspathTimestamps(J9VMThread* currentThread);
+
+	bool hashImageManifest(J9VMThread* currentThread, const char* manifest, U_64* hash);
+
 	SH_CompiledMethodManager* getCompiledMethodManager(J9VMThread* currentThread);
 
 	SH_AttachedDataManager* getAttachedDataManager(J9VMThread* currentThread);
@@ -58,6 +58,8 @@ public:
 	virtual bool touchForClassFiles(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathItem* cp, I_16 toIndex) = 0;
 
 	virtual void getNumItemsByType(UDATA* numClasspaths, UDATA* numURLs, UDATA* numTokens) = 0;
+
+	virtual UDATA collectTimestampCandidates(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA maxCount) = 0;
 };
 
 #endif /* !defined(CLASSPATHMANAGER_HPP_INCLUDED) */
@@ -1441,3 +1441,60 @@ SH_ClasspathManagerImpl2::getNumItemsByType(UDATA* numClasspaths, UDATA* numURLs
 	*numURLs = _urlCount;
 	*numTokens = _tokenCount;
 }
+
+/**
+ * Collects the jar and jimage entries of all non-stale classpaths known to the manager,
+ * so that their timestamps can be checked in one batch.
+ *
+ * @see ClasspathManager.hpp
+ * @param[in] currentThread The current thread
+ * @param[out] cpeis Array to receive the entries, or NULL to only count them
+ * @param[in] maxCount Size of cpeis
+ *
+ * @return The number of entries found, which may be larger than maxCount
+ */
+UDATA
+SH_ClasspathManagerImpl2::collectTimestampCandidates(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA maxCount)
+{
+	TimestampCandidateData data;
+
+	data.cpeis = cpeis;
+	data.maxCount = (NULL == cpeis) ? 0 : maxCount;
+	data.count = 0;
+
+	if ((MANAGER_STATE_STARTED == getState()) && lockHashTable(currentThread, "collectTimestampCandidates")) {
+		hashTableForEachDo(_hashTable, cpeCollectTimestampCandidates, &data);
+		unlockHashTable(currentThread, "collectTimestampCandidates");
+	}
+	return data.count;
+}
+
+/* hashTableForEachDo() callback which records the entry at each link whose classpath is not stale at that entry */
+UDATA
+SH_ClasspathManagerImpl2::cpeCollectTimestampCandidates(void* entry, void* userData)
+{
+	CpLinkedListHdr* header = (CpLinkedListHdr*)entry;
+	TimestampCandidateData* data = (TimestampCandidateData*)userData;
+	CpLinkedListImpl* walk = header->_list;
+
+	if (header->_isToken || (NULL == walk)) {
+		return 0;
+	}
+	do {
+		ClasspathWrapper* cpw = (ClasspathWrapper*)ITEMDATA(walk->_item);
+		I_16 cpeIndex = CpLinkedListImpl::getCPEIndex(walk);
+
+		if (cpeIndex < cpw->staleFromIndex) {
+			ClasspathEntryItem* cpei = ((ClasspathItem*)CPWDATA(cpw))->itemAt(cpeIndex);
+
+			if ((PROTO_JAR == cpei->protocol) || (PROTO_JIMAGE == cpei->protocol)) {
+				if (data->count < data->maxCount) {
+					data->cpeis[data->count] = cpei;
+				}
+				data->count += 1;
+			}
+		}
+		walk = (CpLinkedListImpl*)walk->_next;
+	} while (walk != header->_list);
+	return 0;
+}
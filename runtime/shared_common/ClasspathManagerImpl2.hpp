@@ -72,6 +72,8 @@ public:
 
 	virtual void getNumItemsByType(UDATA* numClasspaths, UDATA* numURLs, UDATA* numTokens);
 
+	virtual UDATA collectTimestampCandidates(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA maxCount);
+
 	void runExitCode(void) {};	
 
 protected:
@@ -158,6 +160,14 @@ class CpLinkedListImpl : public SH_Manager::LinkedListImpl
 
 	CpLinkedListImpl* cpeTableUpdate(J9VMThread* currentThread, const char* name, U_16 nameLen, I_16 CPEIndex, const ShcItem* item, U_8 isToken, bool doTag, SH_CompositeCache* cachelet);
 	
+	typedef struct TimestampCandidateData {
+		ClasspathEntryItem** cpeis;
+		UDATA maxCount;
+		UDATA count;
+	} TimestampCandidateData;
+
+	static UDATA cpeCollectTimestampCandidates(void* entry, void* userData);
+
 	static UDATA cpeCollectHashOfEntry(void* entry, void* userData);
 	static UDATA cpeCountCacheletHashes(void* entry, void* userData);
 	IDATA cpeCollectHashes(J9VMThread* currentThread, SH_CompositeCache* cachelet, CacheletHints* hints);
@@ -159,6 +159,7 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
 	ca->extraStartupHints = DEFAULT_STARTUPHINTS;
+	ca->lookupIndexSRP = 0;
 	ca->unused8 = 0;
 	ca->unused9 = 0;
 	ca->unused10 = 0;
@@ -6814,3 +6815,92 @@ SH_CompositeCacheImpl::setExtraStartupHints(J9VMThread* currentThread, U_32 val)
 	protectHeaderReadWriteArea(currentThread, false);
 	Trc_SHR_CC_setExtraStartupHints_Event(currentThread, val);
 }
+
+/**
+ * Return the lookup index recorded in the cache header, or NULL if there is none
+ * or the recorded index does not look sane.
+ */
+const LookupIndexHeader*
+SH_CompositeCacheImpl::getLookupIndex(void) const
+{
+	if (!_started) {
+		return NULL;
+	}
+	return getLookupIndexAt(_theca->lookupIndexSRP);
+}
+
+/**
+ * Return the lookup index stored before the given one, or NULL at the end of the chain.
+ * Byte data is allocated downwards, so an older index is always at a higher offset.
+ */
+const LookupIndexHeader*
+SH_CompositeCacheImpl::getPreviousLookupIndex(const LookupIndexHeader* index) const
+{
+	UDATA offset = (UDATA)((U_8*)index - (U_8*)_theca);
+
+	if (index->previousIndexOffset <= offset) {
+		return NULL;
+	}
+	return getLookupIndexAt(index->previousIndexOffset);
+}
+
+/**
+ * Return the lookup index at the given offset from the cache header, or NULL if it does not look sane.
+ */
+const LookupIndexHeader*
+SH_CompositeCacheImpl::getLookupIndexAt(UDATA offset) const
+{
+	const LookupIndexHeader* index = NULL;
+
+	if ((0 != offset) && ((offset + sizeof(LookupIndexHeader)) <= _theca->totalBytes)) {
+		index = (const LookupIndexHeader*)(((U_8*)_theca) + offset);
+		if ((LOOKUPINDEX_MAGIC != index->magic)
+			|| (LOOKUPINDEX_VERSION != index->version)
+			|| ((offset + index->totalLength) > _theca->totalBytes)
+			|| ((sizeof(LookupIndexHeader) + (index->sectionCount * sizeof(LookupIndexSection))) > index->totalLength)
+			|| (index->coveredOffset >= _theca->totalBytes)
+		) {
+			index = NULL;
+		}
+	}
+	return index;
+}
+
+/**
+ * Record a newly stored lookup index in the cache header.
+ * THREADING: Must hold the cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	if (_readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+	unprotectHeaderReadWriteArea(currentThread, false);
+	_theca->lookupIndexSRP = (NULL == index) ? 0 : (UDATA)((U_8*)index - (U_8*)_theca);
+	protectHeaderReadWriteArea(currentThread, false);
+}
+
+/**
+ * Return true once nextEntry() has returned at least one item from this cache
+ */
+bool
+SH_CompositeCacheImpl::hasReadEntries(void) const
+{
+	return (_started && (_scan != (ShcItemHdr*)CCFIRSTENTRY(_theca)));
+}
+
+/**
+ * Return true if any thread in this JVM currently holds the cache write mutex
+ */
+bool
+SH_CompositeCacheImpl::isWriteMutexOwned(void) const
+{
+	return (NULL != _commonCCInfo->hasWriteMutexThread);
+}
@@ -401,6 +401,16 @@ public:
 
 	void setExtraStartupHints(J9VMThread* currentThread, U_32 val);
 
+	const LookupIndexHeader* getLookupIndex(void) const;
+
+	const LookupIndexHeader* getPreviousLookupIndex(const LookupIndexHeader* index) const;
+
+	void setLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index);
+
+	bool hasReadEntries(void) const;
+
+	bool isWriteMutexOwned(void) const;
+
 private:
 	J9SharedClassConfig* _sharedClassConfig;
 	SH_OSCache* _oscache;
@@ -509,6 +519,8 @@ private:
 	void incReaderCount(J9VMThread* currentThread);
 	void decReaderCount(J9VMThread* currentThread);
 
+	const LookupIndexHeader* getLookupIndexAt(UDATA offset) const;
+
 	void initialize(J9JavaVM* vm, BlockPtr memForConstructor, J9SharedClassConfig* sharedClassConfig, const char* cacheName, I_32 cacheTypeRequired, bool startupForStats, I_8 layer);
 	void initializeWithCommonInfo(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, BlockPtr memForConstructor, const char* cacheName, I_32 newPersistentCacheReqd, bool startupForStats, I_8 layer);
 	void initCommonCCInfoHelper();
@@ -45,7 +45,10 @@ SH_Manager::SH_Manager()
    _htEntries(0),
    _runtimeFlagsPtr(0),
    _verboseFlags(0),
-   _state(0)
+   _state(0),
+   _lookupIndexes(NULL),
+   _materializingLookupIndex(false),
+   _lookupIndexItemsMaterialized(0)
 {
 }
 
@@ -268,6 +271,7 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 
 	if ((_state == MANAGER_STATE_STARTED) || (_state == MANAGER_STATE_STARTING)) {
 		if (!_htMutex || (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup")==0)) {
+			freeLookupIndexes();
 			tearDownHashTable(currentThread);
 			localPostCleanup(currentThread);
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup");
@@ -302,6 +306,7 @@ SH_Manager::reset(J9VMThread* currentThread)
 
 	if (_state == MANAGER_STATE_STARTED) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "_htMutex", "reset")==0) {
+			freeLookupIndexes();
 			tearDownHashTable(currentThread);
 			if (initializeHashTable(currentThread) == -1) {
 				returnVal = -1;
@@ -374,6 +379,11 @@ SH_Manager::hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd")==0) {
 			HashLinkedListImpl** rc;
 
+			/* Items for this key which are still only in a lookup index are older than the new item, so add them first */
+			if ((NULL != _lookupIndexes) && !_materializingLookupIndex) {
+				materializeLookupIndex(currentThread, generateHash(currentThread->javaVM->internalVMFunctions, newItem->_key, newItem->_keySize));
+			}
+
 			/* This call will not actually add the new item if there is already an entry of the same key in the hashtable. Instead, the value returned
 				by hashTableAdd is passed back as the addToList parameter. The value returned by this function should then be linked to addToList */
 			if ((rc = (HashLinkedListImpl**)hashTableAdd(_hashTable, &newItem))==NULL) {
@@ -411,6 +421,11 @@ SH_Manager::hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nam
 	Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
 	if (lockHashTable(currentThread, "hllTableLookup")) {
+		/* The key may already be in the hashtable from a layer read without an index, so a hit does not
+		 * mean that the indexed items for the key have been added: add them before every lookup. */
+		if ((NULL != _lookupIndexes) && !_materializingLookupIndex) {
+			materializeLookupIndex(currentThread, generateHash(currentThread->javaVM->internalVMFunctions, (U_8*)name, nameLen));
+		}
 		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
 		unlockHashTable(currentThread, "hllTableLookup");
 	} else {
@@ -569,6 +584,9 @@ SH_Manager::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA*
 
 		/* WARNING - currentThread can be NULL */
 		if (lockHashTable(currentThread, "getNumItems")) {
+			if (NULL != currentThread) {
+				materializeAllLookupIndexes(currentThread);
+			}
 			hashTableForEachDo(_hashTable, _hashTableGetNumItemsDoFn, &countData);
 			unlockHashTable(currentThread, "getNumItems");
 		}
@@ -609,3 +627,286 @@ SH_Manager::isDataTypeRepresended(UDATA type)
 	return false;
 }
 
+/**
+ * Attach the sections of a chain of persisted lookup indexes which describe this manager's items in a cache.
+ * Items covered by the chain are not passed to storeNew() when the cache is read. Instead, all items sharing
+ * a hash value are added together before hllTableLookup() looks up that hash, or before hllTableAdd() adds a
+ * newer item with that hash. Sections are kept oldest first, and cache layers are read lowest first, so
+ * items with the same hash are always added in cache order.
+ *
+ * THREADING: Called from SH_CacheMap::readCache() before any item in the cache has been read
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache layer the index belongs to
+ * @param[in] index The most recent lookup index recorded in the cache header
+ *
+ * @return true if the chain has a usable section for this manager
+ */
+bool
+SH_Manager::attachLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader* index)
+{
+	LookupIndexRef* refs = NULL;
+	LookupIndexRef* ref = NULL;
+	LookupIndexRef** insertAt = NULL;
+	U_8* cacheBase = (U_8*)cache->getCacheHeaderAddress();
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (!usesLookupIndex() || (getState() != MANAGER_STATE_STARTED)) {
+		return false;
+	}
+	for (ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		if (ref->_cache == cache) {
+			return true;
+		}
+	}
+
+	/* Each index covers the items below the previous one, so the chain must be attached completely or not at all */
+	for (const LookupIndexHeader* walk = index; NULL != walk; walk = cache->getPreviousLookupIndex(walk)) {
+		const LookupIndexSection* section = LOOKUPINDEX_SECTIONS(walk);
+
+		for (U_32 i = 0; i < walk->sectionCount; i++, section++) {
+			if (section->itemType == _dataTypesRepresented[0]) {
+				UDATA bitmapBytes = (section->slotCount + 7) / 8;
+
+				if (((UDATA)section->slotsOffset + ((UDATA)section->slotCount * sizeof(LookupIndexSlot))) > walk->totalLength) {
+					ref = NULL;
+				} else {
+					ref = (LookupIndexRef*)j9mem_allocate_memory(sizeof(LookupIndexRef) + bitmapBytes, J9MEM_CATEGORY_CLASSES);
+				}
+				if (NULL == ref) {
+					while (NULL != refs) {
+						ref = refs->_next;
+						j9mem_free_memory(refs);
+						refs = ref;
+					}
+					return false;
+				}
+				ref->_cache = cache;
+				ref->_cacheBase = cacheBase;
+				ref->_coveredItems = cacheBase + index->coveredOffset;
+				ref->_index = walk;
+				ref->_section = section;
+				ref->_materialized = (U_8*)(ref + 1);
+				memset(ref->_materialized, 0, bitmapBytes);
+				/* The chain is walked newest first */
+				ref->_next = refs;
+				refs = ref;
+				break;
+			}
+		}
+	}
+	if (NULL == refs) {
+		return false;
+	}
+
+	if (!lockHashTable(currentThread, "attachLookupIndex")) {
+		while (NULL != refs) {
+			ref = refs->_next;
+			j9mem_free_memory(refs);
+			refs = ref;
+		}
+		return false;
+	}
+	insertAt = &_lookupIndexes;
+	while (NULL != *insertAt) {
+		insertAt = &(*insertAt)->_next;
+	}
+	*insertAt = refs;
+	unlockHashTable(currentThread, "attachLookupIndex");
+	return true;
+}
+
+/**
+ * Return true if the item is described by the lookup index chain attached for its cache, in which case
+ * it must not be passed to storeNew() when the cache is read.
+ */
+bool
+SH_Manager::isCoveredByLookupIndex(SH_CompositeCacheImpl* cache, const ShcItem* item)
+{
+	for (LookupIndexRef* ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		if (ref->_cache == cache) {
+			return ((const U_8*)item >= ref->_coveredItems);
+		}
+	}
+	return false;
+}
+
+/**
+ * Pass every not yet materialized item with the given hash value to storeNew(), in cache order.
+ * Hash collisions are materialized together, so a key that is present in the hashtable always
+ * has all of its indexed items present as well.
+ *
+ * THREADING: Must be called with the hashtable mutex held. The mutex is reentrant, so storeNew() may take it again.
+ */
+void
+SH_Manager::materializeLookupIndex(J9VMThread* currentThread, UDATA hashValue)
+{
+	U_32 hash = (U_32)hashValue;
+
+	_materializingLookupIndex = true;
+	for (LookupIndexRef* ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		const LookupIndexSlot* slots = LOOKUPINDEX_SLOTS(ref->_index, ref->_section);
+		UDATA slotCount = ref->_section->slotCount;
+		UDATA low = 0;
+		UDATA high = slotCount;
+
+		while (low < high) {
+			UDATA mid = low + ((high - low) / 2);
+			if (slots[mid].hash < hash) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+		for (UDATA i = low; (i < slotCount) && (slots[i].hash == hash); i++) {
+			U_8 bit = (U_8)(1 << (i & 7));
+
+			if (0 == (ref->_materialized[i >> 3] & bit)) {
+				ref->_materialized[i >> 3] |= bit;
+				if (storeNew(currentThread, (const ShcItem*)(ref->_cacheBase + slots[i].itemOffset), ref->_cache)) {
+					_lookupIndexItemsMaterialized += 1;
+				}
+			}
+		}
+	}
+	_materializingLookupIndex = false;
+}
+
+/**
+ * Materialize every remaining indexed item, for callers which walk the whole hashtable.
+ * THREADING: Must be called with the hashtable mutex held
+ */
+void
+SH_Manager::materializeAllLookupIndexes(J9VMThread* currentThread)
+{
+	if (_materializingLookupIndex) {
+		return;
+	}
+	_materializingLookupIndex = true;
+	for (LookupIndexRef* ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		const LookupIndexSlot* slots = LOOKUPINDEX_SLOTS(ref->_index, ref->_section);
+
+		for (UDATA i = 0; i < ref->_section->slotCount; i++) {
+			U_8 bit = (U_8)(1 << (i & 7));
+
+			if (0 == (ref->_materialized[i >> 3] & bit)) {
+				ref->_materialized[i >> 3] |= bit;
+				if (storeNew(currentThread, (const ShcItem*)(ref->_cacheBase + slots[i].itemOffset), ref->_cache)) {
+					_lookupIndexItemsMaterialized += 1;
+				}
+			}
+		}
+	}
+	_materializingLookupIndex = false;
+}
+
+/* THREADING: Must be protected by hashtable mutex */
+void
+SH_Manager::freeLookupIndexes(void)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	while (NULL != _lookupIndexes) {
+		LookupIndexRef* next = _lookupIndexes->_next;
+		j9mem_free_memory(_lookupIndexes);
+		_lookupIndexes = next;
+	}
+}
+
+/* hashTableForEachDo() callback which records a slot for each link whose item is in the cache being indexed and not yet covered */
+UDATA
+SH_Manager::collectLinkSlots(void* entry, void* opaque)
+{
+	HashLinkedListImpl* head = *(HashLinkedListImpl**)entry;
+	HashLinkedListImpl* walk = head;
+	LookupIndexCollectData* data = (LookupIndexCollectData*)opaque;
+
+	do {
+		if (data->_cache->isAddressInCache(walk->_item, false)) {
+			U_32 itemOffset = (U_32)((U_8*)walk->_item - data->_cacheBase);
+
+			if (itemOffset < data->_coveredOffset) {
+				if (NULL != data->_slots) {
+					UDATA hashValue = walk->_hashValue;
+
+					if (0 == hashValue) {
+						hashValue = generateHash(data->_internalFunctionTable, walk->_key, walk->_keySize);
+					}
+					data->_slots[data->_slotCount].hash = (U_32)hashValue;
+					data->_slots[data->_slotCount].itemOffset = itemOffset;
+				}
+				data->_slotCount += 1;
+			}
+		}
+		walk = (HashLinkedListImpl*)walk->_next;
+	} while (walk != head);
+	return 0;
+}
+
+/* Order slots by hash, then in cache order. Items are allocated downwards, so older items have higher offsets. */
+int
+SH_Manager::compareLookupIndexSlots(const void* left, const void* right)
+{
+	const LookupIndexSlot* leftSlot = (const LookupIndexSlot*)left;
+	const LookupIndexSlot* rightSlot = (const LookupIndexSlot*)right;
+
+	if (leftSlot->hash != rightSlot->hash) {
+		return (leftSlot->hash < rightSlot->hash) ? -1 : 1;
+	}
+	if (leftSlot->itemOffset != rightSlot->itemOffset) {
+		return (leftSlot->itemOffset > rightSlot->itemOffset) ? -1 : 1;
+	}
+	return 0;
+}
+
+/**
+ * Build the sorted slot array for a new lookup index section for this manager. The new section describes
+ * every item of this manager in the hashtable that is below the items covered by the current index chain.
+ * Items covered by the chain are left to the older indexes, whether or not they have been materialized.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache layer being indexed
+ * @param[in] coveredOffset The lowest item offset covered by the current index chain, U_32_MAX if none
+ * @param[out] slotCount The number of slots returned
+ *
+ * @return A slot array which the caller must free, or NULL if there is nothing to index or memory is short
+ */
+LookupIndexSlot*
+SH_Manager::collectLookupIndexSlots(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, U_32 coveredOffset, UDATA* slotCount)
+{
+	LookupIndexCollectData data;
+	UDATA linkCount = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	*slotCount = 0;
+	if (!usesLookupIndex() || (getState() != MANAGER_STATE_STARTED) || (NULL == _hashTable)) {
+		return NULL;
+	}
+
+	data._cache = cache;
+	data._cacheBase = (U_8*)cache->getCacheHeaderAddress();
+	data._internalFunctionTable = currentThread->javaVM->internalVMFunctions;
+	data._slots = NULL;
+	data._slotCount = 0;
+	data._coveredOffset = coveredOffset;
+
+	if (!lockHashTable(currentThread, "collectLookupIndexSlots")) {
+		return NULL;
+	}
+	hashTableForEachDo(_hashTable, SH_Manager::collectLinkSlots, &data);
+	linkCount = data._slotCount;
+	if (linkCount > 0) {
+		data._slots = (LookupIndexSlot*)j9mem_allocate_memory(linkCount * sizeof(LookupIndexSlot), J9MEM_CATEGORY_CLASSES);
+	}
+	if (NULL != data._slots) {
+		data._slotCount = 0;
+		hashTableForEachDo(_hashTable, SH_Manager::collectLinkSlots, &data);
+	}
+	unlockHashTable(currentThread, "collectLookupIndexSlots");
+
+	if (NULL != data._slots) {
+		J9_SORT(data._slots, data._slotCount, sizeof(LookupIndexSlot), SH_Manager::compareLookupIndexSlots);
+		*slotCount = data._slotCount;
+	}
+	return data._slots;
+}
@@ -149,6 +149,20 @@ public:
 
 	bool isDataTypeRepresended(UDATA type);
 
+	/* Managers which return true can have the items they index served from a lookup index persisted in the cache,
+	 * rather than rebuilding their hashtable from every item at startup */
+	virtual bool usesLookupIndex(void) { return false; }
+
+	bool attachLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader* index);
+
+	LookupIndexSlot* collectLookupIndexSlots(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, U_32 coveredOffset, UDATA* slotCount);
+
+	bool isCoveredByLookupIndex(SH_CompositeCacheImpl* cache, const ShcItem* item);
+
+	UDATA getLookupIndexItemsMaterialized(void) { return _lookupIndexItemsMaterialized; }
+
+	UDATA getDataTypeRepresented(void) { return _dataTypesRepresented[0]; }
+
 protected:
 	J9HashTable* _hashTable;
 	SH_SharedCache* _cache;
@@ -211,7 +225,39 @@ protected:
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
 private:
+	/**
+	 * A lookup index section attached from one index in the chain of a cache layer. _materialized has
+	 * one bit per slot, set once the slot's item has been passed to storeNew(). _coveredItems is the
+	 * lowest item address covered by the whole chain.
+	 */
+	class LookupIndexRef
+	{
+	public:
+		SH_CompositeCacheImpl* _cache;
+		U_8* _cacheBase;
+		U_8* _coveredItems;
+		const LookupIndexHeader* _index;
+		const LookupIndexSection* _section;
+		U_8* _materialized;
+		LookupIndexRef* _next;
+	};
+
+	/* State passed to collectLinkSlots() by collectLookupIndexSlots() */
+	class LookupIndexCollectData
+	{
+	public:
+		SH_CompositeCacheImpl* _cache;
+		U_8* _cacheBase;
+		J9InternalVMFunctions* _internalFunctionTable;
+		LookupIndexSlot* _slots;
+		UDATA _slotCount;
+		U_32 _coveredOffset;
+	};
+
 	UDATA _state;
+	LookupIndexRef* _lookupIndexes;
+	bool _materializingLookupIndex;
+	UDATA _lookupIndexItemsMaterialized;
 
 	const char* _managerType;
 
@@ -224,6 +270,16 @@ private:
 
 	static UDATA countItemsInList(void* node, void* countData);
 
+	void materializeLookupIndex(J9VMThread* currentThread, UDATA hashValue);
+
+	void materializeAllLookupIndexes(J9VMThread* currentThread);
+
+	void freeLookupIndexes(void);
+
+	static UDATA collectLinkSlots(void* entry, void* opaque);
+
+	static int compareLookupIndexSlots(const void* left, const void* right);
+
 	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
 };
 
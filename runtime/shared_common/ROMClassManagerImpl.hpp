@@ -69,6 +69,8 @@ public:
 
 	void runExitCode(void) {};	
 
+	virtual bool usesLookupIndex(void) { return true; }
+
 protected:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
 
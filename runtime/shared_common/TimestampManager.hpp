@@ -73,6 +73,32 @@ public:
 	 * 					(Contains the current timestamp)
 	 */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper) = 0;
+
+	/*
+	 * Reads the timestamps of a batch of jar and jimage classpath entries up front.
+	 * Each distinct path is read once, spread over up to threadCount threads.
+	 * For windowMillis after the batch completes, checkCPEITimeStamp() answers for
+	 * these paths from the batch rather than reading the file system again.
+	 * Returns the number of distinct paths read.
+	 *
+	 * Parameters:
+	 *   cpeis			Classpath entries to read. Other protocols are ignored.
+	 *   count			Number of entries in cpeis
+	 *   threadCount	Maximum number of threads to use, including the current thread
+	 *   windowMillis	How long the batch results remain valid
+	 */
+	virtual UDATA prefetchTimeStamps(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA count, UDATA threadCount, U_64 windowMillis) = 0;
+
+	/*
+	 * Jar and jimage classpath entries stored in [start, end) are known to be unchanged
+	 * and are not timestamp checked. Directory entries and individual classes are still checked.
+	 */
+	virtual void setTrustedRange(const void* start, const void* end) = 0;
+
+	/*
+	 * Frees any batch results. Must only be called when no other thread is checking timestamps.
+	 */
+	virtual void cleanup(J9VMThread* currentThread) = 0;
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
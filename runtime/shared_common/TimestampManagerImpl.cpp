@@ -32,6 +32,11 @@ SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memF
 
 	new(newTSM) SH_TimestampManagerImpl();
 	newTSM->_sharedClassConfig = sharedClassConfig;
+	newTSM->_batchEntries = NULL;
+	newTSM->_batchCount = 0;
+	newTSM->_batchExpiryMillis = 0;
+	newTSM->_trustedStart = NULL;
+	newTSM->_trustedEnd = NULL;
 
 	return newTSM;
 }
@@ -54,6 +59,203 @@ SH_TimestampManagerImpl::checkROMClassTimeStamp(J9VMThread* currentThread, const
 	return localCheckTimeStamp(currentThread, cpei, className, classNameLen, rcWrapper);	
 }
 
+UDATA
+SH_TimestampManagerImpl::prefetchTimeStamps(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA count, UDATA threadCount, U_64 windowMillis)
+{
+	BatchEntry* entries = NULL;
+	UDATA unique = 0;
+	BatchWork work;
+
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	if (NULL != _batchEntries) {
+		/* Only one batch is read at startup */
+		return 0;
+	}
+	if (0 == count) {
+		return 0;
+	}
+	entries = (BatchEntry*)j9mem_allocate_memory(count * sizeof(BatchEntry), J9MEM_CATEGORY_CLASSES);
+	if (NULL == entries) {
+		return 0;
+	}
+	for (UDATA i = 0; i < count; i++) {
+		ClasspathEntryItem* cpei = cpeis[i];
+
+		if (((PROTO_JAR == cpei->protocol) || (PROTO_JIMAGE == cpei->protocol))
+			&& !((cpei >= _trustedStart) && (cpei < _trustedEnd))
+		) {
+			entries[unique].location = cpei->getLocation(&entries[unique].locationLen);
+			entries[unique].cpei = cpei;
+			entries[unique].path = NULL;
+			entries[unique].lastModified = -1;
+			unique += 1;
+		}
+	}
+
+	/* The same jar is usually found in several classpaths, only read it once */
+	J9_SORT(entries, unique, sizeof(BatchEntry), compareBatchEntries);
+	count = unique;
+	unique = 0;
+	for (UDATA i = 0; i < count; i++) {
+		if ((0 == unique) || (0 != compareBatchEntries(&entries[unique - 1], &entries[i]))) {
+			bool doFreeBuffer = false;
+
+			entries[unique] = entries[i];
+			/* A zero-sized buffer makes createPathString() allocate the path, which is freed by cleanup() */
+			SH_CacheMap::createPathString(currentThread, _sharedClassConfig, &entries[unique].path, 0, entries[unique].cpei, NULL, 0, &doFreeBuffer);
+			unique += 1;
+		}
+	}
+
+	work.portLibrary = PORTLIB;
+	work.monitor = NULL;
+	work.entries = entries;
+	work.count = unique;
+	work.next = 0;
+	work.threadsAlive = 0;
+
+	if ((threadCount > 1) && (unique > 1) && (0 == omrthread_monitor_init(&work.monitor, 0))) {
+		if (threadCount > unique) {
+			threadCount = unique;
+		}
+		omrthread_monitor_enter(work.monitor);
+		for (UDATA i = 1; i < threadCount; i++) {
+			omrthread_t thread = NULL;
+			if (0 != omrthread_create(&thread, currentThread->javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, batchThreadProc, &work)) {
+				break;
+			}
+			work.threadsAlive += 1;
+		}
+		omrthread_monitor_exit(work.monitor);
+	}
+
+	/* The current thread takes its share of the batch, then waits for the helpers */
+	readBatch(&work);
+	if (NULL != work.monitor) {
+		omrthread_monitor_enter(work.monitor);
+		while (0 != work.threadsAlive) {
+			omrthread_monitor_wait(work.monitor);
+		}
+		omrthread_monitor_exit(work.monitor);
+		omrthread_monitor_destroy(work.monitor);
+	}
+
+	_batchEntries = entries;
+	_batchCount = unique;
+	_batchExpiryMillis = j9time_current_time_millis() + (I_64)windowMillis;
+	return unique;
+}
+
+void
+SH_TimestampManagerImpl::setTrustedRange(const void* start, const void* end)
+{
+	_trustedStart = start;
+	_trustedEnd = end;
+}
+
+void
+SH_TimestampManagerImpl::cleanup(J9VMThread* currentThread)
+{
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	if (NULL != _batchEntries) {
+		for (UDATA i = 0; i < _batchCount; i++) {
+			if (NULL != _batchEntries[i].path) {
+				j9mem_free_memory(_batchEntries[i].path);
+			}
+		}
+		j9mem_free_memory(_batchEntries);
+		_batchEntries = NULL;
+		_batchCount = 0;
+	}
+	_trustedStart = NULL;
+	_trustedEnd = NULL;
+}
+
+/* Order batch entries by location length, then by location */
+int
+SH_TimestampManagerImpl::compareBatchEntries(const void* left, const void* right)
+{
+	const BatchEntry* leftEntry = (const BatchEntry*)left;
+	const BatchEntry* rightEntry = (const BatchEntry*)right;
+
+	if (leftEntry->locationLen != rightEntry->locationLen) {
+		return (leftEntry->locationLen < rightEntry->locationLen) ? -1 : 1;
+	}
+	return memcmp(leftEntry->location, rightEntry->location, leftEntry->locationLen);
+}
+
+int J9THREAD_PROC
+SH_TimestampManagerImpl::batchThreadProc(void* entryArg)
+{
+	BatchWork* work = (BatchWork*)entryArg;
+
+	readBatch(work);
+
+	omrthread_monitor_enter(work->monitor);
+	work->threadsAlive -= 1;
+	omrthread_monitor_notify_all(work->monitor);
+	omrthread_exit(work->monitor);
+	return 0;
+}
+
+/* Reads entries from the batch until there are none left. Called by the helper threads and the requesting thread. */
+void
+SH_TimestampManagerImpl::readBatch(BatchWork* work)
+{
+	PORT_ACCESS_FROM_PORT(work->portLibrary);
+
+	for (;;) {
+		UDATA index = 0;
+
+		if (NULL != work->monitor) {
+			omrthread_monitor_enter(work->monitor);
+		}
+		index = work->next;
+		work->next += 1;
+		if (NULL != work->monitor) {
+			omrthread_monitor_exit(work->monitor);
+		}
+		if (index >= work->count) {
+			break;
+		}
+		if (NULL != work->entries[index].path) {
+			work->entries[index].lastModified = j9file_lastmod(work->entries[index].path);
+		}
+	}
+}
+
+/* Returns true and the batched timestamp if cpei was read by prefetchTimeStamps() and the batch has not expired */
+bool
+SH_TimestampManagerImpl::findBatchTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64* lastModified)
+{
+	BatchEntry key;
+	UDATA low = 0;
+	UDATA high = _batchCount;
+
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	if ((NULL == _batchEntries) || (j9time_current_time_millis() >= _batchExpiryMillis)) {
+		return false;
+	}
+	key.location = cpei->getLocation(&key.locationLen);
+	while (low < high) {
+		UDATA mid = low + ((high - low) / 2);
+		int cmp = compareBatchEntries(&_batchEntries[mid], &key);
+
+		if (0 == cmp) {
+			*lastModified = _batchEntries[mid].lastModified;
+			return true;
+		} else if (cmp < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return false;
+}
+
 /* Returns TIMESTAMP_UNCHANGED, TIMESTAMP_DOES_NOT_EXIST, TIMESTAMP_DISAPPEARED or an actual timestamp.
  * Should ONLY be called to timestamp against cpitems held in cache, not locally
  * Note: If classname is added, specific classfile is timestamp checked */
@@ -67,7 +269,18 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	bool doFreeBuffer = false;
 
 	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
-	
+
+	if (cpei->protocol!=PROTO_DIR) {
+		if ((cpei >= _trustedStart) && (cpei < _trustedEnd)) {
+			/* Validated against the image manifest, see SH_CacheMap::validateClasspathTimestamps() */
+			return TIMESTAMP_UNCHANGED;
+		}
+		if (findBatchTimeStamp(currentThread, cpei, &current)) {
+			Trc_SHR_TMI_LocalCheckTimestamp_Timestamps(currentThread, current, test);
+			return compareTimeStamps(current, test);
+		}
+	}
+
 	if (cpei->protocol==PROTO_DIR) {
 		/* If stack buffer not big enough, doFreeBuffer is set to true */
 		SH_CacheMap::createPathString(currentThread, _sharedClassConfig, &pathBufPtr, SHARE_PATHBUF_SIZE, cpei, className, classNameLen, &doFreeBuffer);
@@ -90,6 +303,12 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 		j9mem_free_memory(pathBufPtr);
 	}
 	Trc_SHR_TMI_LocalCheckTimestamp_Timestamps(currentThread, current, test);
+	return compareTimeStamps(current, test);
+}
+
+I_64
+SH_TimestampManagerImpl::compareTimeStamps(I_64 current, I_64 test)
+{
 	if (current == -1) {
 		if (test == -1) {
 			return TIMESTAMP_DOES_NOT_EXIST;
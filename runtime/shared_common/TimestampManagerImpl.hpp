@@ -56,10 +56,51 @@ public:
 	/* @see TimestampManager.hpp */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper);
 
+	/* @see TimestampManager.hpp */
+	virtual UDATA prefetchTimeStamps(J9VMThread* currentThread, ClasspathEntryItem** cpeis, UDATA count, UDATA threadCount, U_64 windowMillis);
+
+	/* @see TimestampManager.hpp */
+	virtual void setTrustedRange(const void* start, const void* end);
+
+	/* @see TimestampManager.hpp */
+	virtual void cleanup(J9VMThread* currentThread);
+
 private:
+	/* Timestamp of one distinct classpath entry location read by prefetchTimeStamps() */
+	typedef struct BatchEntry {
+		const char* location;
+		U_16 locationLen;
+		ClasspathEntryItem* cpei;
+		char* path;
+		I_64 lastModified;
+	} BatchEntry;
+
+	/* State shared by the threads reading a batch */
+	typedef struct BatchWork {
+		J9PortLibrary* portLibrary;
+		omrthread_monitor_t monitor;
+		BatchEntry* entries;
+		UDATA count;
+		UDATA next;
+		UDATA threadsAlive;
+	} BatchWork;
 
 	I_64 localCheckTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, ROMClassWrapper* rcWrapper);
+
+	static I_64 compareTimeStamps(I_64 current, I_64 test);
+
+	bool findBatchTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, I_64* lastModified);
+
+	static int compareBatchEntries(const void* left, const void* right);
+	static int J9THREAD_PROC batchThreadProc(void* entryArg);
+	static void readBatch(BatchWork* work);
+
 	J9SharedClassConfig* _sharedClassConfig;
+	BatchEntry* _batchEntries;
+	UDATA _batchCount;
+	I_64 _batchExpiryMillis;
+	const void* _trustedStart;
+	const void* _trustedEnd;
 };
 
 #endif /* !defined(TIMESTAMPMANAGERIMPL_HPP_INCLUDED) */
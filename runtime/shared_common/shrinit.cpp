@@ -388,6 +388,9 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_TEST_HALF_PAGESIZE, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE},
 	{ OPTION_EXTRA_STARTUPHINTS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_SET_EXTRA_STARTUPHINTS, 0},
 	{ OPTION_SHARE_LAMBDAFORM, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM},
+	{ OPTION_TIMESTAMP_CHECK_THREADS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_TIMESTAMP_CHECK_THREADS_EQUALS, 0},
+	{ OPTION_TIMESTAMP_CACHE_WINDOW_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_TIMESTAMP_CACHE_WINDOW_EQUALS, 0},
+	{ OPTION_IMAGE_MANIFEST_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_IMAGE_MANIFEST_EQUALS, 0},
 	{ NULL, 0, 0 }
 };
 
@@ -730,6 +733,51 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, U_64* runtimeFlags2,
 			*runtimeFlags |= J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE;
 			continue;
 		}
+		case RESULT_DO_TIMESTAMP_CHECK_THREADS_EQUALS:
+		{
+			UDATA temp = 0;
+			char* optString = options + strlen(OPTION_TIMESTAMP_CHECK_THREADS_EQUALS);
+			char* cursor = optString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& (temp <= SHRINIT_MAX_TIMESTAMP_CHECK_THREADS)
+			) {
+				vm->sharedCacheAPI->timestampCheckThreads = (U_32)temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PARAM, OPTION_TIMESTAMP_CHECK_THREADS_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CHECK_THREADS_EQUALS) + (cursor - optString) + 1;
+			continue;
+		}
+		case RESULT_DO_TIMESTAMP_CACHE_WINDOW_EQUALS:
+		{
+			UDATA temp = 0;
+			char* optString = options + strlen(OPTION_TIMESTAMP_CACHE_WINDOW_EQUALS);
+			char* cursor = optString;
+			if (scan_udata(&cursor, &temp) == 0) {
+				vm->sharedCacheAPI->timestampCacheWindow = (U_32)temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PARAM, OPTION_TIMESTAMP_CACHE_WINDOW_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CACHE_WINDOW_EQUALS) + (cursor - optString) + 1;
+			continue;
+		}
+		case RESULT_DO_IMAGE_MANIFEST_EQUALS:
+		{
+			char* manifest = options + strlen(OPTION_IMAGE_MANIFEST_EQUALS);
+			UDATA manifestLen = strlen(manifest);
+			if (NULL != vm->sharedCacheAPI->imageManifest) {
+				j9mem_free_memory(vm->sharedCacheAPI->imageManifest);
+			}
+			vm->sharedCacheAPI->imageManifest = (char*)j9mem_allocate_memory(manifestLen + 1, J9MEM_CATEGORY_CLASSES);
+			if (NULL == vm->sharedCacheAPI->imageManifest) {
+				return RESULT_PARSE_FAILED;
+			}
+			memcpy(vm->sharedCacheAPI->imageManifest, manifest, manifestLen + 1);
+			options += strlen(OPTION_IMAGE_MANIFEST_EQUALS) + manifestLen + 1;
+			continue;
+		}
 		case RESULT_DO_CREATE_LAYER:
 		{
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
@@ -4299,6 +4347,9 @@ j9shr_shutdown(J9JavaVM *vm)
 		if (NULL != vm->sharedCacheAPI->methodSpecs) {
 			j9mem_free_memory(vm->sharedCacheAPI->methodSpecs);
 		}
+		if (NULL != vm->sharedCacheAPI->imageManifest) {
+			j9mem_free_memory(vm->sharedCacheAPI->imageManifest);
+		}
 		j9mem_free_memory(vm->sharedCacheAPI);
 	}
 	if (vm->sharedInvariantInternTable != NULL) {
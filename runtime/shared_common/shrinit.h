@@ -200,6 +200,9 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_TEST_HALF_PAGESIZE "testHalfPageSize"
 #define OPTION_EXTRA_STARTUPHINTS_EQUALS "extraStartupHints="
 #define OPTION_SHARE_LAMBDAFORM "shareLambdaForm" /* internal option for dev/testing */
+#define OPTION_TIMESTAMP_CHECK_THREADS_EQUALS "timestampCheckThreads="
+#define OPTION_TIMESTAMP_CACHE_WINDOW_EQUALS "timestampCacheWindow="
+#define OPTION_IMAGE_MANIFEST_EQUALS "imageManifest="
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -282,6 +285,9 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
 #define RESULT_DO_ADD_RUNTIMEFLAG2 55
 #define RESULT_DO_SET_EXTRA_STARTUPHINTS 56
+#define RESULT_DO_TIMESTAMP_CHECK_THREADS_EQUALS 57
+#define RESULT_DO_TIMESTAMP_CACHE_WINDOW_EQUALS 58
+#define RESULT_DO_IMAGE_MANIFEST_EQUALS 59
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -321,6 +327,7 @@ typedef struct J9SharedClassesOptions {
 #define SHRINIT_MAX_SHARED_STRING_TABLE_NODE_COUNT 15000
 #define SHRINIT_MAX_LOCAL_STRING_TABLE_BYTES 102400
 #define SHRINIT_LOCAL_STRING_TABLE_SIZE_DIVISOR 500 	/* 1/500 of the free space in the cache */
+#define SHRINIT_MAX_TIMESTAMP_CHECK_THREADS 64
 
 #endif /* !defined(SHRINIT_H_INCLUDED) */
 
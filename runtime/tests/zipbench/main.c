@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/*
+ * Microbenchmark for reading class files from a jar.
+ *
+ * Usage: zipbench <jar file> [iterations]
+ *
+ * Every .class entry of the jar is read, first with the file opened normally
+ * and then with the file opened with J9ZIP_OPEN_MAP_FILE. In the mapped mode
+ * stored entries are accessed without copying using zip_getZipEntryDataPointer().
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "j9port.h"
+#include "exelib_api.h"
+#include "omrthread.h"
+#include "zip_api.h"
+#include "omrformatconsts.h"
+
+#define ZIPBENCH_DEFAULT_ITERATIONS 5
+
+typedef struct ZipBenchResult {
+	UDATA classCount;
+	UDATA storedCount;
+	U_64 byteCount;
+	U_64 checksum;
+	I_64 elapsedMicros;
+} ZipBenchResult;
+
+static I_32
+readAllClasses(J9PortLibrary *portLib, const char *jarName, U_32 openFlags, ZipBenchResult *result)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipFile zipFile;
+	J9ZipEntry entry;
+	IDATA nextEntry = 0;
+	U_8 *buffer = NULL;
+	U_32 bufferSize = 0;
+	I_64 start = 0;
+	I_32 rc = 0;
+
+	memset(result, 0, sizeof(*result));
+	start = j9time_usec_clock();
+
+	rc = zip_openZipFile(PORTLIB, (char *)jarName, &zipFile, NULL, openFlags);
+	if (0 != rc) {
+		j9tty_printf(PORTLIB, "Could not open %s (%d)\n", jarName, rc);
+		return rc;
+	}
+
+	zip_resetZipFile(PORTLIB, &zipFile, &nextEntry);
+	zip_initZipEntry(PORTLIB, &entry);
+	for (;;) {
+		U_8 *data = NULL;
+
+		rc = zip_getNextZipEntry(PORTLIB, &zipFile, &entry, &nextEntry, TRUE);
+		if (ZIP_ERR_NO_MORE_ENTRIES == rc) {
+			rc = 0;
+			break;
+		}
+		if (0 != rc) {
+			j9tty_printf(PORTLIB, "Error reading %s (%d)\n", jarName, rc);
+			break;
+		}
+
+		if ((entry.filenameLength > 6) && (0 == strcmp((const char *)&entry.filename[entry.filenameLength - 6], ".class"))) {
+			if (0 == zip_getZipEntryDataPointer(PORTLIB, &zipFile, &entry, &data)) {
+				result->storedCount += 1;
+			} else {
+				if (entry.uncompressedSize > bufferSize) {
+					j9mem_free_memory(buffer);
+					bufferSize = entry.uncompressedSize;
+					buffer = j9mem_allocate_memory(bufferSize, OMRMEM_CATEGORY_VM);
+					if (NULL == buffer) {
+						rc = ZIP_ERR_OUT_OF_MEMORY;
+						zip_freeZipEntry(PORTLIB, &entry);
+						break;
+					}
+				}
+				rc = zip_getZipEntryData(PORTLIB, &zipFile, &entry, buffer, bufferSize);
+				if (0 != rc) {
+					j9tty_printf(PORTLIB, "Error reading %s from %s (%d)\n", entry.filename, jarName, rc);
+					zip_freeZipEntry(PORTLIB, &entry);
+					break;
+				}
+				data = buffer;
+			}
+			/* touch the class bytes so the mapped mode does the same work */
+			if (entry.uncompressedSize >= 8) {
+				U_32 head = 0;
+				U_32 tail = 0;
+				memcpy(&head, data, sizeof(head));
+				memcpy(&tail, data + entry.uncompressedSize - sizeof(tail), sizeof(tail));
+				result->checksum += (U_64)head + tail;
+			}
+			result->classCount += 1;
+			result->byteCount += entry.uncompressedSize;
+		}
+		zip_freeZipEntry(PORTLIB, &entry);
+	}
+
+	zip_releaseZipFile(PORTLIB, &zipFile);
+	j9mem_free_memory(buffer);
+	result->elapsedMicros = j9time_usec_clock() - start;
+	return rc;
+}
+
+static void
+printResult(J9PortLibrary *portLib, const char *mode, UDATA iteration, ZipBenchResult *result)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	j9tty_printf(PORTLIB, "%s iteration %" OMR_PRIuPTR ": %" OMR_PRIuPTR " classes (%" OMR_PRIuPTR " zero-copy), %llu bytes, %lld usec\n",
+			mode, iteration, result->classCount, result->storedCount, result->byteCount, result->elapsedMicros);
+}
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+	struct j9cmdlineOptions *startupOptions = (struct j9cmdlineOptions *)arg;
+	char **argv = startupOptions->argv;
+	UDATA iterations = ZIPBENCH_DEFAULT_ITERATIONS;
+	I_64 readTotal = 0;
+	I_64 mappedTotal = 0;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	if ((startupOptions->argc < 2) || (startupOptions->argc > 3)) {
+		j9tty_printf(PORTLIB, "Usage: %s <jar file> [iterations]\n", argv[0]);
+		return 1;
+	}
+	if (3 == startupOptions->argc) {
+		iterations = (UDATA)atoi(argv[2]);
+		if (0 == iterations) {
+			iterations = ZIPBENCH_DEFAULT_ITERATIONS;
+		}
+	}
+
+	/* The zip code uses the global monitor */
+	omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+
+	if (0 != initZipLibrary(PORTLIB, NULL)) {
+		j9tty_printf(PORTLIB, "Could not load the zip library\n");
+		return 1;
+	}
+
+	for (i = 0; i < iterations; i++) {
+		ZipBenchResult readResult;
+		ZipBenchResult mappedResult;
+
+		if (0 != readAllClasses(PORTLIB, argv[1], J9ZIP_OPEN_NO_FLAGS, &readResult)) {
+			return 1;
+		}
+		if (0 != readAllClasses(PORTLIB, argv[1], J9ZIP_OPEN_MAP_FILE, &mappedResult)) {
+			return 1;
+		}
+		if ((readResult.classCount != mappedResult.classCount) || (readResult.checksum != mappedResult.checksum)) {
+			j9tty_printf(PORTLIB, "Mapped and read class data differ\n");
+			return 1;
+		}
+		printResult(PORTLIB, "read", i, &readResult);
+		printResult(PORTLIB, "mapped", i, &mappedResult);
+		readTotal += readResult.elapsedMicros;
+		mappedTotal += mappedResult.elapsedMicros;
+	}
+
+	j9tty_printf(PORTLIB, "average: read %lld usec, mapped %lld usec\n", readTotal / (I_64)iterations, mappedTotal / (I_64)iterations);
+	return 0;
+}
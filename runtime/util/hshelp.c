@@ -2568,6 +2568,7 @@ swapClassesForFastHCR(J9Class *originalClass, J9Class *obsoleteClass)
 	SWAP_MEMBER(jniIDs, void **, originalClass, obsoleteClass);
 	SWAP_MEMBER(romClass, J9ROMClass *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramMethods, J9Method *, originalClass, obsoleteClass);
+	SWAP_MEMBER(methodLookupIndex, J9MethodLookupIndex *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramConstantPool, J9ConstantPool *, originalClass, obsoleteClass);
 	originalClass->ramConstantPool->ramClass = originalClass;
 	obsoleteClass->ramConstantPool->ramClass = obsoleteClass;
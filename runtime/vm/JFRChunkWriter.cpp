@@ -1624,6 +1624,209 @@ VM_JFRChunkWriter::writeGCHeapSummaryEvent(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeObjectAllocationSampleEvent(void *anElement, void *userData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(ObjectAllocationSampleID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write stacktrace index */
+	bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+	/* Write object class index */
+	bufferWriter->writeLEB128(entry->objectClass);
+
+	/* Write weight, the bytes allocated by the thread since its previous sample */
+	bufferWriter->writeLEB128(entry->weight);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCompilationEvent(void *anElement, void *userData)
+{
+	CompilationEntry *entry = (CompilationEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CompilationID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write compile id */
+	bufferWriter->writeLEB128(entry->compileID);
+
+	/* Write compiler, there is no CompilerType constant pool so this is always null */
+	bufferWriter->writeLEB128(0);
+
+	/* Write method index */
+	bufferWriter->writeLEB128(entry->methodIndex);
+
+	/* Write compile level */
+	bufferWriter->writeLEB128(entry->compileLevel);
+
+	/* Write succeeded */
+	bufferWriter->writeBoolean(entry->succeeded);
+
+	/* Write isOsr */
+	bufferWriter->writeBoolean(entry->isOSR);
+
+	/* Write code size */
+	bufferWriter->writeLEB128(entry->codeSize);
+
+	/* Write inlined bytes */
+	bufferWriter->writeLEB128(entry->inlinedBytes);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeDeoptimizationEvent(void *anElement, void *userData)
+{
+	DeoptimizationEntry *entry = (DeoptimizationEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(DeoptimizationID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write stacktrace index */
+	bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+	/* Write compile id, the decompiled body is not tracked so this is always 0 */
+	bufferWriter->writeLEB128(0);
+
+	/* Write compiler, there is no CompilerType constant pool so this is always null */
+	bufferWriter->writeLEB128(0);
+
+	/* Write method index */
+	bufferWriter->writeLEB128(entry->methodIndex);
+
+	/* Write line number */
+	bufferWriter->writeLEB128(entry->lineNumber);
+
+	/* Write bytecode index */
+	bufferWriter->writeLEB128(entry->bytecodeIndex);
+
+	/* Write instruction, reason and action, none of which have constant pools so they are always null */
+	bufferWriter->writeLEB128(0);
+	bufferWriter->writeLEB128(0);
+	bufferWriter->writeLEB128(0);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCodeCacheFields(VM_BufferWriter *bufferWriter, CodeCacheEntry *entry, bool writeCommittedTop)
+{
+	/* Write code blob type, there is no CodeBlobType constant pool so this is always null */
+	bufferWriter->writeLEB128(0);
+
+	/* Write start address */
+	bufferWriter->writeLEB128(entry->startAddress);
+
+	/* Write committed top address */
+	if (writeCommittedTop) {
+		bufferWriter->writeLEB128(entry->committedTopAddress);
+	}
+
+	/* Write reserved top address */
+	bufferWriter->writeLEB128(entry->reservedTopAddress);
+
+	/* Write entry count, every entry in the code cache is a method body */
+	bufferWriter->writeLEB128(entry->methodCount);
+
+	/* Write method count */
+	bufferWriter->writeLEB128(entry->methodCount);
+
+	/* Write adaptor count, there are no adaptors in the code cache */
+	bufferWriter->writeLEB128(0);
+
+	/* Write unallocated capacity */
+	bufferWriter->writeLEB128(entry->unallocatedCapacity);
+
+	/* Write full count */
+	bufferWriter->writeLEB128(entry->fullCount);
+}
+
+void
+VM_JFRChunkWriter::writeCodeCacheFullEvent(void *anElement, void *userData)
+{
+	CodeCacheEntry *entry = (CodeCacheEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CodeCacheFullID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	writeCodeCacheFields(bufferWriter, entry, true);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCodeCacheStatisticsEvent(void *anElement, void *userData)
+{
+	CodeCacheEntry *entry = (CodeCacheEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(CodeCacheStatisticsID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	writeCodeCacheFields(bufferWriter, entry, false);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeModuleRequire(void *anElement, void *userData)
 {
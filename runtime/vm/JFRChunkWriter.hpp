@@ -100,6 +100,10 @@ enum MetadataTypeID {
 	SystemGCID = 36,
 	YoungGarbageCollectionID = 38,
 	OldGarbageCollectionID = 39,
+	CompilationID = 67,
+	CodeCacheFullID = 72,
+	DeoptimizationID = 73,
+	ObjectAllocationSampleID = 83,
 	JVMInformationID = 87,
 	OSInformationID = 88,
 	VirtualizationInformationID = 89,
@@ -119,6 +123,7 @@ enum MetadataTypeID {
 	NativeLibraryID = 112,
 	ModuleRequireID = 113,
 	ModuleExportID = 114,
+	CodeCacheStatisticsID = 117,
 	GCHeapConfigID = 133,
 	YoungGenerationConfigID = 134,
 	VirtualSpaceID = 149,
@@ -234,6 +239,11 @@ private:
 	static constexpr int YOUNG_GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (2 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE);
 	static constexpr int GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (6 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE);
 	static constexpr int GC_HEAP_SUMMARY_EVENT_SIZE = sizeof(U_8) + (7 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE) + STRING_BUFFER_LENGTH;
+	static constexpr int OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE = (3 * LEB128_64_SIZE) + (4 * LEB128_32_SIZE);
+	static constexpr int COMPILATION_EVENT_SIZE = (4 * LEB128_64_SIZE) + (7 * LEB128_32_SIZE) + (2 * sizeof(U_8));
+	static constexpr int DEOPTIMIZATION_EVENT_SIZE = LEB128_64_SIZE + (12 * LEB128_32_SIZE);
+	static constexpr int CODE_CACHE_FULL_EVENT_SIZE = (9 * LEB128_64_SIZE) + (4 * LEB128_32_SIZE);
+	static constexpr int CODE_CACHE_STATISTICS_EVENT_SIZE = (8 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE);
 
 	static constexpr int METADATA_ID = 1;
 
@@ -466,6 +476,16 @@ done:
 
 			pool_do(_constantPoolTypes.getGCHeapSummaryTable(), &writeGCHeapSummaryEvent, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getObjectAllocationSampleTable(), &writeObjectAllocationSampleEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getCompilationTable(), &writeCompilationEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getDeoptimizationTable(), &writeDeoptimizationEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getCodeCacheFullTable(), &writeCodeCacheFullEvent, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getCodeCacheStatisticsTable(), &writeCodeCacheStatisticsEvent, _bufferWriter);
+
 			/* Only write constant events in first chunk */
 			if (0 == _vm->jfrState.jfrChunkCount) {
 				writeJVMInformationEvent();
@@ -926,6 +946,18 @@ done:
 
 	static void writeGCHeapSummaryEvent(void *anElement, void *userData);
 
+	static void writeObjectAllocationSampleEvent(void *anElement, void *userData);
+
+	static void writeCompilationEvent(void *anElement, void *userData);
+
+	static void writeDeoptimizationEvent(void *anElement, void *userData);
+
+	static void writeCodeCacheFields(VM_BufferWriter *bufferWriter, CodeCacheEntry *entry, bool writeCommittedTop);
+
+	static void writeCodeCacheFullEvent(void *anElement, void *userData);
+
+	static void writeCodeCacheStatisticsEvent(void *anElement, void *userData);
+
 	UDATA
 	calculateRequiredBufferSize()
 	{
@@ -1026,6 +1058,16 @@ done:
 
 		requiredBufferSize += (_constantPoolTypes.getGCHeapSummaryCount() * GC_HEAP_SUMMARY_EVENT_SIZE);
 
+		requiredBufferSize += (_constantPoolTypes.getObjectAllocationSampleCount() * OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCompilationCount() * COMPILATION_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getDeoptimizationCount() * DEOPTIMIZATION_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCodeCacheFullCount() * CODE_CACHE_FULL_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getCodeCacheStatisticsCount() * CODE_CACHE_STATISTICS_EVENT_SIZE);
+
 		return requiredBufferSize;
 	}
 
@@ -119,6 +119,9 @@ VM_JFRConstantPoolTypes::stackTraceHashFn(void *key, void *userData)
 {
 	StackTraceEntry *entry = (StackTraceEntry*) key;
 
+	if (0 != entry->stackTraceID) {
+		return entry->stackTraceID;
+	}
 	return (U_64)(UDATA)entry->vmThread ^ (U_64)entry->ticks;
 }
 
@@ -128,7 +131,10 @@ VM_JFRConstantPoolTypes::stackTraceHashEqualFn(void *tableNode, void *queryNode,
 	StackTraceEntry *tableEntry = (StackTraceEntry *) tableNode;
 	StackTraceEntry *queryEntry = (StackTraceEntry *) queryNode;
 
-	return tableEntry->vmThread == queryEntry->vmThread && tableEntry->ticks == queryEntry->ticks;
+	if (tableEntry->stackTraceID != queryEntry->stackTraceID) {
+		return FALSE;
+	}
+	return (0 != tableEntry->stackTraceID) || (tableEntry->vmThread == queryEntry->vmThread && tableEntry->ticks == queryEntry->ticks);
 }
 
 UDATA
@@ -1000,15 +1006,18 @@ done:
 }
 
 U_32
-VM_JFRConstantPoolTypes::addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, U_32 numOfFrames)
+VM_JFRConstantPoolTypes::addStackTraceEntry(J9VMThread *vmThread, UDATA stackTraceID, I_64 ticks, U_32 numOfFrames)
 {
 	U_32 index = U_32_MAX;
 	StackTraceEntry *entry = NULL;
 	StackTraceEntry entryBuffer = {0};
 
 	entry = &entryBuffer;
-	entry->vmThread = vmThread;
-	entry->ticks = ticks;
+	entry->stackTraceID = stackTraceID;
+	if (0 == stackTraceID) {
+		entry->vmThread = vmThread;
+		entry->ticks = ticks;
+	}
 	_buildResult = OK;
 
 	entry = (StackTraceEntry *) hashTableFind(_stackTraceTable, entry);
@@ -1068,7 +1077,7 @@ VM_JFRConstantPoolTypes::addExecutionSampleEntry(J9JFRExecutionSample *execution
 	entry->threadIndex = addThreadEntry(entry->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(entry->vmThread, J9JFREXECUTIONSAMPLE_STACKTRACE(executionSampleData), executionSampleData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(entry->vmThread, executionSampleData->stackTraceID, J9JFREXECUTIONSAMPLE_STACKTRACE(executionSampleData), executionSampleData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	_executionSampleCount += 1;
@@ -1098,7 +1107,7 @@ VM_JFRConstantPoolTypes::addThreadStartEntry(J9JFRThreadStart *threadStartData)
 	entry->parentThreadIndex = addThreadEntry(threadStartData->parentThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(threadStartData->parentThread, J9JFRTHREADSTART_STACKTRACE(threadStartData), threadStartData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(threadStartData->parentThread, threadStartData->stackTraceID, J9JFRTHREADSTART_STACKTRACE(threadStartData), threadStartData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	_threadStartCount += 1;
@@ -1151,7 +1160,7 @@ VM_JFRConstantPoolTypes::addThreadSleepEntry(J9JFRThreadSlept *threadSleepData)
 	entry->eventThreadIndex = addThreadEntry(threadSleepData->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(threadSleepData->vmThread, J9JFRTHREADSLEPT_STACKTRACE(threadSleepData), threadSleepData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(threadSleepData->vmThread, threadSleepData->stackTraceID, J9JFRTHREADSLEPT_STACKTRACE(threadSleepData), threadSleepData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	_threadSleepCount += 1;
@@ -1182,7 +1191,7 @@ VM_JFRConstantPoolTypes::addMonitorWaitEntry(J9JFRMonitorWaited* threadWaitData)
 	entry->eventThreadIndex = addThreadEntry(threadWaitData->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(threadWaitData->vmThread, J9JFRMonitorWaitedED_STACKTRACE(threadWaitData), threadWaitData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(threadWaitData->vmThread, threadWaitData->stackTraceID, J9JFRMonitorWaitedED_STACKTRACE(threadWaitData), threadWaitData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	entry->monitorClass = getClassEntry(threadWaitData->monitorClass);
@@ -1218,7 +1227,7 @@ VM_JFRConstantPoolTypes::addMonitorEnterEntry(J9JFRMonitorEntered *monitorEnterD
 	entry->eventThreadIndex = addThreadEntry(monitorEnterData->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(monitorEnterData->vmThread, J9JFRMONITORENTERED_STACKTRACE(monitorEnterData), monitorEnterData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(monitorEnterData->vmThread, monitorEnterData->stackTraceID, J9JFRMONITORENTERED_STACKTRACE(monitorEnterData), monitorEnterData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	entry->monitorClass = getClassEntry(monitorEnterData->monitorClass);
@@ -1251,7 +1260,7 @@ VM_JFRConstantPoolTypes::addThreadParkEntry(J9JFRThreadParked* threadParkData)
 	entry->eventThreadIndex = addThreadEntry(threadParkData->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(threadParkData->vmThread, J9JFRTHREADPARKED_STACKTRACE(threadParkData), threadParkData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(threadParkData->vmThread, threadParkData->stackTraceID, J9JFRTHREADPARKED_STACKTRACE(threadParkData), threadParkData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	entry->parkedClass = getClassEntry(threadParkData->parkedClass);
@@ -1385,7 +1394,7 @@ VM_JFRConstantPoolTypes::addSystemGCEntry(J9JFRSystemGC *systemGCData)
 	entry->eventThreadIndex = addThreadEntry(systemGCData->vmThread);
 	if (isResultNotOKay()) goto done;
 
-	entry->stackTraceIndex = consumeStackTrace(systemGCData->vmThread, J9JFRSYSTEMGC_STACKTRACE(systemGCData), systemGCData->stackTraceSize);
+	entry->stackTraceIndex = consumeStackTrace(systemGCData->vmThread, systemGCData->stackTraceID, J9JFRSYSTEMGC_STACKTRACE(systemGCData), systemGCData->stackTraceSize);
 	if (isResultNotOKay()) goto done;
 
 	_systemGCCount += 1;
@@ -1490,6 +1499,149 @@ done:
 	return;
 }
 
+void
+VM_JFRConstantPoolTypes::addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)pool_newElement(_objectAllocationSampleTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = objectAllocationSampleData->startTicks;
+	entry->weight = objectAllocationSampleData->weight;
+
+	entry->eventThreadIndex = addThreadEntry(objectAllocationSampleData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->stackTraceIndex = consumeStackTrace(objectAllocationSampleData->vmThread, objectAllocationSampleData->stackTraceID, J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(objectAllocationSampleData), objectAllocationSampleData->stackTraceSize);
+	if (isResultNotOKay()) goto done;
+
+	entry->objectClass = getClassEntry(objectAllocationSampleData->objectClass);
+	if (isResultNotOKay()) goto done;
+
+	_objectAllocationSampleCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCompilationEntry(J9JFRCompilation *compilationData)
+{
+	CompilationEntry *entry = (CompilationEntry *)pool_newElement(_compilationTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = compilationData->startTicks;
+	entry->duration = compilationData->duration;
+	entry->compileID = (U_32)compilationData->compileID;
+	entry->compileLevel = (U_16)compilationData->compileLevel;
+	entry->succeeded = compilationData->succeeded;
+	entry->isOSR = compilationData->isOSR;
+	entry->codeSize = compilationData->codeSize;
+	entry->inlinedBytes = compilationData->inlinedBytes;
+
+	entry->eventThreadIndex = addThreadEntry(compilationData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->methodIndex = getMethodEntry(J9_ROM_METHOD_FROM_RAM_METHOD(compilationData->method), J9_CLASS_FROM_METHOD(compilationData->method));
+	if (isResultNotOKay()) goto done;
+
+	_compilationCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addDeoptimizationEntry(J9JFRDeoptimization *deoptimizationData)
+{
+	DeoptimizationEntry *entry = (DeoptimizationEntry *)pool_newElement(_deoptimizationTable);
+	J9Method *method = deoptimizationData->method;
+	UDATA lineNumber = 0;
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = deoptimizationData->startTicks;
+	entry->bytecodeIndex = (I_32)deoptimizationData->bytecodeIndex;
+	lineNumber = getLineNumberForROMClass(_vm, method, deoptimizationData->bytecodeIndex);
+	entry->lineNumber = ((UDATA)-1 == lineNumber) ? 0 : (I_32)lineNumber;
+
+	entry->eventThreadIndex = addThreadEntry(deoptimizationData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->stackTraceIndex = consumeStackTrace(deoptimizationData->vmThread, deoptimizationData->stackTraceID, J9JFRDEOPTIMIZATION_STACKTRACE(deoptimizationData), deoptimizationData->stackTraceSize);
+	if (isResultNotOKay()) goto done;
+
+	entry->methodIndex = getMethodEntry(J9_ROM_METHOD_FROM_RAM_METHOD(method), J9_CLASS_FROM_METHOD(method));
+	if (isResultNotOKay()) goto done;
+
+	_deoptimizationCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::fillCodeCacheEntry(CodeCacheEntry *entry, J9JFRCodeCacheStatistics *codeCacheData)
+{
+	entry->ticks = codeCacheData->startTicks;
+	entry->startAddress = codeCacheData->startAddress;
+	entry->committedTopAddress = codeCacheData->committedTopAddress;
+	entry->reservedTopAddress = codeCacheData->reservedTopAddress;
+	entry->methodCount = codeCacheData->methodCount;
+	entry->unallocatedCapacity = codeCacheData->unallocatedCapacity;
+	entry->fullCount = codeCacheData->fullCount;
+}
+
+void
+VM_JFRConstantPoolTypes::addCodeCacheFullEntry(J9JFRCodeCacheStatistics *codeCacheData)
+{
+	CodeCacheEntry *entry = (CodeCacheEntry *)pool_newElement(_codeCacheFullTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	fillCodeCacheEntry(entry, codeCacheData);
+
+	entry->eventThreadIndex = addThreadEntry(codeCacheData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	_codeCacheFullCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCodeCacheStatisticsEntry(J9JFRCodeCacheStatistics *codeCacheData)
+{
+	CodeCacheEntry *entry = (CodeCacheEntry *)pool_newElement(_codeCacheStatisticsTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	fillCodeCacheEntry(entry, codeCacheData);
+	entry->eventThreadIndex = 0;
+
+	_codeCacheStatisticsCount += 1;
+
+done:
+	return;
+}
+
 void
 VM_JFRConstantPoolTypes::printTables()
 {
@@ -252,6 +252,7 @@ struct ThreadParkEntry {
 };
 
 struct StackTraceEntry {
+	UDATA stackTraceID;
 	J9VMThread *vmThread;
 	I_64 ticks;
 	U_32 numOfFrames;
@@ -353,6 +354,47 @@ struct GCHeapSummaryEntry {
 	I_64 heapUsed;
 };
 
+struct ObjectAllocationSampleEntry {
+	I_64 ticks;
+	U_32 eventThreadIndex;
+	U_32 stackTraceIndex;
+	U_32 objectClass;
+	U_64 weight;
+};
+
+struct CompilationEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_32 eventThreadIndex;
+	U_32 compileID;
+	U_32 methodIndex;
+	U_16 compileLevel;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+	U_64 codeSize;
+	U_64 inlinedBytes;
+};
+
+struct DeoptimizationEntry {
+	I_64 ticks;
+	U_32 eventThreadIndex;
+	U_32 stackTraceIndex;
+	U_32 methodIndex;
+	I_32 lineNumber;
+	I_32 bytecodeIndex;
+};
+
+struct CodeCacheEntry {
+	I_64 ticks;
+	U_32 eventThreadIndex;
+	U_64 startAddress;
+	U_64 committedTopAddress;
+	U_64 reservedTopAddress;
+	U_64 methodCount;
+	U_64 unallocatedCapacity;
+	U_64 fullCount;
+};
+
 struct ModuleRequireEntry {
 	I_64 ticks;
 	U_32 sourceModuleIndex;
@@ -508,6 +550,16 @@ private:
 	UDATA _garbageCollectionCount;
 	J9Pool *_gcHeapSummaryTable;
 	UDATA _gcHeapSummaryCount;
+	J9Pool *_objectAllocationSampleTable;
+	UDATA _objectAllocationSampleCount;
+	J9Pool *_compilationTable;
+	UDATA _compilationCount;
+	J9Pool *_deoptimizationTable;
+	UDATA _deoptimizationCount;
+	J9Pool *_codeCacheFullTable;
+	UDATA _codeCacheFullCount;
+	J9Pool *_codeCacheStatisticsTable;
+	UDATA _codeCacheStatisticsCount;
 
 	/* Processing buffers */
 	StackFrame *_currentStackFrameBuffer;
@@ -659,7 +711,7 @@ private:
 
 	U_32 addThreadGroupEntry(j9object_t threadGroup);
 
-	U_32 addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, U_32 numOfFrames);
+	U_32 addStackTraceEntry(J9VMThread *vmThread, UDATA stackTraceID, I_64 ticks, U_32 numOfFrames);
 
 	void printMergedStringTables();
 
@@ -797,6 +849,18 @@ public:
 
 	void addGCHeapSummaryEntry(J9JFRGCHeapSummary *gcHeapSummaryData);
 
+	void addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData);
+
+	void addCompilationEntry(J9JFRCompilation *compilationData);
+
+	void addDeoptimizationEntry(J9JFRDeoptimization *deoptimizationData);
+
+	void addCodeCacheFullEntry(J9JFRCodeCacheStatistics *codeCacheData);
+
+	void addCodeCacheStatisticsEntry(J9JFRCodeCacheStatistics *codeCacheData);
+
+	static void fillCodeCacheEntry(CodeCacheEntry *entry, J9JFRCodeCacheStatistics *codeCacheData);
+
 	J9Pool *getExecutionSampleTable()
 	{
 		return _executionSampleTable;
@@ -937,6 +1001,56 @@ public:
 		return _gcHeapSummaryCount;
 	}
 
+	J9Pool *getObjectAllocationSampleTable()
+	{
+		return _objectAllocationSampleTable;
+	}
+
+	UDATA getObjectAllocationSampleCount()
+	{
+		return _objectAllocationSampleCount;
+	}
+
+	J9Pool *getCompilationTable()
+	{
+		return _compilationTable;
+	}
+
+	UDATA getCompilationCount()
+	{
+		return _compilationCount;
+	}
+
+	J9Pool *getDeoptimizationTable()
+	{
+		return _deoptimizationTable;
+	}
+
+	UDATA getDeoptimizationCount()
+	{
+		return _deoptimizationCount;
+	}
+
+	J9Pool *getCodeCacheFullTable()
+	{
+		return _codeCacheFullTable;
+	}
+
+	UDATA getCodeCacheFullCount()
+	{
+		return _codeCacheFullCount;
+	}
+
+	J9Pool *getCodeCacheStatisticsTable()
+	{
+		return _codeCacheStatisticsTable;
+	}
+
+	UDATA getCodeCacheStatisticsCount()
+	{
+		return _codeCacheStatisticsCount;
+	}
+
 	UDATA getThreadStartCount()
 	{
 		return _threadStartCount;
@@ -1208,6 +1322,21 @@ public:
 			case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 				addGCHeapSummaryEntry((J9JFRGCHeapSummary *)event);
 				break;
+			case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+				addObjectAllocationSampleEntry((J9JFRObjectAllocationSample *)event);
+				break;
+			case J9JFR_EVENT_TYPE_COMPILATION:
+				addCompilationEntry((J9JFRCompilation *)event);
+				break;
+			case J9JFR_EVENT_TYPE_DEOPTIMIZATION:
+				addDeoptimizationEntry((J9JFRDeoptimization *)event);
+				break;
+			case J9JFR_EVENT_TYPE_CODE_CACHE_FULL:
+				addCodeCacheFullEntry((J9JFRCodeCacheStatistics *)event);
+				break;
+			case J9JFR_EVENT_TYPE_CODE_CACHE_STATISTICS:
+				addCodeCacheStatisticsEntry((J9JFRCodeCacheStatistics *)event);
+				break;
 			default:
 				Assert_VM_unreachable();
 				break;
@@ -1243,9 +1372,24 @@ done:
 		return;
 	}
 
-	U_32 consumeStackTrace(J9VMThread *walkThread, UDATA *walkStateCache, UDATA numberOfFrames) {
+	U_32 consumeStackTrace(J9VMThread *walkThread, UDATA stackTraceID, UDATA *walkStateCache, UDATA numberOfFrames) {
 		U_32 index = U_32_MAX;
 		UDATA expandedStackTraceCount = 0;
+		StackTraceEntry *entry = NULL;
+		StackTraceEntry query = {0};
+
+		if (0 != stackTraceID) {
+			/* Traces in the global table are shared between events, resolve their frames once per chunk. */
+			query.stackTraceID = stackTraceID;
+			entry = (StackTraceEntry *)hashTableFind(_stackTraceTable, &query);
+			if (NULL != entry) {
+				index = entry->index;
+				goto done;
+			}
+			J9JFRStackTrace *stackTrace = _vm->jfrState.stackTraceTable[stackTraceID - 1];
+			walkStateCache = J9JFRSTACKTRACE_FRAMES(stackTrace);
+			numberOfFrames = stackTrace->frameCount;
+		}
 
 		if (0 == numberOfFrames) {
 			index = 0;
@@ -1263,7 +1407,7 @@ done:
 
 		iterateStackTraceImpl(_currentThread, (j9object_t *)walkStateCache, &stackTraceCallback, this, FALSE, FALSE, numberOfFrames, FALSE);
 
-		index = addStackTraceEntry(walkThread, j9time_nano_time(), _currentFrameCount);
+		index = addStackTraceEntry(walkThread, stackTraceID, j9time_nano_time(), _currentFrameCount);
 		_stackFrameCount += (U_32)expandedStackTraceCount;
 		_currentStackFrameBuffer = NULL;
 
@@ -1868,6 +2012,16 @@ done:
 		, _garbageCollectionCount(0)
 		, _gcHeapSummaryTable(NULL)
 		, _gcHeapSummaryCount(0)
+		, _objectAllocationSampleTable(NULL)
+		, _objectAllocationSampleCount(0)
+		, _compilationTable(NULL)
+		, _compilationCount(0)
+		, _deoptimizationTable(NULL)
+		, _deoptimizationCount(0)
+		, _codeCacheFullTable(NULL)
+		, _codeCacheFullCount(0)
+		, _codeCacheStatisticsTable(NULL)
+		, _codeCacheStatisticsCount(0)
 		, _previousStackTraceEntry(NULL)
 		, _firstStackTraceEntry(NULL)
 		, _previousThreadEntry(NULL)
@@ -2074,6 +2228,36 @@ done:
 			goto done;
 		}
 
+		_objectAllocationSampleTable = pool_new(sizeof(ObjectAllocationSampleEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _objectAllocationSampleTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_compilationTable = pool_new(sizeof(CompilationEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _compilationTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_deoptimizationTable = pool_new(sizeof(DeoptimizationEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _deoptimizationTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_codeCacheFullTable = pool_new(sizeof(CodeCacheEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _codeCacheFullTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_codeCacheStatisticsTable = pool_new(sizeof(CodeCacheEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _codeCacheStatisticsTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
 		/* Add reserved index for default entries. For strings zero is the empty or NUll string.
 		 * For package zero is the deafult package, for Module zero is the unnamed module. ThreadGroup
 		 * zero is NULL threadGroup.
@@ -2177,6 +2361,11 @@ done:
 		pool_kill(_youngGarbageCollectionTable);
 		pool_kill(_garbageCollectionTable);
 		pool_kill(_gcHeapSummaryTable);
+		pool_kill(_objectAllocationSampleTable);
+		pool_kill(_compilationTable);
+		pool_kill(_deoptimizationTable);
+		pool_kill(_codeCacheFullTable);
+		pool_kill(_codeCacheStatisticsTable);
 		j9mem_free_memory(_globalStringTable);
 	}
 
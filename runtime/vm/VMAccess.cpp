@@ -489,7 +489,19 @@ void  internalReleaseVMAccessSetStatus(J9VMThread * vmThread, UDATA flags)
 	VM_VMAccess::inlineReleaseVMAccessSetStatus(vmThread, flags);
 }
 
-/** @brief Free any cached decompilation record and empty the UTF cache.
+/** @brief Empty the interned String cache. The cache itself (and its counters) is retained.
+ *
+ * @param[in] currentThread the J9VMThread in which to clear the cache
+ */
+static void clearInternStringCache(J9VMThread *currentThread)
+{
+	J9InternStringCache *internStringCache = currentThread->internStringCache;
+	if (NULL != internStringCache) {
+		memset(J9INTERNSTRINGCACHE_ENTRIES(internStringCache), 0, internStringCache->size * sizeof(j9object_t));
+	}
+}
+
+/** @brief Free any cached decompilation record and empty the UTF and interned String caches.
  *
  * @param[in] currentThread the J9VMThread in which to clear caches
  */
@@ -503,6 +515,7 @@ static void clearThreadLocalCachesPostExclusive(J9VMThread *currentThread)
 		currentThread->utfCache = NULL;
 		hashTableFree(utfCache);
 	}
+	clearInternStringCache(currentThread);
 }
 
 void releaseExclusiveVMAccess(J9VMThread * vmThread)
@@ -878,7 +891,7 @@ releaseExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 		vm->exclusiveAccessState = J9_XACCESS_NONE;
 		currentThread = vm->mainThread;
 		do {
-			/* Free any cached decompilation records and empty the UTF cache */
+			/* Free any cached decompilation records and empty the UTF and interned String caches */
 			PORT_ACCESS_FROM_JAVAVM(vm);
 			j9mem_free_memory(currentThread->lastDecompilation);
 			currentThread->lastDecompilation = NULL;
@@ -887,6 +900,7 @@ releaseExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 				currentThread->utfCache = NULL;
 				hashTableFree(utfCache);
 			}
+			clearInternStringCache(currentThread);
 			VM_VMAccess::clearPublicFlags(currentThread, J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE | J9_PUBLIC_FLAGS_NOT_COUNTED_BY_EXCLUSIVE);
 		} while ((currentThread = currentThread->linkNext) != vm->mainThread);
 		omrthread_monitor_notify_all(vm->exclusiveAccessMutex);
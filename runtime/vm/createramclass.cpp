@@ -71,6 +71,7 @@ enum J9ClassFragments {
 #endif /* defined(J9VM_OPT_OPENJDK_METHODHANDLE) */
 	RAM_STATIC_SPLIT_TABLE_FRAGMENT,
 	RAM_SPECIAL_SPLIT_TABLE_FRAGMENT,
+	RAM_METHOD_LOOKUP_INDEX_FRAGMENT,
 #if defined(J9VM_OPT_VALHALLA_STRICT_FIELDS)
 	RAM_CLASS_FLATTENED_CLASS_CACHE,
 #endif /* defined(J9VM_OPT_VALHALLA_STRICT_FIELDS) */
@@ -3250,6 +3251,17 @@ fail:
 			allocationRequests[RAM_SPECIAL_SPLIT_TABLE_FRAGMENT].segmentKind = SK_ABOVE4G_INFREQUENTLY_ACCESSED;
 #endif /* defined(LINUXPPC) */
 
+			/* method lookup index fragment */
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].prefixSize = 0;
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].alignment = sizeof(UDATA);
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].alignedSize = methodLookupIndexSize(romClass);
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].address = NULL;
+#if defined(LINUXPPC)
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].segmentKind = SK_SUB4G;
+#else /* defined(LINUXPPC) */
+			allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].segmentKind = SK_ABOVE4G_FREQUENTLY_ACCESSED;
+#endif /* defined(LINUXPPC) */
+
 #if defined(J9VM_OPT_VALHALLA_STRICT_FIELDS)
 			/* flattened classes cache */
 			UDATA flattenedClassCacheAllocSize = 0;
@@ -3321,6 +3333,7 @@ fail:
 				for (U_16 i = 0; i < romClass->specialSplitMethodRefCount; ++i) {
 					ramClass->specialSplitMethodTable[i] = (J9Method*)javaVM->initialMethods.initialSpecialMethod;
 				}
+				ramClass->methodLookupIndex = (J9MethodLookupIndex *)allocationRequests[RAM_METHOD_LOOKUP_INDEX_FRAGMENT].address;
 #if defined(J9VM_OPT_VALHALLA_STRICT_FIELDS)
 				ramClass->flattenedClassCache = (J9FlattenedClassCache *)allocationRequests[RAM_CLASS_FLATTENED_CLASS_CACHE].address;
 				if (0 != flattenedClassCacheAllocSize) {
@@ -3408,6 +3421,10 @@ fail:
 					}
 					romMethod = nextROMMethod(romMethod);
 				}
+
+				if (NULL != ramClass->methodLookupIndex) {
+					initializeMethodLookupIndex(ramClass, ramClass->methodLookupIndex);
+				}
 			}
 
 			if (ramConstantPoolCount != 0) {
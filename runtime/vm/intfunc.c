@@ -478,6 +478,9 @@ J9InternalVMFunctions J9InternalFunctions = {
 	jfrOldGarbageCollection,
 	jfrYoungGarbageCollection,
 	jfrGarbageCollection,
+	jfrCompilation,
+	jfrDeoptimization,
+	jfrCodeCacheFull,
 	setJFRRecordingFileName,
 	tearDownJFR,
 	getTypeIdUTF8,
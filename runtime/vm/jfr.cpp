@@ -21,6 +21,7 @@
  *******************************************************************************/
 #include "JFRConstantPoolTypes.hpp"
 #include "j9protos.h"
+#include "mmhook.h"
 #include "omrlinkedlist.h"
 #include "objhelp.h"
 #include "pool_api.h"
@@ -50,6 +51,14 @@ J9_DECLARE_CONSTANT_NAS(bytesForEagerInstrumentationNAS, bytesForEagerInstrument
 #define J9JFR_GLOBAL_BUFFER_SIZE (10 * J9JFR_THREAD_BUFFER_SIZE)
 #define J9JFR_SAMPLING_RATE 10
 #define J9JFR_CLASSNAME_BUFFER_SIZE 128
+/* Bytes allocated by a thread between allocation sampling hooks, the JEP 331 default. */
+#define J9JFR_ALLOCATION_SAMPLING_INTERVAL (512 * 1024)
+/* Maximum number of allocation samples recorded per second across all threads. */
+#define J9JFR_ALLOCATION_SAMPLES_PER_SECOND 150
+#define J9JFR_ALLOCATION_SAMPLE_WINDOW_NANOS ((I_64)1000000000)
+/* Slots in the global stack trace table, must be a power of 2. */
+#define J9JFR_STACKTRACE_TABLE_SIZE 16384
+#define J9JFR_STACKTRACE_TABLE_MAX_PROBES 16
 
 /* Value needs to be the same as jdk.jfr.internal.JVM.RESERVED_CLASS_ID_LIMIT. */
 #define RESERVED_CLASS_ID_LIMIT 500
@@ -136,6 +145,19 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 		size = sizeof(J9JFRGCHeapSummary);
 		break;
+	case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+		size = sizeof(J9JFRObjectAllocationSample) + (((J9JFRObjectAllocationSample *)jfrEvent)->stackTraceSize * sizeof(UDATA));
+		break;
+	case J9JFR_EVENT_TYPE_COMPILATION:
+		size = sizeof(J9JFRCompilation);
+		break;
+	case J9JFR_EVENT_TYPE_DEOPTIMIZATION:
+		size = sizeof(J9JFRDeoptimization) + (((J9JFRDeoptimization *)jfrEvent)->stackTraceSize * sizeof(UDATA));
+		break;
+	case J9JFR_EVENT_TYPE_CODE_CACHE_FULL:
+	case J9JFR_EVENT_TYPE_CODE_CACHE_STATISTICS:
+		size = sizeof(J9JFRCodeCacheStatistics);
+		break;
 	default:
 		Assert_VM_unreachable();
 		break;
@@ -367,9 +389,102 @@ done:
 	return jfrEvent;
 }
 
+/**
+ * Find or add a stack trace in the global stack trace table. Slots are only ever
+ * filled with a compare and swap, and the traces are immutable once published, so
+ * lookups and insertions do not need a lock. Slots are emptied by
+ * jfrResetStackTraces once no buffered event can refer to them.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param frames[in] the PCs of the walked frames
+ * @param frameCount[in] the number of PCs
+ *
+ * @returns the stack trace ID (table slot + 1), or 0 if the trace could not be recorded
+ */
+static UDATA
+jfrInternStackTrace(J9JavaVM *vm, UDATA *frames, UDATA frameCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9JFRStackTrace **table = vm->jfrState.stackTraceTable;
+	J9JFRStackTrace *newStackTrace = NULL;
+	UDATA framesSize = frameCount * sizeof(UDATA);
+	UDATA stackTraceID = 0;
+	UDATA hash = frameCount;
+
+	if ((NULL == table) || (0 == frameCount) || !vm->jfrState.isStarted) {
+		goto done;
+	}
+
+	for (UDATA i = 0; i < frameCount; i++) {
+		hash = (hash * 31) + (frames[i] >> 2);
+	}
+
+	for (UDATA probe = 0; probe < J9JFR_STACKTRACE_TABLE_MAX_PROBES; probe++) {
+		UDATA slot = (hash + probe) & (J9JFR_STACKTRACE_TABLE_SIZE - 1);
+		J9JFRStackTrace *stackTrace = table[slot];
+
+		if (NULL == stackTrace) {
+			if (NULL == newStackTrace) {
+				newStackTrace = (J9JFRStackTrace *)j9mem_allocate_memory(sizeof(J9JFRStackTrace) + framesSize, J9MEM_CATEGORY_JFR);
+				if (NULL == newStackTrace) {
+					goto done;
+				}
+				newStackTrace->hash = hash;
+				newStackTrace->frameCount = frameCount;
+				memcpy(J9JFRSTACKTRACE_FRAMES(newStackTrace), frames, framesSize);
+			}
+			stackTrace = (J9JFRStackTrace *)VM_AtomicSupport::lockCompareExchange((UDATA *)&table[slot], (UDATA)NULL, (UDATA)newStackTrace);
+			if (NULL == stackTrace) {
+				VM_AtomicSupport::add(&vm->jfrState.stackTraceCount, 1);
+				newStackTrace = NULL;
+				stackTraceID = slot + 1;
+				break;
+			}
+			/* Another thread filled the slot first, it may have recorded the same trace. */
+		}
+
+		if ((hash == stackTrace->hash)
+		&& (frameCount == stackTrace->frameCount)
+		&& (0 == memcmp(J9JFRSTACKTRACE_FRAMES(stackTrace), frames, framesSize))
+		) {
+			stackTraceID = slot + 1;
+			break;
+		}
+	}
+
+done:
+	j9mem_free_memory(newStackTrace);
+	return stackTraceID;
+}
+
+/**
+ * Empty the global stack trace table.
+ *
+ * The current thread must have exclusive VM access, and all buffered events must
+ * have been written out, as events refer to the table by slot.
+ *
+ * @param vm[in] the J9JavaVM
+ */
+static void
+jfrResetStackTraces(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9JFRStackTrace **table = vm->jfrState.stackTraceTable;
+
+	if ((NULL != table) && (0 != vm->jfrState.stackTraceCount)) {
+		for (UDATA slot = 0; slot < J9JFR_STACKTRACE_TABLE_SIZE; slot++) {
+			j9mem_free_memory(table[slot]);
+			table[slot] = NULL;
+		}
+		vm->jfrState.stackTraceCount = 0;
+	}
+}
+
 /**
  * Reserve space for an event, initialize the common fields
- * and attach the stack trace.
+ * and attach the stack trace. The trace is recorded once in the global
+ * stack trace table and referred to by ID; if the table cannot take it,
+ * the PCs are stored inline after the fixed portion of the event.
  *
  * @param currentThread[in] the current J9VMThread
  * @param eventType[in] the event type
@@ -389,12 +504,15 @@ reserveBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread,
 	UDATA walkRC = currentThread->javaVM->walkStackFrames(currentThread, walkState);
 	if (J9_STACKWALK_RC_NONE == walkRC) {
 		UDATA framesWalked = walkState->framesWalked;
-		UDATA stackTraceBytes = framesWalked * sizeof(UDATA);
+		UDATA stackTraceID = jfrInternStackTrace(currentThread->javaVM, walkState->cache, framesWalked);
+		UDATA inlineFrames = (0 == stackTraceID) ? framesWalked : 0;
+		UDATA stackTraceBytes = inlineFrames * sizeof(UDATA);
 		UDATA eventSize = eventFixedSize + stackTraceBytes;
 		jfrEvent = (J9JFREvent*)reserveBuffer(sampleThread, eventSize);
 		if (NULL != jfrEvent) {
 			initializeEventFields(sampleThread, jfrEvent, eventType);
-			((J9JFREventWithStackTrace*)jfrEvent)->stackTraceSize = framesWalked;
+			((J9JFREventWithStackTrace*)jfrEvent)->stackTraceID = stackTraceID;
+			((J9JFREventWithStackTrace*)jfrEvent)->stackTraceSize = inlineFrames;
 			memcpy(((U_8*)jfrEvent) + eventFixedSize, walkState->cache, stackTraceBytes);
 		}
 		freeStackWalkCaches(currentThread, walkState);
@@ -465,6 +583,8 @@ jfrClassesUnload(J9HookInterface **hook, UDATA eventNum, void *eventData, void *
 	 */
 	flushAllThreadBuffers(currentThread, false);
 	writeOutGlobalBuffer(currentThread, false, false);
+	/* The recorded stack traces may refer to methods of the unloading classes. */
+	jfrResetStackTraces(currentThread->javaVM);
 }
 
 /**
@@ -567,6 +687,7 @@ jfrThreadEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *user
 	acquireExclusiveVMAccess(currentThread);
 	flushAllThreadBuffers(currentThread, false);
 	writeOutGlobalBuffer(currentThread, false, false);
+	jfrResetStackTraces(currentThread->javaVM);
 
 	/* Free the thread local buffer */
 	j9mem_free_memory((void*)currentThread->jfrBuffer.bufferStart);
@@ -758,6 +879,54 @@ jfrSystemGC(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userD
 	}
 }
 
+/**
+ * Hook for sampled object allocations. Triggered from the out-of-line allocation
+ * path (TLH refresh or non-TLH allocation) each time the thread crosses the GC
+ * allocation sampling interval. Called with VM access.
+ *
+ * Recorded samples are throttled to J9JFR_ALLOCATION_SAMPLES_PER_SECOND across all
+ * threads. The weight of a sample is the number of bytes the thread allocated since
+ * its previous recorded sample, so dropped samples are accounted for in the next one.
+ *
+ * @param hook[in] the GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrObjectAllocationSampled(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	JFRState *jfrState = &vm->jfrState;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	I_64 currentTime = j9time_nano_time();
+	U_64 windowStart = (U_64)jfrState->allocationSampleWindowStart;
+	if ((currentTime - (I_64)windowStart) >= J9JFR_ALLOCATION_SAMPLE_WINDOW_NANOS) {
+		/* Only the thread that moves the window resets the count. */
+		if (windowStart == VM_AtomicSupport::lockCompareExchangeU64((U_64 *)&jfrState->allocationSampleWindowStart, windowStart, (U_64)currentTime)) {
+			jfrState->allocationSampleWindowCount = 0;
+		}
+	}
+	if (VM_AtomicSupport::add(&jfrState->allocationSampleWindowCount, 1) > J9JFR_ALLOCATION_SAMPLES_PER_SECOND) {
+		return;
+	}
+
+	UDATA allocatedBytes = 0;
+	vm->memoryManagerFunctions->j9gc_get_cumulative_bytes_allocated_by_thread(currentThread, &allocatedBytes);
+
+	J9JFRObjectAllocationSample *jfrEvent = (J9JFRObjectAllocationSample *)reserveBufferWithStackTrace(currentThread, currentThread, J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE, sizeof(*jfrEvent));
+	if (NULL != jfrEvent) {
+		J9ThreadJFRState *threadJfrState = &currentThread->threadJfrState;
+		jfrEvent->objectClass = event->clazz;
+		jfrEvent->objectSize = event->objectSize;
+		jfrEvent->weight = allocatedBytes - threadJfrState->prevAllocatedBytes;
+		threadJfrState->prevAllocatedBytes = allocatedBytes;
+	}
+}
+
 /**
  * Hook for old garbage collection event. Called without VM access.
  *
@@ -828,6 +997,109 @@ jfrGarbageCollection(OMR_VMThread *omrVMThread)
 	}
 }
 
+void
+jfrCompilation(J9VMThread *currentThread, J9Method *method, I_64 startTicks, UDATA compileLevel, BOOLEAN succeeded, BOOLEAN isOSR, UDATA codeSize, UDATA inlinedBytes)
+{
+	JFRState *jfrState = &currentThread->javaVM->jfrState;
+
+	if (succeeded) {
+		VM_AtomicSupport::add(&jfrState->compiledMethodCount, 1);
+	}
+
+	/* Compilation threads may call this while holding JIT locks, so never block for VM access here. */
+	if (J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)) {
+		return;
+	}
+
+	J9JFRCompilation *jfrEvent = (J9JFRCompilation *)reserveBuffer(currentThread, sizeof(J9JFRCompilation));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_COMPILATION);
+		jfrEvent->duration = jfrEvent->startTicks - startTicks;
+		jfrEvent->startTicks = startTicks;
+		jfrEvent->method = method;
+		jfrEvent->compileID = VM_AtomicSupport::add(&jfrState->compilationCount, 1);
+		jfrEvent->compileLevel = compileLevel;
+		jfrEvent->succeeded = succeeded;
+		jfrEvent->isOSR = isOSR;
+		jfrEvent->codeSize = codeSize;
+		jfrEvent->inlinedBytes = inlinedBytes;
+	}
+}
+
+void
+jfrDeoptimization(J9VMThread *currentThread, J9Method *method, UDATA bytecodeIndex, UDATA reason)
+{
+	J9JFRDeoptimization *jfrEvent = (J9JFRDeoptimization *)reserveBufferWithStackTrace(currentThread, currentThread, J9JFR_EVENT_TYPE_DEOPTIMIZATION, sizeof(*jfrEvent));
+	if (NULL != jfrEvent) {
+		jfrEvent->method = method;
+		jfrEvent->bytecodeIndex = bytecodeIndex;
+		jfrEvent->reason = reason;
+	}
+}
+
+/**
+ * Fill in a CodeCacheFull or CodeCacheStatistics event from the JIT code cache segments.
+ * Each segment is allocated from both ends, so its free space is the space between the
+ * warm and cold allocation pointers (see getMemoryUsageHelper in mgmtmemory.cpp).
+ *
+ * @param vm[in] the J9JavaVM
+ * @param jfrEvent[in] the event to fill in
+ */
+static void
+jfrFillCodeCacheStatistics(J9JavaVM *vm, J9JFRCodeCacheStatistics *jfrEvent)
+{
+	J9JITConfig *jitConfig = vm->jitConfig;
+	J9MemorySegmentList *segList = jitConfig->codeCacheList;
+	U_64 startAddress = U_64_MAX;
+	U_64 committedTopAddress = 0;
+	U_64 usedBytes = 0;
+	U_64 reservedBytes = (U_64)jitConfig->codeCacheTotalKB * 1024;
+
+	omrthread_monitor_enter(segList->segmentMutex);
+	for (J9MemorySegment *seg = segList->nextSegment; NULL != seg; seg = seg->nextSegment) {
+		UDATA warmAlloc = (UDATA)seg->heapBase;
+		UDATA coldAlloc = (UDATA)seg->heapTop;
+		UDATA *mccCodeCache = *((UDATA **)seg->heapBase);
+		if (NULL != mccCodeCache) {
+			warmAlloc = (UDATA)jitConfig->codeCacheWarmAlloc(mccCodeCache);
+			coldAlloc = (UDATA)jitConfig->codeCacheColdAlloc(mccCodeCache);
+		}
+		usedBytes += seg->size - (coldAlloc - warmAlloc);
+		startAddress = OMR_MIN(startAddress, (U_64)(UDATA)seg->heapBase);
+		committedTopAddress = OMR_MAX(committedTopAddress, (U_64)(UDATA)seg->heapTop);
+	}
+	omrthread_monitor_exit(segList->segmentMutex);
+
+	if (U_64_MAX == startAddress) {
+		startAddress = 0;
+	}
+	jfrEvent->startAddress = startAddress;
+	jfrEvent->committedTopAddress = committedTopAddress;
+	jfrEvent->reservedTopAddress = startAddress + reservedBytes;
+	jfrEvent->methodCount = vm->jfrState.compiledMethodCount;
+	jfrEvent->unallocatedCapacity = (reservedBytes > usedBytes) ? (reservedBytes - usedBytes) : 0;
+	jfrEvent->fullCount = vm->jfrState.codeCacheFullCount;
+}
+
+void
+jfrCodeCacheFull(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	VM_AtomicSupport::add(&vm->jfrState.codeCacheFullCount, 1);
+
+	/* The code cache manager may hold its mutex here, so never block for VM access. */
+	if (J9_ARE_NO_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)) {
+		return;
+	}
+
+	J9JFRCodeCacheStatistics *jfrEvent = (J9JFRCodeCacheStatistics *)reserveBuffer(currentThread, sizeof(J9JFRCodeCacheStatistics));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_CODE_CACHE_FULL);
+		jfrFillCodeCacheStatistics(vm, jfrEvent);
+	}
+}
+
 jint
 initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 {
@@ -835,6 +1107,7 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	OMRPORT_ACCESS_FROM_J9PORT(PORTLIB);
 	jint rc = JNI_ERR;
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
 
 	U_8 *buffer = NULL;
 	UDATA timeSuccess = 0;
@@ -894,6 +1167,24 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	if (0 != (vm->memoryManagerFunctions->j9gc_register_jfr_hooks(vm))) {
 		goto fail;
 	}
+	/* The allocation sampling hook is disabled before bootstrap unless it was reserved,
+	 * so a recording started late may have to go without allocation samples.
+	 */
+	if (0 == (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSampled, OMR_GET_CALLSITE(), NULL)) {
+		UDATA previousInterval = vm->memoryManagerFunctions->j9gc_get_allocation_sampling_interval(vm);
+		vm->jfrState.isAllocationSamplingEnabled = TRUE;
+		vm->jfrState.previousAllocationSamplingInterval = previousInterval;
+		vm->jfrState.allocationSampleWindowStart = 0;
+		vm->jfrState.allocationSampleWindowCount = 0;
+		/* The interval is shared with JVMTI (SetHeapSamplingInterval); keep an agent's interval if it is
+		 * already short enough, the per second sample limit applies either way.
+		 */
+		if (previousInterval > J9JFR_ALLOCATION_SAMPLING_INTERVAL) {
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9JFR_ALLOCATION_SAMPLING_INTERVAL);
+		}
+	} else {
+		Trc_VM_initializeJFR_allocationSamplingUnavailable();
+	}
 
 	/* Allocate constantEvents. */
 	vm->jfrState.constantEvents = j9mem_allocate_memory(sizeof(JFRConstantEvents), J9MEM_CATEGORY_JFR);
@@ -902,6 +1193,14 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	}
 	memset(vm->jfrState.constantEvents, 0, sizeof(JFRConstantEvents));
 
+	/* Allocate the global stack trace table. */
+	vm->jfrState.stackTraceTable = (J9JFRStackTrace **)j9mem_allocate_memory(J9JFR_STACKTRACE_TABLE_SIZE * sizeof(J9JFRStackTrace *), J9MEM_CATEGORY_JFR);
+	if (NULL == vm->jfrState.stackTraceTable) {
+		goto fail;
+	}
+	memset(vm->jfrState.stackTraceTable, 0, J9JFR_STACKTRACE_TABLE_SIZE * sizeof(J9JFRStackTrace *));
+	vm->jfrState.stackTraceCount = 0;
+
 	/* Allocate global data. */
 	buffer = (U_8 *)j9mem_allocate_memory(J9JFR_GLOBAL_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
 	if (NULL == buffer) {
@@ -987,6 +1286,7 @@ tearDownJFR(J9JavaVM *vm)
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	J9VMThread *currentThread = currentVMThread(vm);
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
 
 	Assert_VM_mustHaveVMAccess(currentThread);
 
@@ -1029,10 +1329,25 @@ tearDownJFR(J9JavaVM *vm)
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, NULL);
 	/* Deregister GC-related hooks via gc_base */
 	vm->memoryManagerFunctions->j9gc_deregister_jfr_hooks(vm);
+	(*gcHooks)->J9HookUnregister(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSampled, NULL);
+	if (vm->jfrState.isAllocationSamplingEnabled) {
+		UDATA previousInterval = vm->jfrState.previousAllocationSamplingInterval;
+		/* Give back the interval in effect before the recording, unless a JVMTI agent has changed it since. */
+		if ((previousInterval > J9JFR_ALLOCATION_SAMPLING_INTERVAL)
+			&& (J9JFR_ALLOCATION_SAMPLING_INTERVAL == vm->memoryManagerFunctions->j9gc_get_allocation_sampling_interval(vm))
+		) {
+			vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, previousInterval);
+		}
+		vm->jfrState.isAllocationSamplingEnabled = FALSE;
+	}
 
 	/* Free global data */
 	VM_JFRConstantPoolTypes::freeJFRConstantEvents(vm);
 
+	jfrResetStackTraces(vm);
+	j9mem_free_memory(vm->jfrState.stackTraceTable);
+	vm->jfrState.stackTraceTable = NULL;
+
 	j9mem_free_memory((void*)vm->jfrBuffer.bufferStart);
 	memset(&vm->jfrBuffer, 0, sizeof(vm->jfrBuffer));
 	if (NULL != vm->jfrBufferMutex) {
@@ -1234,6 +1549,20 @@ jfrThreadContextSwitchRate(J9VMThread *currentThread)
 	}
 }
 
+static void
+jfrCodeCacheStatistics(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (NULL != vm->jitConfig) {
+		J9JFRCodeCacheStatistics *jfrEvent = (J9JFRCodeCacheStatistics *)reserveBuffer(currentThread, sizeof(J9JFRCodeCacheStatistics));
+		if (NULL != jfrEvent) {
+			initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_CODE_CACHE_STATISTICS);
+			jfrFillCodeCacheStatistics(vm, jfrEvent);
+		}
+	}
+}
+
 static void
 jfrThreadStatistics(J9VMThread *currentThread)
 {
@@ -1273,6 +1602,7 @@ jfrSamplingThreadProc(void *entryArg)
 				if (0 == (count % 1000)) { // 10 seconds
 					J9SignalAsyncEvent(vm, NULL, vm->jfrThreadCPULoadAsyncKey);
 					jfrThreadContextSwitchRate(currentThread);
+					jfrCodeCacheStatistics(currentThread);
 				}
 				internalReleaseVMAccess(currentThread);
 				omrthread_monitor_enter(vm->jfrSamplerMutex);
@@ -1310,6 +1640,7 @@ jfrDump(J9VMThread *currentThread, BOOLEAN finalWrite)
 	/* Flush all the thread buffers and write out the global buffer. */
 	flushAllThreadBuffers(currentThread, finalWrite);
 	writeOutGlobalBuffer(currentThread, finalWrite, true);
+	jfrResetStackTraces(currentThread->javaVM);
 }
 
 static UDATA
@@ -320,6 +320,8 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 		hashTableFree(vmThread->utfCache);
 	}
 
+	j9mem_free_memory(vmThread->internStringCache);
+
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	if (NULL != vm->javaOffloadSwitchOffWithReasonFunc) {
 		vmThread->javaOffloadState = 0;
@@ -1692,9 +1692,13 @@ initializeClassPathEntry (J9JavaVM * javaVM, J9ClassPathEntry *cpEntry)
 		zipFile = j9mem_allocate_memory((UDATA) sizeof(*zipFile), J9MEM_CATEGORY_CLASSES);
 		if (NULL != zipFile) {
 			I_32 rc = 0;
+			I_32 flags = ZIP_FLAG_OPEN_CACHE | ZIP_FLAG_BOOTSTRAP;
 
+			if (J9_ARE_ANY_BITS_SET(javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_MAP_BOOTSTRAP_JARS)) {
+				flags |= ZIP_FLAG_MAP_FILE;
+			}
 			memset(zipFile, 0, sizeof(*zipFile));
-			rc = zipFunctions->zip_openZipFile(VMI, (char *)cpEntry->path, zipFile, ZIP_FLAG_OPEN_CACHE | ZIP_FLAG_BOOTSTRAP);
+			rc = zipFunctions->zip_openZipFile(VMI, (char *)cpEntry->path, zipFile, flags);
 			if (0 == rc) {
 				/* Save the zipFile */
 				cpEntry->extraInfo = zipFile;
@@ -4474,6 +4478,16 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA enableMapBootstrapJars = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXENABLEMAPBOOTSTRAPJARS, NULL);
+		IDATA disableMapBootstrapJars = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXDISABLEMAPBOOTSTRAPJARS, NULL);
+		if (enableMapBootstrapJars > disableMapBootstrapJars) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_MAP_BOOTSTRAP_JARS;
+		} else if (enableMapBootstrapJars < disableMapBootstrapJars) {
+			vm->extendedRuntimeFlags3 &= ~(UDATA)J9_EXTENDED_RUNTIME3_MAP_BOOTSTRAP_JARS;
+		}
+	}
+
 	/* -Xbootclasspath and -Xbootclasspath/p are not supported from Java 9 onwards */
 	if (J2SE_VERSION(vm) >= J2SE_V11) {
 		PORT_ACCESS_FROM_JAVAVM(vm);
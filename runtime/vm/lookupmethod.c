@@ -35,6 +35,8 @@
 #define APPEND_SIG "(Ljava/lang/StringBuilder;)Ljava/lang/StringBuilder;"
 #define NEW_SIG "(Ljava/lang/CharSequence;)Ljava/lang/StringBuilder;"
 #define DEFAULT_INTERFACE_RESOLVE_ARRAY_SIZE	10
+/* Minimum number of unsorted methods for which a RAM class gets a method lookup index */
+#define J9_METHOD_LOOKUP_INDEX_THRESHOLD 8
 
 /**
  * Holds information about interface method resolution:
@@ -73,6 +75,93 @@ searchClassForMethod(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, U
 	return searchClassForMethodCommon(clazz, name, nameLength,sig, sigLength, FALSE);
 }
 
+/**
+ * Hash a method name and signature for the method lookup index.
+ *
+ * @param name[in] the name of the method
+ * @param nameLength[in] the length of the method name
+ * @param sig[in] the signature of the method
+ * @param sigLength[in] the length of the method signature
+ *
+ * @returns the hash value
+ */
+static VMINLINE U_32
+methodLookupIndexHash(U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength)
+{
+	U_32 hash = (U_32) nameLength;
+	UDATA i = 0;
+
+	for (i = 0; i < nameLength; i++) {
+		hash = (hash * 31) + name[i];
+	}
+	for (i = 0; i < sigLength; i++) {
+		hash = (hash * 31) + sig[i];
+	}
+	return hash;
+}
+
+/**
+ * Compute the number of buckets for a method lookup index: the smallest power of
+ * two which keeps the load factor at or below one half.
+ *
+ * @param romMethodCount[in] the number of methods to index
+ *
+ * @returns the bucket count
+ */
+static U_32
+methodLookupIndexBucketCount(U_32 romMethodCount)
+{
+	U_32 bucketCount = 1;
+
+	while (bucketCount < (romMethodCount * 2)) {
+		bucketCount <<= 1;
+	}
+	return bucketCount;
+}
+
+UDATA
+methodLookupIndexSize(J9ROMClass *romClass)
+{
+	U_32 romMethodCount = romClass->romMethodCount;
+	UDATA size = 0;
+
+	/* Sorted methods are already searched by bisection, and short method lists are searched faster linearly. */
+	if ((romMethodCount >= J9_METHOD_LOOKUP_INDEX_THRESHOLD)
+		&& (romMethodCount < U_16_MAX)
+		&& J9_ARE_NO_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)
+	) {
+		size = sizeof(J9MethodLookupIndex) + (methodLookupIndexBucketCount(romMethodCount) * sizeof(U_16));
+	}
+	return size;
+}
+
+void
+initializeMethodLookupIndex(J9Class *ramClass, J9MethodLookupIndex *index)
+{
+	J9ROMClass *romClass = ramClass->romClass;
+	J9ROMMethod *romMethod = J9ROMCLASS_ROMMETHODS(romClass);
+	U_16 *buckets = J9METHODLOOKUPINDEX_BUCKETS(index);
+	U_32 romMethodCount = romClass->romMethodCount;
+	U_32 i = 0;
+
+	index->romClass = romClass;
+	index->mask = methodLookupIndexBucketCount(romMethodCount) - 1;
+
+	for (i = 0; i < romMethodCount; i++) {
+		J9UTF8 *nameUTF = J9ROMMETHOD_NAME(romMethod);
+		J9UTF8 *sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+		U_32 slot = methodLookupIndexHash(J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF)) & index->mask;
+
+		while (0 != buckets[slot]) {
+			slot = (slot + 1) & index->mask;
+		}
+		buckets[slot] = (U_16)(i + 1);
+		romMethod = nextROMMethod(romMethod);
+	}
+
+	ramClass->methodLookupIndex = index;
+}
+
 /**
  * Search method in target class
  * Note: this method is also used for searching enclosing methods to skip validation required by javaLookupMethod.
@@ -95,7 +184,32 @@ searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 *
 
 	if (romMethodCount != 0) {
 		J9Method * methods = clazz->ramMethods;
-		if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
+		J9MethodLookupIndex * index = clazz->methodLookupIndex;
+		if ((NULL != index) && !partialMatch && (index->romClass == romClass)) {
+			/*
+			 * This path probes the hash index built when the RAM class was created. The index can not
+			 * be used for partial signatures since the hash covers the full signature.
+			 */
+			U_16 * buckets = J9METHODLOOKUPINDEX_BUCKETS(index);
+			U_32 slot = methodLookupIndexHash(name, nameLength, sig, sigLength) & index->mask;
+			UDATA probes = 0;
+
+			while (0 != buckets[slot]) {
+				J9Method * candidate = &(methods[buckets[slot] - 1]);
+				J9ROMMethod * romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(candidate);
+				J9UTF8 * nameUTF = J9ROMMETHOD_NAME(romMethod);
+				J9UTF8 * sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+
+				probes += 1;
+				if (0 == compareMethodNameAndSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF))) {
+					searchResult = candidate;
+					break;
+				}
+				slot = (slot + 1) & index->mask;
+			}
+
+			Trc_VM_searchClass_useMethodLookupIndex(methods, probes, searchResult);
+		} else if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
 			IDATA startIndex = 0;
 			IDATA endIndex = (romMethodCount - 1);
 			IDATA midIndex = endIndex/2;
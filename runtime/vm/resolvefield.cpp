@@ -768,6 +768,9 @@ createClassHotFieldsInfo(J9JavaVM *javaVM, J9Class* clazz, uint8_t fieldOffset,
 			hotFieldsInfo->hotFieldOffset1 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset2 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset3 = U_8_MAX;
+			hotFieldsInfo->colocationBackoff = 0;
+			hotFieldsInfo->colocationHits = 0;
+			hotFieldsInfo->colocationMisses = 0;
 			hotFieldsInfo->classLoader = clazz->classLoader;
 			clazz->hotFieldsInfo = hotFieldsInfo;
 		}
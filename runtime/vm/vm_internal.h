@@ -443,6 +443,28 @@ convertCStringToByteArray(J9VMThread *currentThread, const char *byteArray);
 U_64 *
 convertToNativeArgArray(J9VMThread *currentThread, j9object_t argArray, U_64 *javaArgs);
 
+/* ------------------- lookupmethod.c ----------------- */
+
+/**
+ * Compute the size of the method lookup index for a RAM class.
+ *
+ * @param romClass[in] the ROM class being instantiated
+ *
+ * @returns the number of bytes required for the index, or 0 if the class does not need one
+ */
+UDATA
+methodLookupIndexSize(J9ROMClass *romClass);
+
+/**
+ * Fill in the method lookup index for a RAM class. The RAM methods must be
+ * in ROM method order, as they are when the RAM class is created.
+ *
+ * @param ramClass[in] the RAM class
+ * @param index[in] zeroed memory of the size returned by methodLookupIndexSize()
+ */
+void
+initializeMethodLookupIndex(J9Class *ramClass, J9MethodLookupIndex *index);
+
 /* ------------------- romclasses.c ----------------- */
 
 /**
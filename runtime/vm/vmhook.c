@@ -125,6 +125,7 @@ hookAboutToBootstrapEvent(J9HookInterface **hook, UDATA eventNum, void *voidEven
 	J9HookInterface **vmHook = getVMHookInterface(vm);
 	J9HookInterface **gcHook = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
 	BOOLEAN debugModeRequested = FALSE;
+	BOOLEAN allocationSamplingReservedForJFROnly = FALSE;
 
 	/* these hooks must be reserved by now. Attempt to disable them so that they're in a well-known state after this */
 	(*vmHook)->J9HookDisable(vmHook, J9HOOK_VM_MONITOR_CONTENDED_EXIT);
@@ -136,8 +137,23 @@ hookAboutToBootstrapEvent(J9HookInterface **hook, UDATA eventNum, void *voidEven
 		omrthread_monitor_exit(vm->runtimeFlagsMutex);
 	}
 
+#if defined(J9VM_OPT_JFR)
+	/* JFR registers for allocation samples when the recording starts, which is after bootstrap.
+	 * Its listener only records the sample, so unlike an agent's it does not need safepoint OSR off.
+	 */
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_JFR_ENABLED)) {
+		/* gcHook points at the GC hook interface structure itself */
+		if (!J9_EVENT_IS_HOOKED_OR_RESERVED(*gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)) {
+			allocationSamplingReservedForJFROnly = TRUE;
+		}
+		(*gcHook)->J9HookReserve(gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING);
+	}
+#endif /* defined(J9VM_OPT_JFR) */
+
 	/* The sampled object allocate hook disables safepoint OSR */
-	if ((*gcHook)->J9HookDisable(gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)) {
+	if (!allocationSamplingReservedForJFROnly
+		&& (*gcHook)->J9HookDisable(gcHook, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)
+	) {
 		omrthread_monitor_enter(vm->runtimeFlagsMutex);
 		vm->extendedRuntimeFlags &= ~(UDATA)(J9_EXTENDED_RUNTIME_OSR_SAFE_POINT| J9_EXTENDED_RUNTIME_OSR_SAFE_POINT_FV);
 		omrthread_monitor_exit(vm->runtimeFlagsMutex);
@@ -131,6 +131,7 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 	J9ZipFile *zipFile = (J9ZipFile *)vmizipFile;
 	J9ZipCachePool *zipCachePool = j9vmi->javaVM->zipCachePool;
 	I_32 result = 0;
+	U_32 openFlags = J9_ARE_ANY_BITS_SET(flags, ZIP_FLAG_MAP_FILE) ? J9ZIP_OPEN_MAP_FILE : J9ZIP_OPEN_NO_FLAGS;
 	PORT_ACCESS_FROM_JAVAVM(j9vmi->javaVM);
 #if defined(J9VM_OPT_SHARED_CLASSES)
 	JNIEnv *env;
@@ -150,7 +151,7 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 		/* open the zip file but do not call zip_readCacheData().
 		 * we need to search data in shared class cache before reading it from disk.
 		 */
-		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_NO_FLAGS);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, openFlags);
 		if (result) {
 			if (zipCachePool) {
 				TRIGGER_J9HOOK_VM_ZIP_LOAD(zipCachePool->hookInterface, PORTLIB, zipCachePool->userData, (const struct J9ZipFile*)zipFile, J9ZIP_STATE_OPEN, (U_8*)filename, result);
@@ -233,7 +234,7 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 		}
 	}
 	else {
-		result = zip_openZipFile(PORTLIB, filename, zipFile, NULL, J9ZIP_OPEN_NO_FLAGS);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, NULL, openFlags);
 	}
 	EXIT();
 	return result;
@@ -246,9 +247,9 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 			zipCachePool = zipCachePool_new(PORTLIB, vm);
 			vm->zipCachePool = zipCachePool;
 		}
-		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_READ_CACHE_DATA);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, vm->zipCachePool, J9ZIP_OPEN_READ_CACHE_DATA | openFlags);
 	} else {
-		result = zip_openZipFile(PORTLIB, filename, zipFile, NULL, J9ZIP_OPEN_NO_FLAGS);
+		result = zip_openZipFile(PORTLIB, filename, zipFile, NULL, openFlags);
 	}
 	return result;
 
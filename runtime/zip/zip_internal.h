@@ -138,6 +138,15 @@ typedef struct J9ZipCacheTraversal {
 	J9ZipFileEntry *fileRecordEntry;
 } J9ZipCacheTraversal;
 
+/**
+* @brief
+* @param zipCache
+* @return BOOLEAN
+*/
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache);
+
+
 /**
 * @brief
 * @param zipCache
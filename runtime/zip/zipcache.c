@@ -45,13 +45,17 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
 #define NOT_FOUND	((UDATA) (~0))
 #define OFFSET_MASK	(~ISCLASS_BIT)
 #define	IMPLICIT_ENTRY	(~ISCLASS_BIT)
+#define ISDIR_HASH_BIT	UDATA_TOP_BIT
+
+/* The index is kept at most two thirds full so probe sequences stay short. */
+#define ZIP_INDEX_MIN_SLOTS	16
 
 
 void zipCache_freeChunk (J9PortLibrary * portLib, J9ZipChunkHeader *chunk);
@@ -66,6 +70,15 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA zipCache_indexSlotCount(UDATA entryCount);
+static UDATA zipCache_indexSize(UDATA entryCount);
+static UDATA zipCache_hashName(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir);
+static void zipCache_indexInsert(J9ZipCacheIndex *index, J9ZipDirEntry *parent, void *entry, UDATA hash);
+static void zipCache_indexDirectory(J9ZipCacheEntry *zce, J9ZipCacheIndex *index, J9ZipDirEntry *dirEntry);
+static void zipCache_populateIndex(J9ZipCacheEntry *zce, J9ZipCacheIndex *index, UDATA slotCount);
+static void zipCache_freeIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
+static J9ZipFileEntry *zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static J9ZipDirEntry *zipCache_findDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -246,6 +259,8 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 				separately rather than being reserved from the chunk */
 			sizeRequired += strlen((const char*)zipFileName) + 1;
 		}
+		/* the copy carries its own lookup index so later JVMs don't have to rebuild it */
+		sizeRequired += zipCache_indexSize(zce->entryCount);
 	}
 	return sizeRequired;
 }
@@ -358,6 +373,18 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 
+	/* Build the lookup index inside the copied data. All references in the index are
+	 * self relative, so it remains valid wherever the shared cache is attached. */
+	if (0 != zce->entryCount) {
+		UDATA indexBytes = zipCache_indexSize(zce->entryCount);
+		char *unused;
+		J9ZipCacheIndex *index = (J9ZipCacheIndex *)zipCache_reserveEntry(zce, chunk, indexBytes, 0, &unused);
+
+		if (NULL != index) {
+			zipCache_populateIndex(zce, index, zipCache_indexSlotCount(zce->entryCount));
+		}
+	}
+
 	/* Null the currentChunk so it can't be free'd */
 	ZIP_SRP_SET_TO_NULL(zce->currentChunk);
 
@@ -570,6 +597,9 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 		((elementOffset & OFFSET_MASK) == IMPLICIT_ENTRY))
 		return FALSE;
 
+	/* The index only describes the cache as it was when it was built */
+	zipCache_freeIndex(portLib, zce);
+
 	dirEntry = &zce->root;
 
 	curName = elementName;
@@ -698,7 +728,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_findFileEntry(zce, dirEntry, curName, curSize, isClass);
 			if (fileEntry) {
 				return fileEntry->zipFileOffset & OFFSET_MASK;
 			}
@@ -710,7 +740,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 		/* If we got here, we're looking at a prefix which ends with '/', or searchDirList is TRUE */
 		/* Treat that prefix as a subdirectory.  It will exist if elementName was added before. */
 
-		dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+		dirEntry = zipCache_findDirEntry(zce, dirEntry, curName, curSize, isClass);
 		if (!dirEntry)
 			return NOT_FOUND;
 		curName += prefixSize;
@@ -742,6 +772,8 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 		return;
 	}
 
+	zipCache_freeIndex(portLib, zce);
+
 	chunk2 = (J9ZipChunkHeader *)(((U_8 *)zce) - sizeof(J9ZipChunkHeader));
 	if (((UDATA)(zipFileName - (U_8 *)chunk2)) >= ACTUAL_CHUNK_SIZE)   {
 		/* HACK!!  zce->info.zipFileName points outside the first chunk, therefore it was allocated
@@ -812,6 +844,7 @@ J9ZipDirEntry *zipCache_addToDirList(J9PortLibrary * portLib, J9ZipCacheEntry *z
 	entry->zipFileOffset = IMPLICIT_ENTRY | (isClass ? ISCLASS_BIT : 0);
 	memcpy(name, namePtr, nameSize);
 	/* name[nameSize] is already zero (NUL) */
+	zce->entryCount += 1;
 	return entry;
 }
 
@@ -864,6 +897,7 @@ haveEntry:
 	memcpy(name, namePtr, nameSize);
 	entry->nameLength = nameSize;
 	entry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
+	zce->entryCount += 1;
 	return entry;
 }
 
@@ -998,6 +1032,242 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 
 
 
+/* Returns the number of slots used to index entryCount elements (always a power of two). */
+
+static UDATA
+zipCache_indexSlotCount(UDATA entryCount)
+{
+	UDATA slotCount = ZIP_INDEX_MIN_SLOTS;
+
+	while ((slotCount * 2) < (entryCount * 3)) {
+		slotCount *= 2;
+	}
+	return slotCount;
+}
+
+
+
+/* Returns the number of bytes needed for an index of entryCount elements. */
+
+static UDATA
+zipCache_indexSize(UDATA entryCount)
+{
+	return sizeof(J9ZipCacheIndex) + (zipCache_indexSlotCount(entryCount) * sizeof(J9ZipCacheIndexSlot));
+}
+
+
+
+/* Hashes an element name together with its parent directory and kind. The parent */
+/* is hashed as an offset from the cache entry so that the hash is unaffected by */
+/* where a copied cache is mapped. Directory hashes have ISDIR_HASH_BIT set. */
+
+static UDATA
+zipCache_hashName(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir)
+{
+	UDATA hash = (UDATA)2166136261U ^ ((UDATA)parent - (UDATA)zce);
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash ^ (U_8)namePtr[i]) * 16777619;
+	}
+	hash ^= (hash >> 15);
+	if (isClass) {
+		hash = ~hash;
+	}
+	if (isDir) {
+		return hash | ISDIR_HASH_BIT;
+	}
+	return hash & ~ISDIR_HASH_BIT;
+}
+
+
+
+/* Adds entry to the index using linear probing. The index is never full. */
+
+static void
+zipCache_indexInsert(J9ZipCacheIndex *index, J9ZipDirEntry *parent, void *entry, UDATA hash)
+{
+	J9ZipCacheIndexSlot *slots = J9ZIPCACHEINDEX_SLOTS(index);
+	UDATA mask = index->slotCount - 1;
+	UDATA i = hash & mask;
+
+	while (0 != slots[i].entry) {
+		i = (i + 1) & mask;
+	}
+	slots[i].hash = hash;
+	ZIP_SRP_SET(slots[i].entry, entry);
+	ZIP_SRP_SET(slots[i].parent, parent);
+}
+
+
+
+/* Adds the files and subdirectories of dirEntry, recursively, to the index. */
+
+static void
+zipCache_indexDirectory(J9ZipCacheEntry *zce, J9ZipCacheIndex *index, J9ZipDirEntry *dirEntry)
+{
+	J9ZipFileRecord *record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
+	J9ZipDirEntry *subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *);
+	UDATA i;
+
+	while (record) {
+		J9ZipFileEntry *fileEntry = record->entry;
+		for (i = 0; i < record->entryCount; i++) {
+			BOOLEAN isClass = (fileEntry->zipFileOffset & ISCLASS_BIT) != 0;
+			UDATA hash = zipCache_hashName(zce, dirEntry, J9ZIPFILEENTRY_NAME(fileEntry), fileEntry->nameLength, isClass, FALSE);
+			zipCache_indexInsert(index, dirEntry, fileEntry, hash);
+			fileEntry = J9ZIPFILEENTRY_NEXT(fileEntry);
+		}
+		record = ZIP_SRP_GET(record->next, J9ZipFileRecord *);
+	}
+
+	while (subDir) {
+		const char *name = J9ZIPDIRENTRY_NAME(subDir);
+		BOOLEAN isClass = (subDir->zipFileOffset & ISCLASS_BIT) != 0;
+		UDATA hash = zipCache_hashName(zce, dirEntry, name, strlen(name), isClass, TRUE);
+		zipCache_indexInsert(index, dirEntry, subDir, hash);
+		zipCache_indexDirectory(zce, index, subDir);
+		subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *);
+	}
+}
+
+
+
+/* Fills in the zeroed memory at index with every element of zce and attaches it to zce. */
+
+static void
+zipCache_populateIndex(J9ZipCacheEntry *zce, J9ZipCacheIndex *index, UDATA slotCount)
+{
+	index->slotCount = slotCount;
+	zipCache_indexDirectory(zce, index, &zce->root);
+	ZIP_SRP_SET(zce->index, index);
+}
+
+
+
+/**
+ * Builds a hash index over every file and directory in the zip cache so that
+ * zipCache_findElement() does not need to walk the directory lists. The index
+ * is discarded if the cache is subsequently modified by zipCache_addElement().
+ * Failure to allocate the index is not an error; lookups fall back to searching
+ * the lists.
+ *
+ * @param[in] zipCache the zip cache
+ *
+ * @return TRUE if the cache is indexed, FALSE otherwise
+ */
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	J9ZipCacheEntry *zce = zci->entry;
+	J9ZipCacheIndex *index;
+	UDATA indexBytes;
+	PORT_ACCESS_FROM_PORT(zipCache->portLib);
+
+	if (zce->index) {
+		return TRUE;
+	}
+	if ((0 == zce->entryCount) || !zce->currentChunk) {
+		/* nothing to index, or a copied cache which was built without an index */
+		return FALSE;
+	}
+
+	indexBytes = zipCache_indexSize(zce->entryCount);
+	index = (J9ZipCacheIndex *)j9mem_allocate_memory(indexBytes, J9MEM_CATEGORY_VM_JCL);
+	if (NULL == index) {
+		return FALSE;
+	}
+	memset(index, 0, indexBytes);
+	zipCache_populateIndex(zce, index, zipCache_indexSlotCount(zce->entryCount));
+	return TRUE;
+}
+
+
+
+/* Frees the index of a cache which has not been copied. */
+
+static void
+zipCache_freeIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
+{
+	J9ZipCacheIndex *index = ZIP_SRP_GET(zce->index, J9ZipCacheIndex *);
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	if ((NULL != index) && zce->currentChunk) {
+		ZIP_SRP_SET_TO_NULL(zce->index);
+		j9mem_free_memory(index);
+	}
+}
+
+
+
+/* Finds the file entry named namePtr[0..nameSize-1] with the specified isClass */
+/* value in dirEntry, using the index if the cache has one. */
+
+static J9ZipFileEntry *
+zipCache_findFileEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	J9ZipCacheIndex *index = ZIP_SRP_GET(zce->index, J9ZipCacheIndex *);
+
+	if (NULL != index) {
+		J9ZipCacheIndexSlot *slots = J9ZIPCACHEINDEX_SLOTS(index);
+		UDATA mask = index->slotCount - 1;
+		UDATA hash = zipCache_hashName(zce, dirEntry, namePtr, nameSize, isClass, FALSE);
+		UDATA i = hash & mask;
+
+		while (0 != slots[i].entry) {
+			if ((slots[i].hash == hash) && (ZIP_SRP_GET(slots[i].parent, J9ZipDirEntry *) == dirEntry)) {
+				J9ZipFileEntry *entry = ZIP_SRP_GET(slots[i].entry, J9ZipFileEntry *);
+				if ((entry->nameLength == nameSize)
+					&& !memcmp(J9ZIPFILEENTRY_NAME(entry), namePtr, nameSize)
+					&& (isClass == ((entry->zipFileOffset & ISCLASS_BIT) != 0))
+				) {
+					return entry;
+				}
+			}
+			i = (i + 1) & mask;
+		}
+		return NULL;
+	}
+	return zipCache_searchFileList(dirEntry, namePtr, nameSize, isClass);
+}
+
+
+
+/* Finds the directory entry named namePtr[0..nameSize-1] with the specified */
+/* isClass value in dirEntry, using the index if the cache has one. */
+
+static J9ZipDirEntry *
+zipCache_findDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	J9ZipCacheIndex *index = ZIP_SRP_GET(zce->index, J9ZipCacheIndex *);
+
+	if (NULL != index) {
+		J9ZipCacheIndexSlot *slots = J9ZIPCACHEINDEX_SLOTS(index);
+		UDATA mask = index->slotCount - 1;
+		UDATA hash = zipCache_hashName(zce, dirEntry, namePtr, nameSize, isClass, TRUE);
+		UDATA i = hash & mask;
+
+		while (0 != slots[i].entry) {
+			if ((slots[i].hash == hash) && (ZIP_SRP_GET(slots[i].parent, J9ZipDirEntry *) == dirEntry)) {
+				J9ZipDirEntry *entry = ZIP_SRP_GET(slots[i].entry, J9ZipDirEntry *);
+				const char *name = J9ZIPDIRENTRY_NAME(entry);
+				if (!strncmp(name, namePtr, nameSize)
+					&& !name[nameSize]
+					&& (isClass == ((entry->zipFileOffset & ISCLASS_BIT) != 0))
+				) {
+					return entry;
+				}
+			}
+			i = (i + 1) & mask;
+		}
+		return NULL;
+	}
+	return zipCache_searchDirList(dirEntry, namePtr, nameSize, isClass);
+}
+
+
+
 /** 
  * Searches for a directory named elementName in zipCache and if found provides 
  * a handle to it that can be used to enumerate through all of the directory's files.
@@ -101,6 +101,8 @@ static I_32 getZipEntryUsingDirectory(J9PortLibrary *portLib, J9ZipFile *zipFile
 		const char *fileName, IDATA fileNameLength, BOOLEAN readDataPointer);
 static BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue);
 static BOOLEAN isOutside4Gig(I_64 value);
+static void mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile);
+static U_8 *getMappedData(J9ZipFile *zipFile, U_64 offset, U_64 length);
 
 #if defined(J9VM_THR_PREEMPTIVE)
 #include "omrthread.h"
@@ -216,6 +218,49 @@ isOutside4Gig(I_64 value) {
 	return (value < 0) || (value > UINT32_MAX);
 }
 
+/**
+ * Map the whole of zipFile read-only. Failure to map is not an error, the
+ * data is then read from the file as usual.
+ * @param[in] portLib the port library
+ * @param[in] zipFile the open zip file
+ */
+static void
+mapZipFile(J9PortLibrary *portLib, J9ZipFile *zipFile)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	I_64 fileLength = 0;
+
+	if (J9_ARE_NO_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)) {
+		return;
+	}
+	fileLength = j9file_flength(zipFile->fd);
+	if ((fileLength > 0) && ((U_64)fileLength <= (U_64)UDATA_MAX)) {
+		J9MmapHandle *handle = j9mmap_map_file(zipFile->fd, 0, (UDATA)fileLength, (const char *)zipFile->filename, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+		if ((NULL != handle) && (NULL == handle->pointer)) {
+			j9mmap_unmap_file(handle);
+			handle = NULL;
+		}
+		zipFile->mmapHandle = handle;
+	}
+}
+
+/**
+ * @param zipFile the zip file
+ * @param offset offset of the data in the file
+ * @param length length of the data
+ * @return a pointer to the data in the mapping of zipFile, or NULL if the file is not mapped or the range is not within the mapping
+ */
+static VMINLINE U_8 *
+getMappedData(J9ZipFile *zipFile, U_64 offset, U_64 length)
+{
+	J9MmapHandle *handle = (J9MmapHandle *)zipFile->mmapHandle;
+
+	if ((NULL != handle) && (offset <= handle->size) && (length <= (handle->size - offset))) {
+		return (U_8 *)handle->pointer + offset;
+	}
+	return NULL;
+}
+
 /*
 	Returns 0 on success or one of the following:
 			ZIP_ERR_UNSUPPORTED_FILE_TYPE
@@ -1382,6 +1427,11 @@ zip_releaseZipFile(J9PortLibrary* portLib, struct J9ZipFile* zipFile)
 	cachePool = zipFile->cachePool;
 	zipFile->fd = -1;
 
+	if (NULL != zipFile->mmapHandle) {
+		j9mmap_unmap_file((J9MmapHandle *)zipFile->mmapHandle);
+		zipFile->mmapHandle = NULL;
+	}
+
 	if (zipFile->cache && cachePool)  {
 		zipCachePool_release(cachePool, zipFile->cache);
 		zipFile->cache = NULL;
@@ -1573,6 +1623,10 @@ zip_readCacheData(J9PortLibrary * portLib, J9ZipFile *zipFile)
 		startCentralDir = (IDATA)((UDATA)endEntry.dirOffset);
 		zipCache_setStartCentralDir(zipFile->cache, startCentralDir);
 		result = zip_populateCache(portLib, zipFile, &endEntry, startCentralDir);
+		if (0 == result) {
+			/* An unindexed cache is still usable, lookups just search the directory lists */
+			zipCache_buildIndex(zipFile->cache);
+		}
 	}
 
 finished:
@@ -2015,6 +2069,12 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Stored) {
 		IDATA readResult = 0;
+		U_8 *mappedData = getMappedData(zipFile, entry->dataPointer, entry->compressedSize);
+		if (NULL != mappedData) {
+			memcpy(dataBuffer, mappedData, entry->compressedSize);
+			EXIT();
+			return 0;
+		}
 		/* No compression - just read the data in. */
 		if (zipFile->pointer != entry->dataPointer)  {
 			zipFile->pointer = (U_32) entry->dataPointer;
@@ -2037,6 +2097,7 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
 	if(entry->compressionMethod == ZIP_CM_Deflated) {
 		U_8* readBuffer;
+		U_8* mappedData = getMappedData(zipFile, entry->dataPointer, entry->compressedSize);
 
 		/* Read the file contents. */
 		if (entry->compressedSize < ZIP_WORK_BUFFER_SIZE) {
@@ -2051,6 +2112,13 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 				}
 			}
 		}
+		if (NULL != mappedData) {
+			/* Inflate straight from the mapping */
+			result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+			if(result)  goto finished;
+			EXIT();
+			return 0;
+		}
 		readBuffer = zdataalloc(&wb, 1, entry->compressedSize);
 		if(!readBuffer) {
 			result = ZIP_ERR_OUT_OF_MEMORY;
@@ -2096,6 +2164,38 @@ finished:
 	return result;
 }
 
+/**
+ *	Return a pointer to the data of a stored (uncompressed) zip entry without
+ *	copying it. This is only possible when zipFile was opened with
+ *	J9ZIP_OPEN_MAP_FILE; the data remains valid until zipFile is released and
+ *	must not be modified. Callers should fall back to @ref zip_getZipEntryData
+ *	when this function fails.
+ *
+ * @param[in] portLib the port library
+ * @param[in] zipFile the zip file being read from.
+ * @param[in] entry the zip entry
+ * @param[out] data set to the entry data on success
+ *
+ * @return 0 on success
+ * @return	ZIP_ERR_UNSUPPORTED_FILE_TYPE if the entry is compressed or the file is not mapped
+ * @return	ZIP_ERR_FILE_CORRUPT if the entry data is not within the file
+*/
+I_32
+zip_getZipEntryDataPointer(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* entry, U_8** data)
+{
+	U_8 *mappedData = NULL;
+
+	if ((NULL == zipFile->mmapHandle) || (ZIP_CM_Stored != entry->compressionMethod)) {
+		return ZIP_ERR_UNSUPPORTED_FILE_TYPE;
+	}
+	mappedData = getMappedData(zipFile, entry->dataPointer, entry->compressedSize);
+	if (NULL == mappedData) {
+		return ZIP_ERR_FILE_CORRUPT;
+	}
+	*data = mappedData;
+	return 0;
+}
+
 /** 
  *	Attempt to read the raw data for the zip entry.
  * 
@@ -2123,6 +2223,7 @@ I_32 zip_getZipEntryRawData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEnt
 	I_32 result;
 	I_64 seekResult;
 	I_64 readResult = 0;
+	U_8 *mappedData = NULL;
 
 	ENTER();
 
@@ -2132,6 +2233,13 @@ I_32 zip_getZipEntryRawData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEnt
 		return ZIP_ERR_INTERNAL_ERROR;
 	}
 
+	mappedData = getMappedData(zipFile, entry->dataPointer + (U_64) offset, bufferSize);
+	if (NULL != mappedData) {
+		memcpy(buffer, mappedData, bufferSize);
+		EXIT();
+		return 0;
+	}
+
 	/* Just read the data in.  Widen the data to check for overflow. */
 	if (zipFile->pointer != (entry->dataPointer + (U_64) offset))  {
 		zipFile->pointer = (entry->dataPointer + offset);
@@ -2422,6 +2530,7 @@ zip_openZipFile(J9PortLibrary *portLib, char *filename, J9ZipFile *zipFile, J9Zi
 	zipFile->cache = NULL;
 	zipFile->cachePool = NULL;
 	zipFile->pointer = -1;
+	zipFile->mmapHandle = NULL;
 	/* Allocate space for filename */
 	if (len >= ZIP_INTERNAL_MAX) {
 		zipFile->filename = j9mem_allocate_memory(len + 1, J9MEM_CATEGORY_VM_JCL);
@@ -2523,6 +2632,9 @@ finished:
 	}
 	
 	if (result == 0)  {
+		if (J9_ARE_ANY_BITS_SET(flags, J9ZIP_OPEN_MAP_FILE)) {
+			mapZipFile(portLib, zipFile);
+		}
 		EXIT();
 		return 0;
 	}
@@ -0,0 +1,99 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Measures how fast linked lists can be walked after the collector has copied them. The lists are built
+ * round-robin so that consecutive nodes of a list start out far apart in the heap; copying that places a
+ * node's hot "next" field target right after it turns the walk into a sequential scan. Run it with and
+ * without -XXgc:dbfDisableAdaptiveHotFieldColocation (or with a different -Xgc scan ordering) and compare
+ * the reported nodes/ms.
+ */
+public class HotFieldTraversalBenchmark
+{
+	static final class Node
+	{
+		Node next;
+		long value;
+		/* a reference field that is never read or assigned; it stays null, so the hot field
+		 * selection has a cold reference to tell apart from next */
+		long[] padding;
+	}
+
+	public static Object _garbageHolder;
+
+	/**
+	 * @param args Takes up to three arguments: number of lists, nodes per list and number of measured rounds.
+	 */
+	public static void main(String[] args)
+	{
+		int listCount = (args.length > 0) ? Integer.parseInt(args[0]) : 64;
+		int nodesPerList = (args.length > 1) ? Integer.parseInt(args[1]) : 16384;
+		int rounds = (args.length > 2) ? Integer.parseInt(args[2]) : 20;
+
+		Node[] heads = new Node[listCount];
+		Node[] tails = new Node[listCount];
+		for (int i = 0; i < nodesPerList; i++) {
+			for (int list = 0; list < listCount; list++) {
+				Node node = new Node();
+				node.value = i;
+				if (null == tails[list]) {
+					heads[list] = node;
+				} else {
+					tails[list].next = node;
+				}
+				tails[list] = node;
+			}
+		}
+
+		long checksum = 0;
+		double best = 0;
+		for (int round = 0; round < rounds; round++) {
+			/* churn the heap so that the lists are copied (and hot fields sampled) between rounds */
+			for (int i = 0; i < 200000; i++) {
+				_garbageHolder = new long[16];
+			}
+
+			long start = System.nanoTime();
+			for (int list = 0; list < listCount; list++) {
+				checksum += walk(heads[list]);
+			}
+			long elapsed = Math.max(System.nanoTime() - start, 1);
+			double nodesPerMillisecond = ((double)listCount * nodesPerList * 1000000) / elapsed;
+			best = Math.max(best, nodesPerMillisecond);
+			System.out.println("Round " + round + ": " + (long)nodesPerMillisecond + " nodes/ms");
+		}
+
+		System.out.println("Best: " + (long)best + " nodes/ms (checksum " + checksum + ")");
+		System.out.println("Benchmark ran to completion");
+	}
+
+	private static long walk(Node node)
+	{
+		long sum = 0;
+		while (null != node) {
+			sum += node.value;
+			node = node.next;
+		}
+		return sum;
+	}
+}